@@ -49,22 +49,6 @@ struct TPL_INCREMENT_COUNTER_ACTION {
 typedef struct TPL_INCREMENT_COUNTER_ACTION
 tpl_increment_counter_action;
 
-/*!
- *  \brief  Finalize Schedule Table action structure
- *
- *  This structure add a schedule table to the base action
- *  structure.
- */
-struct TPL_FINALIZE_SCHEDULE_TABLE_ACTION {
-    /*  base action           */
-    VAR(tpl_action, AUTOMATIC)                  b_desc;
-    /*  callback function pointer   */
-    P2VAR(tpl_schedule_table, TYPEDEF, OS_APPL_DATA) schedule_table;
-};
-
-typedef struct TPL_FINALIZE_SCHEDULE_TABLE_ACTION
-	tpl_finalize_schedule_table_action;
-
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -74,9 +58,6 @@ typedef struct TPL_FINALIZE_SCHEDULE_TABLE_ACTION
 FUNC(void, OS_CODE) tpl_action_increment_counter(
     P2CONST(tpl_action, AUTOMATIC, OS_APPL_CONST) action);
 
-FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
-	P2CONST(tpl_action, AUTOMATIC, OS_APPL_CONST) action);
-
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -28,6 +28,7 @@
  */
 
 #include "tpl_as_st_kernel.h"
+#include "tpl_os_kernel.h"
 #include "tpl_os_definitions.h"
 #include "tpl_os_error.h"
 #include "tpl_as_error.h"
@@ -162,12 +163,140 @@ FUNC(void, OS_CODE) tpl_adjust_next_expiry_point(
 }
 
 
+/*
+ * Process the plan of an expiry point. The tasks are activated first,
+ * then the events are set. Since this function is called from the counter
+ * tick with the kernel locked, the rescheduling is done once by the caller
+ * for the whole expiry point.
+ */
+FUNC(void, OS_CODE) tpl_process_expiry_point(
+  P2CONST(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) ep)
+{
+  VAR(tpl_status, AUTOMATIC)        result;
+  VAR(tpl_action_count, AUTOMATIC)  i;
+
+  for (i = 0; i < ep->activate_count; i++)
+  {
+    result = tpl_activate_task(ep->activate[i]);
+    if (result != E_OK)
+    {
+      /*  store information for error hook routine    */
+      STORE_SERVICE(OSServiceId_ActivateTask)
+      STORE_TASK_ID(ep->activate[i])
+      PROCESS_ERROR(result)
+    }
+  }
+
+#if EVENT_COUNT > 0
+  for (i = 0; i < ep->setevent_count; i++)
+  {
+    result = tpl_set_event(ep->setevent[i].task_id, ep->setevent[i].mask);
+    if (result != E_OK)
+    {
+      /*  store information for error hook routine    */
+      STORE_SERVICE(OSServiceId_SetEvent)
+      STORE_TASK_ID(ep->setevent[i].task_id)
+      STORE_EVENT_MASK(ep->setevent[i].mask)
+      PROCESS_ERROR(result)
+    }
+  }
+#endif
+}
+
+/*
+ * The schedule table is finished.
+ * Test whether a schedule table has been nextified or not.
+ */
+FUNC(void, OS_CODE) tpl_finalize_schedule_table(
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) st)
+{
+  P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA) schedtable =
+    (P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))st->stat_part;
+
+  /*  MISRA RULE 45 VIOLATION: a tpl_time_obj* is cast to a
+   tpl_schedtable*. This cast behaves correctly because the
+   first member of tpl_schedula_table is a tpl_time_obj            */
+  P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA) next =
+    ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->next;
+
+  /* Get the next expiry point */
+  P2VAR(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) next_ep;
+
+  /*  Reset the cycle of the time object                                  */
+  st->cycle = 0;
+
+  /*  Reset the index                                                 */
+  /*  MISRA RULE 45 VIOLATION: a tpl_time_obj* is cast to a
+   tpl_schedtable*. This cast behaves correctly because the
+   first memberof tpl_schedule_table is a tpl_time_obj             */
+  ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index = 0;
+
+  if (next != NULL)
+  {
+    /* if next, the synchronisation if forgotten because it's like a changing of mode. */
+
+    /*  reset the state of the current schedule table               */
+    st->state = SCHEDULETABLE_STOPPED;
+
+    /*  Get the next expiry point                                        */
+    next_ep =
+    ((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))next->b_desc.stat_part)->expiry[0];
+
+    /* check if expiry point at offset=0 */
+    if (next_ep->offset == 0)
+    {
+      /* process the plan of the expiry point */
+      tpl_process_expiry_point(next_ep);
+
+      /* Increment index because the first one has just been launched */
+      next->index = 1;
+
+      /* Change next expiry point */
+      next_ep =
+      ((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))next->b_desc.stat_part)->expiry[1];
+    }
+
+    /*  There is a next schedule table set, start it                */
+    next->b_desc.date = next->b_desc.stat_part->counter->current_date + next_ep->offset;
+
+    /*  MISRA RULE 45 VIOLATION: a tpl_schedtable* is cast to a
+     tpl_time_obj*. This cast behaves correctly because the
+     first member of tpl_schedule_table is a tpl_time_obj            */
+    ((tpl_time_obj *)next)->state = SCHEDULETABLE_RUNNING;
+    tpl_insert_time_obj((tpl_time_obj *)next);
+  }
+  else if (schedtable->periodic == TRUE)
+  {
+    /* if first expiry point in the next ST is at offset=0, launch it directly  */
+    if (schedtable->expiry[0]->sync_offset == 0)
+    {
+      /* process the plan of the expiry point */
+      tpl_process_expiry_point(schedtable->expiry[0]);
+
+      /* reset the offset of the first expiry point too */
+      (schedtable->expiry)[0]->sync_offset = (schedtable->expiry)[0]->offset;
+
+      /*Increment index because the first one has just been launched*/
+      ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index = 0;
+    }
+    else
+    {
+      ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index = -1;
+    }
+  }
+  else
+  {
+    /*  reset the state of the current schedule table               */
+    st->state = SCHEDULETABLE_STOPPED;
+  }
+}
+
 /*
  * This function is called when the alarm wrapped to the schedule table is
  * raised. After getting the static part of the alarm (that in this case is
  * a TPL_SCHEDTABLE_STATIC structure, this function get the next expiry point
- * and execute the corresponding actions. Then the alarm is updated to match
- * the offset of the next expiry point.
+ * and process its plan. The last expiry point finalizes the schedule table.
+ * Then the alarm is updated to match the offset of the next expiry point.
  */
 FUNC(void, OS_CODE) tpl_process_schedtable(
   P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) st)
@@ -193,20 +322,15 @@ FUNC(void, OS_CODE) tpl_process_schedtable(
     ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index;
 	VAR(tpl_expiry_count, AUTOMATIC)  index_temp = index;
 	
-  /*  Get the current expiry point                                        */
-  P2VAR(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) current_ep =
-  	(schedtable->expiry)[index];
-
-  P2CONST(tpl_action, AUTOMATIC, OS_APPL_DATA)  action_desc;
-  VAR(tpl_action_count, AUTOMATIC)  i;
-	
 	VAR(tpl_expiry_count, AUTOMATIC) abs_deviation = ( ~(((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation - 1 ) );
 	
-  /*launch all the actions of the expiry point*/
-  for (i = 0; i < current_ep->count; i++)
+  /*  process the plan of the current expiry point                        */
+  tpl_process_expiry_point((schedtable->expiry)[index]);
+
+  /*  the last expiry point finalizes the schedule table                  */
+  if (index == (schedtable->count - 1))
   {
-    action_desc = (current_ep->actions)[i];
-    (action_desc->action)(action_desc);
+    tpl_finalize_schedule_table(st);
   }
 	
   index = ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index;
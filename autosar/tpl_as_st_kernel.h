@@ -84,12 +84,33 @@ struct TPL_SCHEDTABLE_SYNC {
                                                      (hard or smooth)         */
 };
 
+/**
+ * @struct TPL_EXPIRY_SETEVENT
+ *
+ * This structure stores a task and the event mask to set when an
+ * expiry point of a schedule table is processed.
+ */
+struct TPL_EXPIRY_SETEVENT {
+    VAR(tpl_task_id, TYPEDEF)     task_id;    /**< task to send the events to   */
+    VAR(tpl_event_mask, TYPEDEF)  mask;       /**< event mask to set            */
+};
+
+/**
+ * @typedef tpl_expiry_setevent
+ *
+ * This is an alias for the structure #TPL_EXPIRY_SETEVENT
+ *
+ * @see #TPL_EXPIRY_SETEVENT
+ */
+typedef struct TPL_EXPIRY_SETEVENT tpl_expiry_setevent;
+
 /**
  * @struct TPL_EXPIRY_POINT
  *
- * This structure put together a time offset, the number of actions
- * associated with the expiry point and a pointer to an array
- * of actions to be done at that time offset for a schedule table.
+ * This structure put together a time offset and the plan of the
+ * expiry point computed by goil: the array of the tasks to activate
+ * and the array of the events to set at that time offset for a
+ * schedule table. Tasks are activated first, then events are set.
  *
  * The offset of the first expiry point of a schedule table is the
  * period of the schedule table.
@@ -99,10 +120,13 @@ struct TPL_EXPIRY_POINT {
                                                                for synchronization                */
     VAR(tpl_tick, TYPEDEF)                     sync_offset;/**< offset of the actions from the
                                                                start time of the schedule table   */
-    VAR(tpl_action_count, TYPEDEF)             count;      /**< number of actions associated with
-                                                               the expiry point                   */
-    P2CONST(tpl_action, TYPEDEF, OS_APPL_DATA) *actions;    /**< pointer to an array of actions to
-                                                               be done at that offset.            */
+    VAR(tpl_action_count, TYPEDEF)             activate_count; /**< number of tasks to activate */
+    VAR(tpl_action_count, TYPEDEF)             setevent_count; /**< number of events to set     */
+    P2CONST(tpl_task_id, TYPEDEF, OS_CONST)    activate;   /**< pointer to an array of tasks to
+                                                               activate at that offset            */
+    P2CONST(tpl_expiry_setevent, TYPEDEF, OS_CONST)
+                                               setevent;   /**< pointer to an array of events to
+                                                               set at that offset                 */
     VAR(tpl_tick, TYPEDEF)                     max_advance;/**< maximum advance deviation from
                                                                initial offset of expiry point
                                                                after synchronization              */
@@ -243,6 +267,31 @@ extern CONSTP2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA)
 extern FUNC(void, OS_CODE) tpl_process_schedtable(
     P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) st);
 
+/**
+ * @internal
+ *
+ * Process the plan of an expiry point: activates the tasks and sets the
+ * events of the expiry point. This function is called with the kernel
+ * locked, the rescheduling is done once by the caller.
+ *
+ * @param ep  the expiry point to process
+ */
+extern FUNC(void, OS_CODE) tpl_process_expiry_point(
+    P2CONST(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) ep);
+
+/**
+ * @internal
+ *
+ * This function is called when the last expiry point of a schedule table
+ * has been processed. If a schedule table has been nextified, it is started.
+ * Otherwise, a periodic schedule table is restarted and a single shot
+ * schedule table is stopped.
+ *
+ * @param st  the schedule table
+ */
+extern FUNC(void, OS_CODE) tpl_finalize_schedule_table(
+    P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) st);
+
 /**
  * @internal
  *
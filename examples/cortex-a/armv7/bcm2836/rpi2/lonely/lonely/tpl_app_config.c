@@ -49,15 +49,6 @@
 
 CONST(tpl_application_mode, OS_CONST) std = 0; /* mask = 1 */
 CONST(tpl_application_mode, OS_CONST) OSDEFAULTAPPMODE = 0;
-CONST(tpl_appmode_mask, OS_CONST) tpl_task_app_mode[TASK_COUNT] = {
-  1 /* task task1 : std */ ,
-  0 /* task task2 :  */ ,
-  0 /* task task3 :  */ 
-};
-
-CONST(tpl_appmode_mask, OS_CONST) tpl_alarm_app_mode[ALARM_COUNT] = {
-  1 /* alarm Alarm1 : std */ 
-};
 
 #define API_START_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -101,6 +92,31 @@ CONST(AlarmType, AUTOMATIC) Alarm1 = Alarm1_id;
 #define API_STOP_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+CONST(tpl_task_id, OS_CONST) tpl_std_autostart_tasks[1] = {
+  task1_id
+};
+
+CONST(tpl_alarm_id, OS_CONST) tpl_std_autostart_alarms[1] = {
+  Alarm1_id /* counter SystemCounter, date 50 */
+};
+
+CONST(tpl_appmode_autostart, OS_CONST)
+  tpl_appmode_autostart_table[APP_MODE_COUNT] = {
+  {
+    /* application mode std */
+    /* AUTOSTART tasks count            */  1,
+    /* AUTOSTART alarms count           */  1,
+    /* AUTOSTART tasks                  */  tpl_std_autostart_tasks,
+    /* AUTOSTART alarms                 */  tpl_std_autostart_alarms
+  }
+};
+
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
 /*=============================================================================
  * Definition and initialization of regular Resource related structures
  */
@@ -149,6 +149,11 @@
  */
 #define SCHEDTABLE_COUNT       0
 
+/*-----------------------------------------------------------------------------
+ * Number of application modes
+ */
+#define APP_MODE_COUNT         1
+
 /*-----------------------------------------------------------------------------
  * Number of OS Applications
  */
@@ -11,6 +11,7 @@
 #include "command_line_interface/C_builtin_CLI_Options.cpp"
 #include "command_line_interface/F_Analyze_CLI_Options.cpp"
 #include "command_line_interface/F_mainForLIBPM.cpp"
+#include "command_line_interface/F_CompileServer.cpp"
 
 //--- BDD
 #include "bdd/C_BDD.cpp"
@@ -0,0 +1,450 @@
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//  Compile server and client ('--server' and '--connect' first command line arguments)                                *
+//                                                                                                                     *
+//  This file is part of libpm library                                                                                 *
+//                                                                                                                     *
+//  Copyright (C) 2026 Pierre Molinaro.                                                                                *
+//                                                                                                                     *
+//  e-mail : pierre.molinaro@irccyn.ec-nantes.fr                                                                       *
+//                                                                                                                     *
+//  IRCCyN, Institut de Recherche en Communications et Cybernétique de Nantes, ECN, École Centrale de Nantes (France)  *
+//                                                                                                                     *
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General  *
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)  *
+//  any later version.                                                                                                 *
+//                                                                                                                     *
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied      *
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for            *
+//  more details.                                                                                                      *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#include "command_line_interface/F_CompileServer.h"
+#include "files/C_FileManager.h"
+#include "strings/C_String.h"
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#ifndef COMPILE_FOR_WINDOWS
+  #error COMPILE_FOR_WINDOWS is not defined
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if COMPILE_FOR_WINDOWS == 0
+  #include <errno.h>
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <signal.h>
+  #include <unistd.h>
+  #include <sys/socket.h>
+  #include <sys/types.h>
+  #include <sys/un.h>
+  #include <sys/wait.h>
+
+  extern char ** environ ;
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static const char kServerOption [] = "--server=" ;
+static const char kPreloadOption [] = "--preload=" ;
+static const char kConnectOption [] = "--connect=" ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool isCompileServerInvocation (const int inArgc, const char * inArgv []) {
+  return (inArgc > 1) && (strncmp (inArgv [1], kServerOption, strlen (kServerOption)) == 0) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool isCompileClientInvocation (const int inArgc, const char * inArgv []) {
+  return (inArgc > 1) && (strncmp (inArgv [1], kConnectOption, strlen (kConnectOption)) == 0) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 1
+  bool runCompileServer (const int /* inArgc */,
+                         const char * /* inArgv */ [],
+                         int & /* outArgc */,
+                         const char ** & /* outArgv */) {
+    printf ("*** Error: the compile server is not available on Windows ***\n") ;
+    return false ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 1
+  int runCompileClient (const int /* inArgc */, const char * /* inArgv */ []) {
+    printf ("*** Error: the compile server is not available on Windows ***\n") ;
+    return 1 ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Frames: a tag character, a 4-byte big endian length, then the data                                                *
+//     client -> server: 'D' current directory, 'A' argument, 'V' environment variable, then 'R' (run)                 *
+//     server -> client: 'O' standard output, 'E' standard error, then 'X' exit code (4-byte big endian)               *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static const uint32_t kMaximumFrameLength = 1 << 20 ;
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool writeAll (const int inFileDescriptor, const char * inData, const size_t inLength) {
+    size_t written = 0 ;
+    bool ok = true ;
+    while (ok && (written < inLength)) {
+      const ssize_t n = ::write (inFileDescriptor, & inData [written], inLength - written) ;
+      if (n > 0) {
+        written += (size_t) n ;
+      }else{
+        ok = (n < 0) && (errno == EINTR) ;
+      }
+    }
+    return ok ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool readAll (const int inFileDescriptor, char * outData, const size_t inLength) {
+    size_t readCount = 0 ;
+    bool ok = true ;
+    while (ok && (readCount < inLength)) {
+      const ssize_t n = ::read (inFileDescriptor, & outData [readCount], inLength - readCount) ;
+      if (n > 0) {
+        readCount += (size_t) n ;
+      }else{
+        ok = (n < 0) && (errno == EINTR) ;
+      }
+    }
+    return ok ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool writeFrame (const int inSocket, const char inTag, const char * inData, const uint32_t inLength) {
+    char header [5] ;
+    header [0] = inTag ;
+    header [1] = (char) ((inLength >> 24) & 255) ;
+    header [2] = (char) ((inLength >> 16) & 255) ;
+    header [3] = (char) ((inLength >> 8) & 255) ;
+    header [4] = (char) (inLength & 255) ;
+    return writeAll (inSocket, header, 5) && writeAll (inSocket, inData, inLength) ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+// On success, outData is a nul terminated string allocated by malloc
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool readFrame (const int inSocket, char & outTag, char * & outData, uint32_t & outLength) {
+    char header [5] ;
+    bool ok = readAll (inSocket, header, 5) ;
+    if (ok) {
+      outTag = header [0] ;
+      outLength = ((uint32_t) (uint8_t) header [1] << 24)
+                | ((uint32_t) (uint8_t) header [2] << 16)
+                | ((uint32_t) (uint8_t) header [3] << 8)
+                | (uint32_t) (uint8_t) header [4] ;
+      ok = outLength <= kMaximumFrameLength ;
+    }
+    if (ok) {
+      outData = (char *) ::malloc (outLength + 1) ;
+      ok = readAll (inSocket, outData, outLength) ;
+      outData [outLength] = '\0' ;
+      if (! ok) {
+        ::free (outData) ;
+        outData = NULL ;
+      }
+    }
+    return ok ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool socketAddressForPath (const char * inSocketPath, struct sockaddr_un & outAddress) {
+    memset (& outAddress, 0, sizeof (outAddress)) ;
+    outAddress.sun_family = AF_UNIX ;
+    const bool ok = strlen (inSocketPath) < sizeof (outAddress.sun_path) ;
+    if (ok) {
+      strcpy (outAddress.sun_path, inSocketPath) ;
+    }else{
+      printf ("*** Error: socket path '%s' is too long ***\n", inSocketPath) ;
+    }
+    return ok ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Server                                                                                                            *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void appendString (char * inString, char ** & ioArray, int & ioCount) {
+    ioArray = (char **) ::realloc (ioArray, ((size_t) ioCount + 2) * sizeof (char *)) ;
+    ioArray [ioCount] = inString ;
+    ioCount ++ ;
+    ioArray [ioCount] = NULL ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+// Runs in a process forked for the request. It forks again the process that performs the compilation (the function
+// returns true in this one), and sends its output and its exit code to the client.
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool handleRequest (const int inSocket,
+                             int & outArgc,
+                             const char ** & outArgv) {
+  //--- Read request
+    char * directory = NULL ;
+    char ** arguments = NULL ;
+    int argumentCount = 0 ;
+    char ** environment = (char **) ::malloc (sizeof (char *)) ;
+    environment [0] = NULL ;
+    int environmentCount = 0 ;
+    bool ok = true ;
+    bool loop = true ;
+    while (ok && loop) {
+      char tag = '\0' ;
+      char * data = NULL ;
+      uint32_t length = 0 ;
+      ok = readFrame (inSocket, tag, data, length) ;
+      if (ok && (tag == 'D')) {
+        ::free (directory) ;
+        directory = data ;
+      }else if (ok && (tag == 'A')) {
+        appendString (data, arguments, argumentCount) ;
+      }else if (ok && (tag == 'V')) {
+        appendString (data, environment, environmentCount) ;
+      }else if (ok) {
+        ::free (data) ;
+        ok = tag == 'R' ;
+        loop = false ;
+      }
+    }
+    ok = ok && (directory != NULL) && (argumentCount > 0) ;
+  //--- Pipes for standard output and standard error
+    int outputPipe [2] = {-1, -1} ;
+    int errorPipe [2] = {-1, -1} ;
+    if (ok) {
+      ok = (::pipe (outputPipe) == 0) && (::pipe (errorPipe) == 0) ;
+    }
+  //--- Fork the process that performs the compilation
+    pid_t pid = -1 ;
+    if (ok) {
+      pid = ::fork () ;
+      ok = pid >= 0 ;
+    }
+    bool compile = false ;
+    if (ok && (pid == 0)) {
+      ::close (inSocket) ;
+      const int nullInput = ::open ("/dev/null", O_RDONLY) ;
+      if (nullInput >= 0) {
+        ::dup2 (nullInput, 0) ;
+        ::close (nullInput) ;
+      }
+      ::dup2 (outputPipe [1], 1) ;
+      ::dup2 (errorPipe [1], 2) ;
+      ::close (outputPipe [0]) ; ::close (outputPipe [1]) ;
+      ::close (errorPipe [0]) ; ::close (errorPipe [1]) ;
+      environ = environment ;
+      if (::chdir (directory) != 0) {
+        fprintf (stderr, "*** Error: cannot change current directory to '%s' ***\n", directory) ;
+        ::exit (1) ;
+      }
+      outArgc = argumentCount ;
+      outArgv = (const char **) arguments ;
+      compile = true ;
+  //--- Copy the output of the compilation to the client, then send the exit code
+    }else if (ok) {
+      ::close (outputPipe [1]) ;
+      ::close (errorPipe [1]) ;
+      struct pollfd fds [2] ;
+      fds [0].fd = outputPipe [0] ;
+      fds [0].events = POLLIN ;
+      fds [1].fd = errorPipe [0] ;
+      fds [1].events = POLLIN ;
+      int openPipeCount = 2 ;
+      char buffer [4096] ;
+      while (openPipeCount > 0) {
+        const int r = ::poll (fds, 2, -1) ;
+        for (int i=0 ; (r > 0) && (i<2) ; i++) {
+          if ((fds [i].fd >= 0) && (fds [i].revents != 0)) {
+            const ssize_t n = ::read (fds [i].fd, buffer, sizeof (buffer)) ;
+            if (n > 0) {
+              writeFrame (inSocket, (i == 0) ? 'O' : 'E', buffer, (uint32_t) n) ;
+            }else if ((n == 0) || (errno != EINTR)) {
+              ::close (fds [i].fd) ;
+              fds [i].fd = -1 ;
+              openPipeCount -- ;
+            }
+          }
+        }
+      }
+      int status = 0 ;
+      while ((::waitpid (pid, & status, 0) < 0) && (errno == EINTR)) {
+      }
+      const uint32_t exitCode = WIFEXITED (status) ? (uint32_t) WEXITSTATUS (status) : 128 + (uint32_t) WTERMSIG (status) ;
+      char exitCodeData [4] ;
+      exitCodeData [0] = (char) ((exitCode >> 24) & 255) ;
+      exitCodeData [1] = (char) ((exitCode >> 16) & 255) ;
+      exitCodeData [2] = (char) ((exitCode >> 8) & 255) ;
+      exitCodeData [3] = (char) (exitCode & 255) ;
+      writeFrame (inSocket, 'X', exitCodeData, 4) ;
+    }
+    return compile ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  bool runCompileServer (const int inArgc,
+                         const char * inArgv [],
+                         int & outArgc,
+                         const char ** & outArgv) {
+    const char * socketPath = & inArgv [1] [strlen (kServerOption)] ;
+  //--- Preload directories
+    bool ok = true ;
+    for (int i=2 ; (i<inArgc) && ok ; i++) {
+      ok = strncmp (inArgv [i], kPreloadOption, strlen (kPreloadOption)) == 0 ;
+      if (ok) {
+        C_FileManager::cacheTextFilesInDirectory (& inArgv [i] [strlen (kPreloadOption)]) ;
+      }else{
+        printf ("*** Error: invalid '%s' server option ***\n", inArgv [i]) ;
+      }
+    }
+  //--- Listen
+    struct sockaddr_un address ;
+    ok = ok && socketAddressForPath (socketPath, address) ;
+    int listenSocket = -1 ;
+    if (ok) {
+      listenSocket = ::socket (AF_UNIX, SOCK_STREAM, 0) ;
+      ::unlink (socketPath) ;
+      ok = (listenSocket >= 0)
+        && (::bind (listenSocket, (struct sockaddr *) & address, sizeof (address)) == 0)
+        && (::listen (listenSocket, 16) == 0) ;
+      if (! ok) {
+        perror ("compile server") ;
+      }
+    }
+    if (ok) {
+      printf ("Compile server listening on '%s', %d preloaded files.\n",
+              socketPath, (int) C_FileManager::cachedTextFileCount ()) ;
+      fflush (stdout) ;
+    }
+  //--- Request loop; processes forked for the requests are not waited for
+    ::signal (SIGCHLD, SIG_IGN) ;
+    bool compile = false ;
+    while (ok && ! compile) {
+      const int s = ::accept (listenSocket, NULL, NULL) ;
+      if (s >= 0) {
+        fflush (stdout) ;
+        fflush (stderr) ;
+        const pid_t pid = ::fork () ;
+        if (pid == 0) {
+          ::close (listenSocket) ;
+          ::signal (SIGCHLD, SIG_DFL) ;
+          compile = handleRequest (s, outArgc, outArgv) ;
+          if (! compile) {
+            ::_exit (0) ;
+          }
+        }else{
+          ::close (s) ;
+        }
+      }else if (errno != EINTR) {
+        perror ("compile server") ;
+        ok = false ;
+      }
+    }
+    return compile ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Client                                                                                                            *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  int runCompileClient (const int inArgc, const char * inArgv []) {
+    const char * socketPath = & inArgv [1] [strlen (kConnectOption)] ;
+    struct sockaddr_un address ;
+    bool ok = socketAddressForPath (socketPath, address) ;
+    int s = -1 ;
+    if (ok) {
+      s = ::socket (AF_UNIX, SOCK_STREAM, 0) ;
+      ok = (s >= 0) && (::connect (s, (struct sockaddr *) & address, sizeof (address)) == 0) ;
+      if (! ok) {
+        fprintf (stderr, "*** Error: cannot connect to compile server '%s' ***\n", socketPath) ;
+      }
+    }
+  //--- Send request
+    if (ok) {
+      const C_String directory = C_FileManager::currentDirectory () ;
+      const char * d = directory.cString (HERE) ;
+      ok = writeFrame (s, 'D', d, (uint32_t) strlen (d))
+        && writeFrame (s, 'A', inArgv [0], (uint32_t) strlen (inArgv [0])) ;
+      for (int i=2 ; (i<inArgc) && ok ; i++) {
+        ok = writeFrame (s, 'A', inArgv [i], (uint32_t) strlen (inArgv [i])) ;
+      }
+      for (int i=0 ; (environ [i] != NULL) && ok ; i++) {
+        ok = writeFrame (s, 'V', environ [i], (uint32_t) strlen (environ [i])) ;
+      }
+      ok = ok && writeFrame (s, 'R', "", 0) ;
+    }
+  //--- Copy output until exit code
+    int exitCode = 1 ;
+    bool loop = ok ;
+    while (loop) {
+      char tag = '\0' ;
+      char * data = NULL ;
+      uint32_t length = 0 ;
+      loop = readFrame (s, tag, data, length) ;
+      if (! loop) {
+        fprintf (stderr, "*** Error: connection to compile server '%s' lost ***\n", socketPath) ;
+      }else if (tag == 'O') {
+        writeAll (1, data, length) ;
+      }else if (tag == 'E') {
+        writeAll (2, data, length) ;
+      }else if ((tag == 'X') && (length == 4)) {
+        exitCode = (int) (((uint32_t) (uint8_t) data [0] << 24)
+                        | ((uint32_t) (uint8_t) data [1] << 16)
+                        | ((uint32_t) (uint8_t) data [2] << 8)
+                        | (uint32_t) (uint8_t) data [3]) ;
+        loop = false ;
+      }
+      ::free (data) ;
+    }
+    if (s >= 0) {
+      ::close (s) ;
+    }
+    return exitCode ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
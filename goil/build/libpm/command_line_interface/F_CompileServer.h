@@ -0,0 +1,60 @@
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//  Compile server and client ('--server' and '--connect' first command line arguments)                                *
+//                                                                                                                     *
+//  This file is part of libpm library                                                                                 *
+//                                                                                                                     *
+//  Copyright (C) 2026 Pierre Molinaro.                                                                                *
+//                                                                                                                     *
+//  e-mail : pierre.molinaro@irccyn.ec-nantes.fr                                                                       *
+//                                                                                                                     *
+//  IRCCyN, Institut de Recherche en Communications et Cybernétique de Nantes, ECN, École Centrale de Nantes (France)  *
+//                                                                                                                     *
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General  *
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)  *
+//  any later version.                                                                                                 *
+//                                                                                                                     *
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied      *
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for            *
+//  more details.                                                                                                      *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#ifndef ROUTINE_COMPILE_SERVER_DECLARED
+#define ROUTINE_COMPILE_SERVER_DECLARED
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#include "utilities/M_machine.h"
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//  tool --server=<socket path> [--preload=<directory>]...                                                             *
+//    Listens on a Unix domain socket. The text files of the preload directories are read once into the text file      *
+//    cache of C_FileManager. For each request, a process is forked: it runs the compilation with the current          *
+//    directory, the environment and the command line sent by the client, and its output is sent back to the client.   *
+//    The function returns in this process only (true, outArgc and outArgv are the command line of the request), or    *
+//    if the server cannot be started (false).                                                                         *
+//                                                                                                                     *
+//  tool --connect=<socket path> <arguments>...                                                                        *
+//    Sends the request to the server, copies the output of the compilation to stdout and stderr, and returns its      *
+//    exit code.                                                                                                       *
+//                                                                                                                     *
+//  Not available on Windows.                                                                                          *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool isCompileServerInvocation (const int inArgc, const char * inArgv []) ;
+
+bool isCompileClientInvocation (const int inArgc, const char * inArgv []) ;
+
+bool runCompileServer (const int inArgc,
+                       const char * inArgv [],
+                       int & outArgc,
+                       const char ** & outArgv) ;
+
+int runCompileClient (const int inArgc, const char * inArgv []) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#endif
@@ -31,6 +31,7 @@
 #include "utilities/basic-allocation.h"
 #include "utilities/C_PrologueEpilogue.h"
 #include "command_line_interface/F_Analyze_CLI_Options.h"
+#include "command_line_interface/F_CompileServer.h"
 #include "strings/unicode_character_base.h"
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -62,19 +63,29 @@ C_String commandLineArgumentAtIndex (const uint32_t inIndex) {
 
 int main (int argc, const char * argv []) {
 //  displayUnicodeCharacterRange () ;
+  int returnCode = 0 ; // No error
+//--- Compile server: returns in the process forked for a request, with the command line of the request
+  bool compile = true ;
+  if (isCompileServerInvocation (argc, argv)) {
+    compile = runCompileServer (argc, argv, argc, argv) ;
+    returnCode = compile ? 0 : 1 ;
+  }else if (isCompileClientInvocation (argc, argv)) {
+    returnCode = runCompileClient (argc, argv) ;
+    compile = false ;
+  }
+//---
   gArgc = (uint32_t) argc ;
   gArgv = argv ;
   // PMUInt128::example () ;
   // C_DirectedGraph::example () ;
   C_DateTime::enterCurrentToolModificationTime (argv [0]) ;
-  int returnCode = 0 ; // No error
 //--- Print options
   /* printf ("Command line options:\n") ;
   for (int i=1 ; i<argc ; i++) {
     printf ("  - '%s'\n", argv [i]) ;
   } */
 //---
-  if (returnCode == 0) {
+  if (compile) {
     try{
       C_PrologueEpilogue::runPrologueActions () ;
       returnCode = mainForLIBPM (argc, argv) ;
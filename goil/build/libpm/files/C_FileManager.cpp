@@ -24,6 +24,8 @@
 #include "files/C_TextFileWrite.h"
 #include "files/C_BinaryFileWrite.h"
 #include "strings/unicode_character_base.h"
+#include "utilities/C_PrologueEpilogue.h"
+#include "time/C_DateTime.h"
 
 //---------------------------------------------------------------------------------------------------------------------*
 
@@ -576,15 +578,15 @@ static void parseASCIIWithReplacementCharacter (const C_Data & inDataString,
 
 //---------------------------------------------------------------------------------------------------------------------*
   
-C_String C_FileManager::stringWithContentOfFile (const C_String & inFilePath,
-                                                 PMTextFileEncoding & outTextFileEncoding,
-                                                 bool & outOk) {
+static C_String stringWithContentOfFileOnDisk (const C_String & inFilePath,
+                                               PMTextFileEncoding & outTextFileEncoding,
+                                               bool & outOk) {
   #ifdef PRINT_SNIFF_ENCODING
     printf ("** SNIFF ENCODING for '%s': ", inFilePath.cString (HERE)) ;
   #endif
 //--- Read file
   C_Data stringData ;
-  outOk = binaryDataWithContentOfFile (inFilePath, stringData) ;
+  outOk = C_FileManager::binaryDataWithContentOfFile (inFilePath, stringData) ;
   const int32_t length = stringData.length () ;
 //--- Assign C string to C_String
   C_String result_string ;
@@ -613,6 +615,121 @@ C_String C_FileManager::stringWithContentOfFile (const C_String & inFilePath,
   return result_string ;
 }
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Text file cache: filled by the compile server before it forks a process for each request, so the requests read    *
+//   the preloaded files from memory. An entry is used only if the file size and modification time are unchanged.      *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cCachedTextFile {
+  public : C_String mFilePath ; // Absolute
+  public : C_String mContents ;
+  public : PMTextFileEncoding mTextFileEncoding ;
+  public : C_DateTime mModificationTime ;
+  public : uint64_t mFileSize ;
+
+  public : cCachedTextFile (void) ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cCachedTextFile::cCachedTextFile (void) :
+mFilePath (),
+mContents (),
+mTextFileEncoding (kUTF_8_FileEncoding),
+mModificationTime (0),
+mFileSize (0) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <cCachedTextFile> gTextFileCache ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void recursiveCacheTextFilesInDirectory (const C_String & inDirectoryPath) {
+  const C_String nativeDirectoryPath = C_FileManager::nativePathWithUnixPath (inDirectoryPath) ;
+  DIR * dir = ::opendir (nativeDirectoryPath.cString (HERE)) ;
+  if (dir != NULL) {
+    struct dirent  * current = readdir (dir) ;
+    while (current != NULL) {
+      if (current->d_name [0] != '.') {
+        C_String name = inDirectoryPath ;
+        name.appendCString ("/") ;
+        name.appendCString (current->d_name) ;
+        if (C_FileManager::directoryExists (name)) {
+          recursiveCacheTextFilesInDirectory (name) ;
+        }else if (C_FileManager::fileExistsAtPath (name)) {
+          cCachedTextFile entry ;
+          bool ok = false ;
+          entry.mContents = stringWithContentOfFileOnDisk (name, entry.mTextFileEncoding, ok) ;
+          if (ok) {
+            entry.mFilePath = name ;
+            entry.mModificationTime = C_FileManager::fileModificationTime (name) ;
+            entry.mFileSize = C_FileManager::fileSize (name) ;
+            gTextFileCache.appendObject (entry) ;
+          }
+        }
+      }
+      current = readdir (dir) ;
+    }
+    closedir (dir) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void C_FileManager::cacheTextFilesInDirectory (const C_String & inDirectoryPath) {
+  recursiveCacheTextFilesInDirectory (absolutePathFromCurrentDirectory (inDirectoryPath)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+int32_t C_FileManager::cachedTextFileCount (void) {
+  return gTextFileCache.count () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void C_FileManager::releaseTextFileCache (void) {
+  gTextFileCache.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gReleaseTextFileCache (NULL, C_FileManager::releaseTextFileCache) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_String C_FileManager::stringWithContentOfFile (const C_String & inFilePath,
+                                                 PMTextFileEncoding & outTextFileEncoding,
+                                                 bool & outOk) {
+  int32_t cacheIndex = -1 ;
+  if (gTextFileCache.count () > 0) {
+    const C_String filePath = absolutePathFromCurrentDirectory (inFilePath) ;
+    for (int32_t i=0 ; (i<gTextFileCache.count ()) && (cacheIndex < 0) ; i++) {
+      if (gTextFileCache (i COMMA_HERE).mFilePath == filePath) {
+        cacheIndex = i ;
+      }
+    }
+    if ((cacheIndex >= 0)
+     && ((gTextFileCache (cacheIndex COMMA_HERE).mFileSize != fileSize (filePath))
+      || (gTextFileCache (cacheIndex COMMA_HERE).mModificationTime != fileModificationTime (filePath)))) {
+      cacheIndex = -1 ;
+    }
+  }
+  C_String result ;
+  if (cacheIndex >= 0) {
+    result = gTextFileCache (cacheIndex COMMA_HERE).mContents ;
+    outTextFileEncoding = gTextFileCache (cacheIndex COMMA_HERE).mTextFileEncoding ;
+    outOk = true ;
+  }else{
+    result = stringWithContentOfFileOnDisk (inFilePath, outTextFileEncoding, outOk) ;
+  }
+  return result ;
+}
+
 //---------------------------------------------------------------------------------------------------------------------*
   
 C_String C_FileManager::stringWithContentOfFile (const C_String & inFilePath) {
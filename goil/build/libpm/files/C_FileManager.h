@@ -57,6 +57,14 @@ class C_FileManager {
                                                     PMTextFileEncoding & outTextFileEncoding,
                                                     bool & outOk) ;
 
+//--- Text file cache (filled by the compile server, see F_CompileServer.h); stringWithContentOfFile returns the
+//    cached contents of a file while its size and modification time are unchanged
+  public : static void cacheTextFilesInDirectory (const C_String & inDirectoryPath) ;
+
+  public : static int32_t cachedTextFileCount (void) ;
+
+  public : static void releaseTextFileCache (void) ;
+
 //--- Write string to file
   public : static bool writeStringToFile (const C_String & inString,
                                           const C_String & inFilePath) ;
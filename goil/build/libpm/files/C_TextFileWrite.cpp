@@ -44,7 +44,7 @@ bool C_TextFileWrite::close (void) {
   bool ok = true ;
   if (mFilePtr != NULL) {
     if (mBufferLength > 0) {
-      ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
+      ::fwrite (mBuffer, 1, (size_t) mBufferLength, mFilePtr) ;
       mBufferLength = 0 ;
     }
     ok = ::fclose (mFilePtr) == 0 ; // Flushes the file, then closes it
@@ -60,7 +60,7 @@ bool C_TextFileWrite::close (void) {
 
 C_TextFileWrite::~C_TextFileWrite (void) {
   if ((mFilePtr != NULL) && (mBufferLength > 0)) {
-    ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
+    ::fwrite (mBuffer, 1, (size_t) mBufferLength, mFilePtr) ;
     mBufferLength = 0 ;
   }
 }
@@ -77,10 +77,10 @@ void C_TextFileWrite::performActualCharArrayOutput (const char * inCharArray,
       mBufferLength += inArrayCount ;
     }else{
       if (mBufferLength > 0) {
-        ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
+        ::fwrite (mBuffer, 1, (size_t) mBufferLength, mFilePtr) ;
         mBufferLength = 0 ;
       }
-      ::fprintf (mFilePtr, "%.*s", (int) inArrayCount, inCharArray) ;
+      ::fwrite (inCharArray, 1, (size_t) inArrayCount, mFilePtr) ;
     }
   }
 }
@@ -90,15 +90,18 @@ void C_TextFileWrite::performActualCharArrayOutput (const char * inCharArray,
 void C_TextFileWrite::performActualUnicodeArrayOutput (const utf32 * inCharArray,
                                                        const int32_t inArrayCount) {
   if ((mFilePtr != NULL) && (inArrayCount > 0)) {
+  //--- Characters are encoded in place, an UTF-8 sequence is at most 4 bytes long
     for (int32_t i=0 ; i<inArrayCount ; i++) {
-      char buffer [5] ;
-      const int32_t length = UTF8StringFromUTF32Character (inCharArray [i], buffer) ;
-      if ((mBufferLength + length) > kFileBufferSize) {
-        ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
+      if ((mBufferLength + 4) > kFileBufferSize) {
+        ::fwrite (mBuffer, 1, (size_t) mBufferLength, mFilePtr) ;
         mBufferLength = 0 ;
       }
-      ::memcpy (& mBuffer [mBufferLength], buffer, (size_t) length) ;
-      mBufferLength += length ;
+      if (UNICODE_VALUE (inCharArray [i]) < 0x80) { // ASCII
+        mBuffer [mBufferLength] = (char) UNICODE_VALUE (inCharArray [i]) ;
+        mBufferLength ++ ;
+      }else{
+        mBufferLength += UTF8StringFromUTF32Character (inCharArray [i], & mBuffer [mBufferLength]) ;
+      }
     }
   }
 }
@@ -110,7 +113,7 @@ void C_TextFileWrite::performActualUnicodeArrayOutput (const utf32 * inCharArray
 void C_TextFileWrite::flush (void) {
   if (mFilePtr != NULL) {
     if (mBufferLength > 0) {
-      ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
+      ::fwrite (mBuffer, 1, (size_t) mBufferLength, mFilePtr) ;
       mBufferLength = 0 ;
     }
     ::fflush (mFilePtr) ;
@@ -85,6 +85,8 @@ class cSharedMapRoot : public C_SharedObject {
                                                                const uint32_t inLevel,
                                                                const cSharedMapRoot * inFirstMap) const ;
 
+  private : VIRTUAL_IN_DEBUG cMapNode * findEntryInMapForUpdate (const C_String & inKey) ;
+
   public : VIRTUAL_IN_DEBUG void findNearestKey (const C_String & inKey,
                                                  TC_UniqueArray <C_String> & ioNearestKeyArray) const ;
 
@@ -159,10 +161,15 @@ class cSharedMapRoot : public C_SharedObject {
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
+//--- Nodes are shared : copying a map only shares its tree. mReferenceCount is the number of map roots and parent
+//    nodes that point to the node ; a shared node is duplicated (see makeNodeUnique) before being modified, so only
+//    the path from the root to a modified node is copied.
+
 class cMapNode {
   public : cMapNode * mInfPtr ;
   public : cMapNode * mSupPtr ;
   public : int32_t mBalance ;
+  public : uint32_t mReferenceCount ;
   public : const C_String mKey ;
   public : capCollectionElement mAttributes ;
 
@@ -170,7 +177,7 @@ class cMapNode {
   public : cMapNode (const C_String & inKey,
                      const capCollectionElement & inAttributes) ;
 
-  public : cMapNode (cMapNode * inNode) ;
+  public : cMapNode (const cMapNode * inNode) ;
 
 //--- Destructor
   public : ~ cMapNode (void) ;
@@ -191,8 +198,40 @@ mOverridenMap (NULL) {
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+static void retainNode (cMapNode * inNode) {
+  if (NULL != inNode) {
+    inNode->mReferenceCount ++ ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void releaseNode (cMapNode * & ioNode) {
+  if (NULL != ioNode) {
+    macroValidPointer (ioNode) ;
+    ioNode->mReferenceCount -- ;
+    if (0 == ioNode->mReferenceCount) {
+      macroMyDelete (ioNode) ;
+    }
+    ioNode = NULL ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void makeNodeUnique (cMapNode * & ioNode) {
+  if ((NULL != ioNode) && (ioNode->mReferenceCount > 1)) {
+    cMapNode * p = NULL ;
+    macroMyNew (p, cMapNode (ioNode)) ;
+    ioNode->mReferenceCount -- ;
+    ioNode = p ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 cSharedMapRoot::~ cSharedMapRoot (void) {
-  macroMyDelete (mRoot) ;
+  releaseNode (mRoot) ;
   macroDetachSharedObject (mOverridenMap) ;
 }
 
@@ -203,6 +242,7 @@ cMapNode::cMapNode (const C_String & inKey,
 mInfPtr (NULL),
 mSupPtr (NULL),
 mBalance (0),
+mReferenceCount (1),
 mKey (inKey),
 mAttributes (inAttributes) {
 }
@@ -210,8 +250,8 @@ mAttributes (inAttributes) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 cMapNode::~cMapNode (void) {
-  macroMyDelete (mInfPtr) ;
-  macroMyDelete (mSupPtr) ;
+  releaseNode (mInfPtr) ;
+  releaseNode (mSupPtr) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -424,6 +464,39 @@ cMapNode * cSharedMapRoot::findEntryInMap (const C_String & inKey,
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+static cMapNode * uniqueNodeForKey (cMapNode * & ioRootPtr,
+                                    const C_String & inKey) {
+  cMapNode * result = NULL ;
+  if (NULL != ioRootPtr) {
+    makeNodeUnique (ioRootPtr) ;
+    const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
+    if (comparaison > 0) {
+      result = uniqueNodeForKey (ioRootPtr->mInfPtr, inKey) ;
+    }else if (comparaison < 0) {
+      result = uniqueNodeForKey (ioRootPtr->mSupPtr, inKey) ;
+    }else{ // Found
+      result = ioRootPtr ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapNode * cSharedMapRoot::findEntryInMapForUpdate (const C_String & inKey) {
+  cMapNode * result = NULL ;
+  cSharedMapRoot * currentMap = this ;
+  while ((NULL != currentMap) && (NULL == result)) {
+    if (NULL != findEntryInMapAtLevel (inKey, 0, currentMap)) {
+      result = uniqueNodeForKey (currentMap->mRoot, inKey) ;
+    }
+    currentMap = currentMap->mOverridenMap ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 const cMapNode * cSharedMapRoot::findNodeForKeyInMapOrInOverridenMaps (const GALGAS_string & inKey,
                                                                        C_Compiler * inCompiler
                                                                        COMMA_LOCATION_ARGS) const {
@@ -500,6 +573,8 @@ cCollectionElement * AC_GALGAS_map::readWriteAccessForWithInstructionWithErrorMe
 //---------------------------------------------------------------------------------------------------------------------*
 
 static void rotateLeft (cMapNode * & ioRootPtr) {
+  makeNodeUnique (ioRootPtr) ;
+  makeNodeUnique (ioRootPtr->mSupPtr) ;
   cMapNode * b = ioRootPtr->mSupPtr ;
   ioRootPtr->mSupPtr = b->mInfPtr ;
   b->mInfPtr = ioRootPtr;
@@ -521,6 +596,8 @@ static void rotateLeft (cMapNode * & ioRootPtr) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 static void rotateRight (cMapNode * & ioRootPtr) {
+  makeNodeUnique (ioRootPtr) ;
+  makeNodeUnique (ioRootPtr->mInfPtr) ;
   cMapNode * b = ioRootPtr->mInfPtr ;
   ioRootPtr->mInfPtr = b->mSupPtr ;
   b->mSupPtr = ioRootPtr ;
@@ -551,6 +628,7 @@ static bool internalInsertOrReplace (cMapNode * & ioRootPtr,
     anObjectHasBeenAdded = true ;
   }else{
     macroValidPointer (ioRootPtr) ;
+    makeNodeUnique (ioRootPtr) ;
     const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
     if (comparaison > 0) {
       anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mInfPtr, inKey, ioAttributeArray, ioExtension) ;
@@ -629,18 +707,15 @@ void AC_GALGAS_map::performInsertOrReplace (const capCollectionElement & inAttri
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-cMapNode::cMapNode (cMapNode * inNode) :
-mInfPtr (NULL),
-mSupPtr (NULL),
+cMapNode::cMapNode (const cMapNode * inNode) :
+mInfPtr (inNode->mInfPtr),
+mSupPtr (inNode->mSupPtr),
 mBalance (inNode->mBalance),
+mReferenceCount (1),
 mKey (inNode->mKey),
 mAttributes (inNode->mAttributes) {
-  if (inNode->mInfPtr != NULL) {
-    macroMyNew (mInfPtr, cMapNode (inNode->mInfPtr)) ;
-  }
-  if (inNode->mSupPtr != NULL) {
-    macroMyNew (mSupPtr, cMapNode (inNode->mSupPtr)) ;
-  }
+  retainNode (mInfPtr) ;
+  retainNode (mSupPtr) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -652,9 +727,8 @@ void cSharedMapRoot::copyFrom (const cSharedMapRoot * inSource) {
   #endif
   macroValidSharedObject (inSource, cSharedMapRoot) ;
   mCount = inSource->mCount ;
-  if (NULL != inSource->mRoot) {
-    macroMyNew (mRoot, cMapNode (inSource->mRoot)) ;
-  }
+  mRoot = inSource->mRoot ;
+  retainNode (mRoot) ;
   macroAssignSharedObject (mOverridenMap, inSource->mOverridenMap) ;
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkMap (HERE) ;
@@ -682,9 +756,8 @@ void cSharedMapRoot::copyCurrentAndOverridenMapsFrom (const cSharedMapRoot * inS
   #endif
   macroValidSharedObject (inSource, cSharedMapRoot) ;
   mCount = inSource->mCount ;
-  if (NULL != inSource->mRoot) {
-    macroMyNew (mRoot, cMapNode (inSource->mRoot)) ;
-  }
+  mRoot = inSource->mRoot ;
+  retainNode (mRoot) ;
   if (NULL != inSource->mOverridenMap) {
     macroMyNew (mOverridenMap, cSharedMapRoot (HERE)) ;
     mOverridenMap->copyCurrentAndOverridenMapsFrom (inSource->mOverridenMap) ;
@@ -735,6 +808,7 @@ static cMapNode * internalInsert (cMapNode * & ioRootPtr,
     matchingEntry = ioRootPtr ;
   }else{
     macroValidPointer (ioRootPtr) ;
+    makeNodeUnique (ioRootPtr) ;
     const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
     if (comparaison > 0) {
       matchingEntry = internalInsert (ioRootPtr->mInfPtr, inKey, inAttributes, outEntryAlreadyExists, ioExtension) ;
@@ -1206,7 +1280,7 @@ cMapElement * cSharedMapRoot::searchForReadWriteAttribute (const GALGAS_string &
   cMapElement * result = NULL ;
   if (inKey.isValid ()) {
     const C_String key = inKey.stringValue () ;
-    cMapNode * node = findEntryInMap (key, this) ;
+    cMapNode * node = findEntryInMapForUpdate (key) ;
     if (NULL != node) {
       node->mAttributes.insulate () ;
       result = (cMapElement *) node->mAttributes.ptr () ;
@@ -1255,7 +1329,7 @@ cMapElement * cSharedMapRoot::searchForReadWriteAttribute (const GALGAS_lstring
   cMapElement * result = NULL ;
   if (inKey.isValid ()) {
     const C_String key = inKey.mProperty_string.stringValue () ;
-    cMapNode * node = findEntryInMap (key, this) ;
+    cMapNode * node = findEntryInMapForUpdate (key) ;
     if (NULL != node) {
       node->mAttributes.insulate () ;
       result = (cMapElement *) node->mAttributes.ptr () ;
@@ -1355,6 +1429,7 @@ static void infBranchDecreased (cMapNode * & ioRoot,
 static void getPreviousElement (cMapNode * & ioRoot,
                                 cMapNode * & ioElement,
                                 bool & ioBranchHasBeenRemoved) {
+  makeNodeUnique (ioRoot) ;
   if (ioRoot->mSupPtr == NULL) {
     ioElement = ioRoot ;
     ioRoot = ioRoot->mInfPtr ;
@@ -1374,6 +1449,7 @@ static cMapNode * internalRemoveEntry (const C_String & inKeyToRemove,
                                        bool & ioBranchHasBeenRemoved) {
   cMapNode * removedNode = NULL ;
   if (ioRoot != NULL) {
+    makeNodeUnique (ioRoot) ;
     const int32_t comparaison = ioRoot->mKey.compare (inKeyToRemove) ;
     if (comparaison > 0) {
       removedNode = internalRemoveEntry (inKeyToRemove, ioRoot->mInfPtr, ioBranchHasBeenRemoved);
@@ -1449,7 +1525,7 @@ void cSharedMapRoot::performRemove (GALGAS_lstring & inKey,
       inCompiler->semanticErrorAtLocation (key_location, message, TC_Array <C_FixItDescription> () COMMA_THERE) ;
     }else{ // Ok, found
       outResult = node->mAttributes ;
-      macroMyDelete (node) ;
+      releaseNode (node) ;
       mCount -- ;
     }
   }
@@ -0,0 +1,353 @@
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//  'C_BackgroundFileWriter' : writes generated files in background threads                                            *
+//                                                                                                                     *
+//  This file is part of libpm library                                                                                 *
+//                                                                                                                     *
+//  Copyright (C) 2026 Pierre Molinaro.                                                                                *
+//                                                                                                                     *
+//  e-mail : pierre.molinaro@irccyn.ec-nantes.fr                                                                       *
+//                                                                                                                     *
+//  IRCCyN, Institut de Recherche en Communications et Cybernétique de Nantes, ECN, École Centrale de Nantes (France)  *
+//                                                                                                                     *
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General  *
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)  *
+//  any later version.                                                                                                 *
+//                                                                                                                     *
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied      *
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for            *
+//  more details.                                                                                                      *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#include "galgas2/C_BackgroundFileWriter.h"
+#include "galgas2/C_Compiler.h"
+#include "files/C_FileManager.h"
+#include "strings/C_String.h"
+#include "strings/unicode_character_base.h"
+#include "utilities/C_PrologueEpilogue.h"
+#include "utilities/MF_MemoryControl.h"
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if COMPILE_FOR_WINDOWS == 0
+  #include <pthread.h>
+  #include <unistd.h>
+  #include <sys/stat.h>
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Synchronous write                                                                                                 *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool writeSynchronously (const C_String & inString,
+                                const C_String & inFilePath,
+                                const bool inExecutable) {
+  return inExecutable
+    ? C_FileManager::writeStringToExecutableFile (inString, inFilePath)
+    : C_FileManager::writeStringToFile (inString, inFilePath) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 1
+  bool C_BackgroundFileWriter::writeStringToFile (const C_String & inString,
+                                                  const C_String & inFilePath,
+                                                  const bool inExecutable,
+                                                  C_Compiler * /* inCompiler */) {
+    return writeSynchronously (inString, inFilePath, inExecutable) ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 1
+  void C_BackgroundFileWriter::waitForAllPendingWrites (void) {
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Pending write                                                                                                     *
+//   Worker threads only read mNativePath, mContents, mLength, mExecutable, and set mDone, mSuccess (under gMutex)     *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  class cPendingWrite {
+    public : char * mNativePath ; // Allocated by malloc
+    public : char * mContents ; // UTF-8, allocated by malloc
+    public : size_t mLength ;
+    public : const bool mExecutable ;
+    public : bool mDone ;
+    public : bool mSuccess ;
+    public : C_Compiler * mCompiler ; // Retained
+    public : const C_String mFilePath ;
+    public : cPendingWrite * mNextPendingWrite ;
+
+    public : cPendingWrite (const C_String & inString,
+                            const C_String & inFilePath,
+                            const bool inExecutable,
+                            C_Compiler * inCompiler) ;
+
+    public : ~ cPendingWrite (void) ;
+
+  //--- No copy
+    private : cPendingWrite (const cPendingWrite &) ;
+    private : cPendingWrite & operator = (const cPendingWrite &) ;
+  } ;
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  cPendingWrite::cPendingWrite (const C_String & inString,
+                                const C_String & inFilePath,
+                                const bool inExecutable,
+                                C_Compiler * inCompiler) :
+  mNativePath (NULL),
+  mContents (NULL),
+  mLength (0),
+  mExecutable (inExecutable),
+  mDone (false),
+  mSuccess (false),
+  mCompiler (NULL),
+  mFilePath (inFilePath),
+  mNextPendingWrite (NULL) {
+    macroAssignSharedObject (mCompiler, inCompiler) ;
+  //--- Native path
+    const C_String nativePath = C_FileManager::nativePathWithUnixPath (inFilePath) ;
+    const char * path = nativePath.cString (HERE) ;
+    mNativePath = (char *) ::malloc (::strlen (path) + 1) ;
+    ::strcpy (mNativePath, path) ;
+  //--- Contents, an UTF-8 sequence is at most 4 bytes long
+    const int32_t length = inString.length () ;
+    const utf32 * s = inString.utf32String (HERE) ;
+    mContents = (char *) ::malloc (4 * (size_t) length + 1) ;
+    for (int32_t i=0 ; i<length ; i++) {
+      if (UNICODE_VALUE (s [i]) < 0x80) { // ASCII
+        mContents [mLength] = (char) UNICODE_VALUE (s [i]) ;
+        mLength ++ ;
+      }else{
+        char sequence [5] ;
+        const int32_t n = UTF8StringFromUTF32Character (s [i], sequence) ;
+        ::memcpy (& mContents [mLength], sequence, (size_t) n) ;
+        mLength += (size_t) n ;
+      }
+    }
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  cPendingWrite::~ cPendingWrite (void) {
+    ::free (mNativePath) ;
+    ::free (mContents) ;
+    macroDetachSharedObject (mCompiler) ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Queue and worker threads                                                                                          *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static const int32_t kMaximumWorkerThreadCount = 4 ;
+
+  static pthread_mutex_t gMutex = PTHREAD_MUTEX_INITIALIZER ;
+  static pthread_cond_t gWorkAvailableCondition = PTHREAD_COND_INITIALIZER ;
+  static pthread_cond_t gWriteDoneCondition = PTHREAD_COND_INITIALIZER ;
+
+  static pthread_t gWorkerThreads [kMaximumWorkerThreadCount] ;
+  static int32_t gWorkerThreadCount = 0 ;
+  static bool gWorkerThreadsStarted = false ;
+  static bool gStopWorkerThreads = false ;
+
+//--- Pending writes, in enqueue order; gFirstPendingWrite ... gNextWriteToPerform are performed or being performed
+  static cPendingWrite * gFirstPendingWrite = NULL ;
+  static cPendingWrite * gLastPendingWrite = NULL ;
+  static cPendingWrite * gNextWriteToPerform = NULL ;
+  static int32_t gPendingWriteCount = 0 ;
+
+  static bool gSignalingFailures = false ;
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool performWrite (const cPendingWrite * inWrite) {
+    FILE * f = ::fopen (inWrite->mNativePath, "wt") ;
+    bool ok = f != NULL ;
+    if (ok) {
+      ok = ::fwrite (inWrite->mContents, 1, inWrite->mLength, f) == inWrite->mLength ;
+      ok = (::fclose (f) == 0) && ok ;
+    }
+    if (ok && inWrite->mExecutable) {
+      struct stat fileStat ;
+      ::stat (inWrite->mNativePath, & fileStat) ;
+      ::chmod (inWrite->mNativePath, fileStat.st_mode | S_IXUSR | S_IXGRP | S_IXOTH) ;
+    }
+    return ok ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void * workerThread (void * /* inArgument */) {
+    pthread_mutex_lock (& gMutex) ;
+    bool loop = true ;
+    while (loop) {
+      while ((NULL == gNextWriteToPerform) && ! gStopWorkerThreads) {
+        pthread_cond_wait (& gWorkAvailableCondition, & gMutex) ;
+      }
+      cPendingWrite * write = gNextWriteToPerform ;
+      loop = NULL != write ;
+      if (loop) {
+        gNextWriteToPerform = write->mNextPendingWrite ;
+        pthread_mutex_unlock (& gMutex) ;
+        const bool ok = performWrite (write) ;
+        pthread_mutex_lock (& gMutex) ;
+        write->mSuccess = ok ;
+        write->mDone = true ;
+        pthread_cond_broadcast (& gWriteDoneCondition) ;
+      }
+    }
+    pthread_mutex_unlock (& gMutex) ;
+    return NULL ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void startWorkerThreads (void) {
+    gWorkerThreadsStarted = true ;
+    int32_t threadCount = (int32_t) ::sysconf (_SC_NPROCESSORS_ONLN) ;
+    if (threadCount > kMaximumWorkerThreadCount) {
+      threadCount = kMaximumWorkerThreadCount ;
+    }
+    for (int32_t i=0 ; i<threadCount ; i++) {
+      if (pthread_create (& gWorkerThreads [gWorkerThreadCount], NULL, workerThread, NULL) == 0) {
+        gWorkerThreadCount ++ ;
+      }
+    }
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+// Waits for the oldest pending writes until inRemainingCount are pending, removes them from the queue and signals the
+// failed ones. A nested call (while a failure is signaled) does nothing.
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void waitForOldestPendingWrites (const int32_t inRemainingCount) {
+    if (! gSignalingFailures) {
+      gSignalingFailures = true ;
+      try{
+        while (gPendingWriteCount > inRemainingCount) {
+          pthread_mutex_lock (& gMutex) ;
+          cPendingWrite * write = gFirstPendingWrite ;
+          while (! write->mDone) {
+            pthread_cond_wait (& gWriteDoneCondition, & gMutex) ;
+          }
+          gFirstPendingWrite = write->mNextPendingWrite ;
+          if (NULL == gFirstPendingWrite) {
+            gLastPendingWrite = NULL ;
+          }
+          gPendingWriteCount -- ;
+          pthread_mutex_unlock (& gMutex) ;
+          if (! write->mSuccess) {
+            C_String message ;
+            message << "cannot write '" << write->mFilePath << "' file" ;
+            write->mCompiler->onTheFlyRunTimeError (message COMMA_HERE) ;
+          }
+          macroMyDelete (write) ;
+        }
+      }catch (...) {
+        gSignalingFailures = false ;
+        throw ;
+      }
+      gSignalingFailures = false ;
+    }
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  bool C_BackgroundFileWriter::writeStringToFile (const C_String & inString,
+                                                  const C_String & inFilePath,
+                                                  const bool inExecutable,
+                                                  C_Compiler * inCompiler) {
+    if (! gWorkerThreadsStarted) {
+      startWorkerThreads () ;
+    }
+    bool ok = true ;
+    if (gWorkerThreadCount == 0) {
+      ok = writeSynchronously (inString, inFilePath, inExecutable) ;
+    }else{
+      waitForOldestPendingWrites (kMaximumPendingWriteCount - 1) ;
+      cPendingWrite * write = NULL ;
+      macroMyNew (write, cPendingWrite (inString, inFilePath, inExecutable, inCompiler)) ;
+      pthread_mutex_lock (& gMutex) ;
+      if (NULL == gLastPendingWrite) {
+        gFirstPendingWrite = write ;
+      }else{
+        gLastPendingWrite->mNextPendingWrite = write ;
+      }
+      gLastPendingWrite = write ;
+      if (NULL == gNextWriteToPerform) {
+        gNextWriteToPerform = write ;
+      }
+      gPendingWriteCount ++ ;
+      pthread_cond_signal (& gWorkAvailableCondition) ;
+      pthread_mutex_unlock (& gMutex) ;
+    }
+    return ok ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  void C_BackgroundFileWriter::waitForAllPendingWrites (void) {
+    waitForOldestPendingWrites (0) ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//   Epilogue: wait for pending writes, stop worker threads                                                            *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void backgroundFileWriterEpilogue (void) {
+    C_BackgroundFileWriter::waitForAllPendingWrites () ;
+    pthread_mutex_lock (& gMutex) ;
+    gStopWorkerThreads = true ;
+    pthread_cond_broadcast (& gWorkAvailableCondition) ;
+    pthread_mutex_unlock (& gMutex) ;
+    for (int32_t i=0 ; i<gWorkerThreadCount ; i++) {
+      pthread_join (gWorkerThreads [i], NULL) ;
+    }
+    gWorkerThreadCount = 0 ;
+  }
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  C_PrologueEpilogue gBackgroundFileWriterEpilogue (NULL, backgroundFileWriterEpilogue) ;
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
@@ -0,0 +1,67 @@
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//  'C_BackgroundFileWriter' : writes generated files in background threads                                            *
+//                                                                                                                     *
+//  This file is part of libpm library                                                                                 *
+//                                                                                                                     *
+//  Copyright (C) 2026 Pierre Molinaro.                                                                                *
+//                                                                                                                     *
+//  e-mail : pierre.molinaro@irccyn.ec-nantes.fr                                                                       *
+//                                                                                                                     *
+//  IRCCyN, Institut de Recherche en Communications et Cybernétique de Nantes, ECN, École Centrale de Nantes (France)  *
+//                                                                                                                     *
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General  *
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)  *
+//  any later version.                                                                                                 *
+//                                                                                                                     *
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied      *
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for            *
+//  more details.                                                                                                      *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+#ifndef GALGAS_BACKGROUND_FILE_WRITER_CLASS_DEFINED
+#define GALGAS_BACKGROUND_FILE_WRITER_CLASS_DEFINED
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#include "utilities/M_machine.h"
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class C_String ;
+class C_Compiler ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//  The contents are UTF-8 encoded by the caller thread, the worker threads only perform the fopen / fwrite / fclose   *
+//  (and chmod) system calls. A write failure is signaled on the compiler that has enqueued the write, in enqueue      *
+//  order, when the write is waited for:                                                                               *
+//    - when more than kMaximumPendingWriteCount writes are pending, the oldest one is waited for;                     *
+//    - 'waitForAllPendingWrites' waits for all of them (it is called by 'totalErrorCount' and by the epilogue).       *
+//  So the points where a failure is signaled do not depend on thread scheduling.                                      *
+//  On Windows, or if no thread can be created, the file is written synchronously.                                     *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class C_BackgroundFileWriter {
+//--- Enqueue a write; the directory of inFilePath should exist. Returns false if the write has been performed
+//    synchronously and has failed (the caller signals the error)
+  public : static bool writeStringToFile (const C_String & inString,
+                                          const C_String & inFilePath,
+                                          const bool inExecutable,
+                                          C_Compiler * inCompiler) ;
+
+//--- Wait for all pending writes, signaling the failed ones
+  public : static void waitForAllPendingWrites (void) ;
+
+//--- Number of pending writes that are waited for before a new one is enqueued
+  public : static const int32_t kMaximumPendingWriteCount = 16 ;
+
+//--- No instance
+  private : C_BackgroundFileWriter (void) ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#endif
@@ -31,6 +31,7 @@
 #include "galgas2/cIndexingDictionary.h"
 #include "files/C_FileManager.h"
 #include "galgas2/F_verbose_output.h"
+#include "utilities/C_PrologueEpilogue.h"
 
 //---------------------------------------------------------------------------------------------------------------------*
 
@@ -465,6 +466,78 @@ int16_t C_Lexique::searchInList (const C_String & inString,
   return code ;
 }
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//    Interned strings (open addressing hash table, linear probing, at most half full)                                 *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static C_String * gInternedStrings = NULL ;
+static uint32_t gInternedStringTableSize = 0 ; // Power of 2
+static uint32_t gInternedStringCount = 0 ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void enterInternedString (C_String * ioTable,
+                                 const uint32_t inTableSize,
+                                 const C_String & inString) {
+  uint32_t idx = inString.hash () & (inTableSize - 1) ;
+  while (ioTable [idx].length () > 0) {
+    idx = (idx + 1) & (inTableSize - 1) ;
+  }
+  ioTable [idx] = inString ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_String C_Lexique::internedString (const C_String & inString) {
+  C_String result = inString ;
+  if (inString.length () > 0) {
+  //--- Grow table ?
+    if ((2 * (gInternedStringCount + 1)) > gInternedStringTableSize) {
+      const uint32_t newSize = (gInternedStringTableSize == 0) ? 1024 : (2 * gInternedStringTableSize) ;
+      C_String * newTable = NULL ;
+      macroMyNewArray (newTable, C_String, newSize) ;
+      for (uint32_t i=0 ; i<gInternedStringTableSize ; i++) {
+        if (gInternedStrings [i].length () > 0) {
+          enterInternedString (newTable, newSize, gInternedStrings [i]) ;
+        }
+      }
+      macroMyDeleteArray (gInternedStrings) ;
+      gInternedStrings = newTable ;
+      gInternedStringTableSize = newSize ;
+    }
+  //--- Search
+    uint32_t idx = inString.hash () & (gInternedStringTableSize - 1) ;
+    bool found = false ;
+    while (! found && (gInternedStrings [idx].length () > 0)) {
+      found = gInternedStrings [idx] == inString ;
+      if (found) {
+        result = gInternedStrings [idx] ;
+      }else{
+        idx = (idx + 1) & (gInternedStringTableSize - 1) ;
+      }
+    }
+    if (! found) {
+      gInternedStrings [idx] = inString ;
+      gInternedStringCount ++ ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void C_Lexique::releaseInternedStrings (void) {
+  macroMyDeleteArray (gInternedStrings) ;
+  gInternedStringTableSize = 0 ;
+  gInternedStringCount = 0 ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gReleaseInternedStrings (NULL, C_Lexique::releaseInternedStrings) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 
 #ifdef PRAGMA_MARK_ALLOWED
@@ -154,6 +154,12 @@ class C_Lexique : public C_Compiler {
 //--- Get Token String
   public : virtual C_String getCurrentTokenString (const cToken * inTokenPtr) const = 0 ;
 
+//--- Interned strings: the generated scanners intern identifiers in 'enterToken', so equal identifiers share the
+//    same storage, and comparing them (C_String::compare) only compares the storage pointers
+  protected : static C_String internedString (const C_String & inString) ;
+
+  public : static void releaseInternedStrings (void) ;
+
 //--- Lexical analysis methods
   public : void performLexicalAnalysis (void) ;
 
@@ -30,6 +30,7 @@
 #include "galgas2/F_verbose_output.h"
 #include "galgas2/cIssueDescriptor.h"
 #include "galgas2/C_Compiler.h"
+#include "galgas2/C_BackgroundFileWriter.h"
 
 //---------------------------------------------------------------------------------------------------------------------*
 
@@ -103,6 +104,13 @@ int32_t maxErrorCount (void) {
 static int32_t mErrorTotalCount ;
 
 int32_t totalErrorCount (void) {
+  C_BackgroundFileWriter::waitForAllPendingWrites () ;
+  return mErrorTotalCount ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+int32_t signaledErrorCount (void) {
   return mErrorTotalCount ;
 }
 
@@ -232,7 +240,7 @@ void signalLexicalError (C_Compiler * inCompiler,
 //--- Print
   ggs_printError (inCompiler, inSourceText, inIssue, errorMessage COMMA_THERE) ;
 //--- Error max count reached ?
-  if ((maxErrorCount () > 0) && (totalErrorCount () >= maxErrorCount ())) {
+  if ((maxErrorCount () > 0) && (signaledErrorCount () >= maxErrorCount ())) {
     throw max_error_count_reached_exception () ;
   }
 }
@@ -262,7 +270,7 @@ void signalParsingError (C_Compiler * inCompiler,
 //--- Print
   ggs_printError (inCompiler, inSourceText, inIssue, errorMessage COMMA_THERE) ;
 //--- Error max count reached ?
-  if ((maxErrorCount () > 0) && (totalErrorCount () >= maxErrorCount ())) {
+  if ((maxErrorCount () > 0) && (signaledErrorCount () >= maxErrorCount ())) {
     throw max_error_count_reached_exception () ;
   }
 }
@@ -313,7 +321,7 @@ void signalExtractError (C_Compiler * inCompiler,
 //--- Print
   ggs_printError (inCompiler, inSourceText, inIssue, errorMessage COMMA_THERE) ;
 //--- Error max count reached ?
-  if ((maxErrorCount () > 0) && (totalErrorCount () >= maxErrorCount ())) {
+  if ((maxErrorCount () > 0) && (signaledErrorCount () >= maxErrorCount ())) {
     throw max_error_count_reached_exception () ;
   }
 }
@@ -396,7 +404,7 @@ void signalCastError (C_Compiler * inCompiler,
 //--- Print
   ggs_printError (inCompiler, inSourceText, inIssue, errorMessage COMMA_THERE) ;
 //--- Error max count reached ?
-  if ((maxErrorCount () > 0) && (totalErrorCount () >= maxErrorCount ())) {
+  if ((maxErrorCount () > 0) && (signaledErrorCount () >= maxErrorCount ())) {
     throw max_error_count_reached_exception () ;
   }
 }
@@ -440,7 +448,7 @@ void signalSemanticError (C_Compiler * inCompiler,
 //--- Print
   ggs_printError (inCompiler, inSourceText, inIssue, errorMessage COMMA_THERE) ;
 //--- Error max count reached ?
-  if ((maxErrorCount () > 0) && (totalErrorCount () >= maxErrorCount ())) {
+  if ((maxErrorCount () > 0) && (signaledErrorCount () >= maxErrorCount ())) {
     throw max_error_count_reached_exception () ;
   }
 }
@@ -458,7 +466,7 @@ void signalRunTimeError (C_Compiler * inCompiler,
 //--- Print
   ggs_printError (inCompiler, C_SourceTextInString (), C_IssueWithFixIt (), errorMessage COMMA_THERE) ;
 //--- Error max count reached ?
-  if ((maxErrorCount () > 0) && (totalErrorCount () >= maxErrorCount ())) {
+  if ((maxErrorCount () > 0) && (signaledErrorCount () >= maxErrorCount ())) {
     throw max_error_count_reached_exception () ;
   }
 }
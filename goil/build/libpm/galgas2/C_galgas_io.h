@@ -144,7 +144,9 @@ class C_parsingContext {
 //--- Errors count
 int32_t maxErrorCount (void) ;
 
-int32_t totalErrorCount (void) ;
+int32_t totalErrorCount (void) ; // Waits for the files written in background
+
+int32_t signaledErrorCount (void) ; // Does not wait for the files written in background
 
 //--- Warnings count
 int32_t maxWarningCount (void) ;
@@ -30,6 +30,7 @@
 #include "files/C_FileManager.h"
 #include "files/C_BinaryFileWrite.h"
 #include "galgas2/F_verbose_output.h"
+#include "galgas2/C_BackgroundFileWriter.h"
 
 //---------------------------------------------------------------------------------------------------------------------*
 
@@ -1737,7 +1738,7 @@ void GALGAS_string::method_writeToFileWhenDifferentContents (GALGAS_string inFil
           inCompiler->onTheFlyRunTimeError (message COMMA_THERE) ;
           outFileWritten.drop () ;
         }else{
-          ok = C_FileManager::writeStringToFile (mString, inFilePath.mString) ;
+          ok = C_BackgroundFileWriter::writeStringToFile (mString, inFilePath.mString, false, inCompiler) ;
           if (ok && verboseOptionOn && fileAlreadyExists) {
             ggs_printFileOperationSuccess (C_String ("Replaced '") + inFilePath.mString + "'.\n") ;
           }else if (ok && verboseOptionOn && ! fileAlreadyExists) {
@@ -1807,7 +1808,7 @@ void GALGAS_string::method_writeToExecutableFileWhenDifferentContents (GALGAS_st
           inCompiler->onTheFlyRunTimeError (message COMMA_THERE) ;
           outFileWritten.drop () ;
         }else{
-          ok = C_FileManager::writeStringToExecutableFile (mString, inFilePath.mString) ;
+          ok = C_BackgroundFileWriter::writeStringToFile (mString, inFilePath.mString, true, inCompiler) ;
           if (ok && verboseOptionOn && fileAlreadyExists) {
             ggs_printFileOperationSuccess (C_String ("Replaced '") + inFilePath.mString + "'.\n") ;
           }else if (ok && verboseOptionOn && ! fileAlreadyExists) {
@@ -99,3 +99,21 @@ GALGAS_string GALGAS_timer::getter_string (UNUSED_LOCATION_ARGS) const {
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult GALGAS_timer::objectCompare (const GALGAS_timer & inOperand) const {
+  typeComparisonResult result = kOperandNotValid ;
+  if (isValid () && inOperand.isValid ()) {
+    const uint32_t msFromStart = mTimer.msFromStart () ;
+    const uint32_t operandMsFromStart = inOperand.mTimer.msFromStart () ;
+    if (msFromStart < operandMsFromStart) {
+      result = kFirstOperandLowerThanSecond ;
+    }else if (msFromStart > operandMsFromStart) {
+      result = kFirstOperandGreaterThanSecond ;
+    }else{
+      result = kOperandEqual ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
@@ -61,7 +61,7 @@ GALGAS_uint GALGAS_uint::constructor_max (UNUSED_LOCATION_ARGS) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 GALGAS_uint GALGAS_uint::constructor_errorCount (UNUSED_LOCATION_ARGS) {
-  return GALGAS_uint ((uint32_t) totalErrorCount ()) ;
+  return GALGAS_uint ((uint32_t) signaledErrorCount ()) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
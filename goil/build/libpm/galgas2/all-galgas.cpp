@@ -8,6 +8,7 @@
 #include "C_galgas_type_descriptor.cpp"
 #include "C_galgas_function_descriptor.cpp"
 #include "C_galgas_io.cpp"
+#include "C_BackgroundFileWriter.cpp"
 #include "C_galgas_class_inspector.cpp"
 #include "C_IssueWithFixIt.cpp"
 #include "cObjectArray.cpp"
@@ -18,6 +18,7 @@ def buildForUnix (dictionary, jsonFilePath, EXECUTABLE, GOAL, maxParallelJobs, d
   gmf.mMaxParallelJobs = maxParallelJobs
   gmf.mDisplayCommands = displayCommands
   gmf.mTargetName = "unix"
+  gmf.mLinkerOptions = ["-lpthread"]
 #---
   gmf.mCompilerTool = ["gcc"]
   gmf.mLinkerTool   = ["g++"]
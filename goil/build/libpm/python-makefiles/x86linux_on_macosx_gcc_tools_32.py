@@ -29,6 +29,7 @@ def buildForLinux32OnMacOSX (dictionary, jsonFilePath, EXECUTABLE, GOAL, maxPara
   gmf.mMaxParallelJobs = maxParallelJobs
   gmf.mDisplayCommands = displayCommands
   gmf.mTargetName = "x86linux32"
+  gmf.mLinkerOptions = ["-lpthread"]
 #---
   UNIX_TOOL_PREFIX = TOOL_CHAIN_INSTALL_PATH + "/bin/i586-pc-linux"
   gmf.mCompilerTool = [UNIX_TOOL_PREFIX + "-gcc"]
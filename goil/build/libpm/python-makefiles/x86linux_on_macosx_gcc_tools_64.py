@@ -29,6 +29,7 @@ def buildForLinux64OnMacOSX (dictionary, jsonFilePath, EXECUTABLE, GOAL, maxPara
   gmf.mMaxParallelJobs = maxParallelJobs
   gmf.mDisplayCommands = displayCommands
   gmf.mTargetName = "x86linux64"
+  gmf.mLinkerOptions = ["-lpthread"]
 #---
   UNIX_TOOL_PREFIX = TOOL_CHAIN_INSTALL_PATH + "/bin/x86_64-pc-linux"
   gmf.mCompilerTool = [UNIX_TOOL_PREFIX + "-gcc"]
@@ -399,26 +399,34 @@ const char * C_String::cString (UNUSED_LOCATION_ARGS) const {
   if (NULL != mEmbeddedString) {
     macroValidSharedObject (mEmbeddedString, cEmbeddedString) ;
     if (NULL == mEmbeddedString->mEncodedCString) {
-      uint32_t allocatedSize = mEmbeddedString->mLength + 1 ;
-      macroMyReallocPODArray (mEmbeddedString->mEncodedCString, char, allocatedSize) ;
+    //--- Compute the UTF-8 length, so that the encoded string is allocated once
+      uint32_t encodedLength = 0 ;
+      for (uint32_t i=0 ; i<mEmbeddedString->mLength ; i++) {
+        if (UNICODE_VALUE (mEmbeddedString->mString [i]) < 0x80) { // ASCII
+          encodedLength ++ ;
+        }else{
+          char buffer [5] ;
+          encodedLength += (uint32_t) UTF8StringFromUTF32Character (mEmbeddedString->mString [i], buffer) ;
+        }
+      }
+    //--- Encode
+      macroMyNewPODArray (mEmbeddedString->mEncodedCString, char, encodedLength + 1) ;
       uint32_t idx = 0 ;
       for (uint32_t i=0 ; i<mEmbeddedString->mLength ; i++) {
-        char buffer [5] ;
-        const int32_t n = UTF8StringFromUTF32Character (mEmbeddedString->mString [i], buffer) ;
-        for (int32_t j=0 ; j<n ; j++) {
-          if (allocatedSize == idx) {
-            allocatedSize *= 2 ;
-            macroMyReallocPODArray (mEmbeddedString->mEncodedCString, char, allocatedSize) ;
-          }
-          mEmbeddedString->mEncodedCString [idx] = buffer [j] ;
+        const uint32_t c = UNICODE_VALUE (mEmbeddedString->mString [i]) ;
+        if (c < 0x80) { // ASCII
+          mEmbeddedString->mEncodedCString [idx] = (char) c ;
           idx ++ ;
+        }else{
+          char buffer [5] ;
+          const int32_t n = UTF8StringFromUTF32Character (mEmbeddedString->mString [i], buffer) ;
+          for (int32_t j=0 ; j<n ; j++) {
+            mEmbeddedString->mEncodedCString [idx] = buffer [j] ;
+            idx ++ ;
+          }
         }
       }
-    //---
-      if (allocatedSize == idx) {
-        allocatedSize *= 2 ;
-        macroMyReallocPODArray (mEmbeddedString->mEncodedCString, char, allocatedSize) ;
-      }
+      MF_Assert (idx == encodedLength, "idx (%lld) != encodedLength (%lld)", idx, encodedLength) ;
       mEmbeddedString->mEncodedCString [idx] = '\0' ;
     }
     result = mEmbeddedString->mEncodedCString ;
@@ -591,9 +599,9 @@ void C_String::performActualCharArrayOutput (const char * inCharArray,
         mEmbeddedString->mString [newLength] = unicodeChar ;
         newLength ++ ;
       }
-      mEmbeddedString->mLength = (uint32_t) newLength ;
-      mEmbeddedString->mString [newLength] = TO_UNICODE ('\0') ;
     }
+    mEmbeddedString->mLength = (uint32_t) newLength ;
+    mEmbeddedString->mString [newLength] = TO_UNICODE ('\0') ;
     #ifndef DO_NOT_GENERATE_CHECKINGS
       checkString (HERE) ;
     #endif
@@ -1539,7 +1547,9 @@ int32_t C_String::compare (const C_String & inString) const {
   int32_t result = 0 ;
   const utf32 * myStringPtr = utf32String (HERE) ;
   const utf32 * otherStringPtr = inString.utf32String (HERE) ;
-  if (myStringPtr == NULL) {
+  if (myStringPtr == otherStringPtr) { // Same shared storage, as for map keys copied from the searched key
+    result = 0 ;
+  }else if (myStringPtr == NULL) {
     result = 1 ;
   }else if (otherStringPtr == NULL) {
     result = -1 ;
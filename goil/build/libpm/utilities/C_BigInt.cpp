@@ -25,6 +25,115 @@
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Small value helpers
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void setGMPFromUInt64 (mpz_ptr ioValue, const uint64_t inValue, const bool inNegate) {
+  const uint64_t high = inValue >> 32 ;
+  if (high == 0) {
+    mpz_set_ui (ioValue, (uint32_t) inValue) ;
+  }else{
+    mpz_set_ui (ioValue, (uint32_t) high) ;
+    mpz_mul_2exp (ioValue, ioValue, 32) ;
+    mpz_add_ui (ioValue, ioValue, (uint32_t) (inValue & UINT32_MAX)) ;
+  }
+  if (inNegate) {
+    mpz_neg (ioValue, ioValue) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static uint64_t magnitude (const int64_t inValue) {
+  return (inValue < 0) ? (((uint64_t) 0) - (uint64_t) inValue) : (uint64_t) inValue ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool gmpFitsInSInt64 (mpz_srcptr inValue) {
+  const size_t requiredBitCount = mpz_sizeinbase (inValue, 2) ;
+  bool ok = requiredBitCount <= 63 ;
+  if ((requiredBitCount == 64) && (mpz_sgn (inValue) < 0)) { // INT64_MIN is a particular case
+    uint64_t r = 0 ;
+    mpz_export (& r, NULL, 1, sizeof (uint64_t), 0, 0, inValue) ;
+    ok = r == (uint64_t) INT64_MIN ;
+  }
+  return ok ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+// inValue should fit in an int64_t
+
+static int64_t gmpToInt64 (mpz_srcptr inValue) {
+  uint64_t r = 0 ;
+  mpz_export (& r, NULL, 1, sizeof (uint64_t), 0, 0, inValue) ;
+  if (mpz_sgn (inValue) < 0) {
+    r = ((uint64_t) 0) - r ;
+  }
+  return (int64_t) r ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool addOverflows (const int64_t inLeft, const int64_t inRight) {
+  return (inRight > 0) ? (inLeft > (INT64_MAX - inRight)) : (inLeft < (INT64_MIN - inRight)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool subtractOverflows (const int64_t inLeft, const int64_t inRight) {
+  return (inRight < 0) ? (inLeft > (INT64_MAX + inRight)) : (inLeft < (INT64_MIN + inRight)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool fitsInInt32Range (const int64_t inValue) {
+  return (inValue >= INT32_MIN) && (inValue <= INT32_MAX) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool smallDivisionIsDefined (const int64_t inDividend, const int64_t inDivisor) {
+  return (inDivisor != 0) && ((inDividend != INT64_MIN) || (inDivisor != -1)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+//  GMP representation
+//---------------------------------------------------------------------------------------------------------------------*
+
+mpz_srcptr C_BigInt::gmpValue (void) const {
+  if (! mGMPIsInitialized) {
+    mpz_init (mGMPint) ;
+    mGMPIsInitialized = true ;
+  }
+  if (mIsSmall) {
+    setGMPFromUInt64 (mGMPint, magnitude (mSmallValue), mSmallValue < 0) ;
+  }
+  return mGMPint ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+mpz_ptr C_BigInt::gmpValueForUpdate (void) {
+  gmpValue () ;
+  mIsSmall = false ;
+  return mGMPint ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void C_BigInt::normalize (void) {
+  if (! mIsSmall && gmpFitsInSInt64 (mGMPint)) {
+    mSmallValue = gmpToInt64 (mGMPint) ;
+    mIsSmall = true ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Default constructor, destructor, copy
 #endif
@@ -34,8 +143,10 @@
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt::C_BigInt (void) :
+mSmallValue (0),
+mIsSmall (true),
+mGMPIsInitialized (false),
 mGMPint () {
-  mpz_init (mGMPint) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -43,7 +154,9 @@ mGMPint () {
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt::~C_BigInt (void) {
-  mpz_clear (mGMPint) ;
+  if (mGMPIsInitialized) {
+    mpz_clear (mGMPint) ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -51,16 +164,27 @@ C_BigInt::~C_BigInt (void) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt::C_BigInt (const C_BigInt & inOperand) :
+mSmallValue (inOperand.mSmallValue),
+mIsSmall (inOperand.mIsSmall),
+mGMPIsInitialized (false),
 mGMPint () {
-  mpz_init (mGMPint) ;
-  mpz_set (mGMPint, inOperand.mGMPint) ;
+  if (! mIsSmall) {
+    mpz_init (mGMPint) ;
+    mGMPIsInitialized = true ;
+    mpz_set (mGMPint, inOperand.mGMPint) ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt & C_BigInt::operator = (const C_BigInt & inOperand) {
   if (this != & inOperand) {
-    mpz_set (mGMPint, inOperand.mGMPint) ;
+    if (inOperand.mIsSmall) {
+      mSmallValue = inOperand.mSmallValue ;
+      mIsSmall = true ;
+    }else{
+      mpz_set (gmpValueForUpdate (), inOperand.mGMPint) ;
+    }
   }
   return *this ;
 }
@@ -76,25 +200,31 @@ C_BigInt & C_BigInt::operator = (const C_BigInt & inOperand) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 bool C_BigInt::isZero (void) const {
-  return mpz_cmp_ui (mGMPint, 0) == 0 ;
+  return mIsSmall ? (mSmallValue == 0) : (mpz_cmp_ui (mGMPint, 0) == 0) ;
 }
-  
+
 //---------------------------------------------------------------------------------------------------------------------*
 
 bool C_BigInt::isOne (void) const {
-  return mpz_cmp_ui (mGMPint, 1) == 0 ;
+  return mIsSmall ? (mSmallValue == 1) : (mpz_cmp_ui (mGMPint, 1) == 0) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 bool C_BigInt::isMinusOne (void) const {
-  return mpz_cmp_si (mGMPint, -1) == 0 ;
+  return mIsSmall ? (mSmallValue == -1) : (mpz_cmp_si (mGMPint, -1) == 0) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 int32_t C_BigInt::sign (void) const {
-  return mpz_sgn (mGMPint) ;
+  int32_t result ;
+  if (mIsSmall) {
+    result = (mSmallValue > 0) ? 1 : ((mSmallValue < 0) ? -1 : 0) ;
+  }else{
+    result = mpz_sgn (mGMPint) ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -108,86 +238,85 @@ int32_t C_BigInt::sign (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt::C_BigInt (const uint64_t inValue, const bool inNegate) :
+mSmallValue (0),
+mIsSmall (true),
+mGMPIsInitialized (false),
 mGMPint () {
-  mpz_init (mGMPint) ;
-  const uint64_t high = inValue >> 32 ;
-  if (high == 0) {
-    mpz_set_ui (mGMPint, (uint32_t) inValue) ;
+  if (inValue <= (uint64_t) INT64_MAX) {
+    mSmallValue = inNegate ? (- (int64_t) inValue) : (int64_t) inValue ;
   }else{
-    mpz_set_ui (mGMPint, (uint32_t) high) ;
-    mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-    mpz_add_ui (mGMPint, mGMPint, (uint32_t) (inValue & UINT32_MAX)) ;
-  }
-  if (inNegate) {
-    mpz_neg (mGMPint, mGMPint) ;
+    setGMPFromUInt64 (gmpValueForUpdate (), inValue, inNegate) ;
+    normalize () ; // INT64_MIN
   }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt::C_BigInt (const uint64_t inHighValue, const uint64_t inLowValue, const bool inNegate) :
+mSmallValue (0),
+mIsSmall (true),
+mGMPIsInitialized (false),
 mGMPint () {
-  mpz_init (mGMPint) ;
-  mpz_set_ui (mGMPint, 0) ;
-  if (inHighValue != 0) {
-    const uint64_t high = inHighValue >> 32 ;
-    if (high == 0) {
-      mpz_set_ui (mGMPint, (uint32_t) inHighValue) ;
-    }else{
-      mpz_set_ui (mGMPint, (uint32_t) high) ;
-      mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-      mpz_add_ui (mGMPint, mGMPint, (uint32_t) (inHighValue & UINT32_MAX)) ;
+  if ((inHighValue == 0) && (inLowValue <= (uint64_t) INT64_MAX)) {
+    mSmallValue = inNegate ? (- (int64_t) inLowValue) : (int64_t) inLowValue ;
+  }else{
+    mpz_ptr value = gmpValueForUpdate () ;
+    mpz_set_ui (value, 0) ;
+    if (inHighValue != 0) {
+      const uint64_t high = inHighValue >> 32 ;
+      if (high == 0) {
+        mpz_set_ui (value, (uint32_t) inHighValue) ;
+      }else{
+        mpz_set_ui (value, (uint32_t) high) ;
+        mpz_mul_2exp (value, value, 32) ;
+        mpz_add_ui (value, value, (uint32_t) (inHighValue & UINT32_MAX)) ;
+      }
+      mpz_mul_2exp (value, value, 32) ;
     }
-    mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-  }
-  const uint64_t high = inLowValue >> 32 ;
-  mpz_add_ui (mGMPint, mGMPint, (uint32_t) high) ;
-  mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-  mpz_add_ui (mGMPint, mGMPint, (uint32_t) (inLowValue & UINT32_MAX)) ;
-  if (inNegate) {
-    mpz_neg (mGMPint, mGMPint) ;
+    const uint64_t high = inLowValue >> 32 ;
+    mpz_add_ui (value, value, (uint32_t) high) ;
+    mpz_mul_2exp (value, value, 32) ;
+    mpz_add_ui (value, value, (uint32_t) (inLowValue & UINT32_MAX)) ;
+    if (inNegate) {
+      mpz_neg (value, value) ;
+    }
+    normalize () ;
   }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt::C_BigInt (const int64_t inValue) :
+mSmallValue (inValue),
+mIsSmall (true),
+mGMPIsInitialized (false),
 mGMPint () {
-  const bool negative = inValue < 0 ;
-  const uint64_t v = (uint64_t) (negative ? (- inValue) : inValue) ;
-  mpz_init (mGMPint) ;
-  const uint64_t high = v >> 32 ;
-  if (high == 0) {
-    mpz_set_ui (mGMPint, (uint32_t) v) ;
-  }else{
-    mpz_set_ui (mGMPint, (uint32_t) high) ;
-    mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-    mpz_add_ui (mGMPint, mGMPint, (uint32_t) (v & UINT32_MAX)) ;
-  }
-  if (negative) {
-    mpz_neg (mGMPint, mGMPint) ;
-  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::setToZero (void) {
-  mpz_set_ui (mGMPint, 0) ;
+  mSmallValue = 0 ;
+  mIsSmall = true ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::setFromUnsigned (const uint32_t inValue) {
-  mpz_set_ui (mGMPint, inValue) ;
+  mSmallValue = (int64_t) inValue ;
+  mIsSmall = true ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt::C_BigInt (const char * inString, const int32_t inBase, bool & outOk) :
+mSmallValue (0),
+mIsSmall (true),
+mGMPIsInitialized (false),
 mGMPint () {
-  mpz_init (mGMPint) ;
-  const int r = mpz_set_str (mGMPint, inString, inBase) ;
+  const int r = mpz_set_str (gmpValueForUpdate (), inString, inBase) ;
   outOk = r == 0 ;
+  normalize () ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -201,14 +330,24 @@ mGMPint () {
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt & C_BigInt::operator ++ (void) {
-  mpz_add_ui (mGMPint, mGMPint, 1) ;
+  if (mIsSmall && (mSmallValue != INT64_MAX)) {
+    mSmallValue ++ ;
+  }else{
+    mpz_add_ui (gmpValueForUpdate (), mGMPint, 1) ;
+    normalize () ;
+  }
   return *this ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_BigInt & C_BigInt::operator -- (void) {
-  mpz_sub_ui (mGMPint, mGMPint, 1) ;
+  if (mIsSmall && (mSmallValue != INT64_MIN)) {
+    mSmallValue -- ;
+  }else{
+    mpz_sub_ui (gmpValueForUpdate (), mGMPint, 1) ;
+    normalize () ;
+  }
   return *this ;
 }
 
@@ -223,13 +362,17 @@ C_BigInt & C_BigInt::operator -- (void) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_String C_BigInt::decimalString (void) const {
-  const size_t neededSize = mpz_sizeinbase (mGMPint, 10) + 2 ;
-  char * s = NULL ;
-  macroMyNewPODArray (s, char, neededSize) ;
-  mpz_get_str (s, 10, mGMPint) ;
   C_String result ;
-  result << s ;
-  macroMyDeletePODArray (s) ;
+  if (mIsSmall) {
+    result.appendSigned (mSmallValue) ;
+  }else{
+    const size_t neededSize = mpz_sizeinbase (mGMPint, 10) + 2 ;
+    char * s = NULL ;
+    macroMyNewPODArray (s, char, neededSize) ;
+    mpz_get_str (s, 10, mGMPint) ;
+    result << s ;
+    macroMyDeletePODArray (s) ;
+  }
   return result ;
 }
 
@@ -262,13 +405,20 @@ C_String C_BigInt::hexString (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 C_String C_BigInt::xString (void) const {
-  char * s = NULL ;
-  const size_t neededSize = mpz_sizeinbase (mGMPint, 16) + 2 ;
-  macroMyNewPODArray (s, char, neededSize) ;
-  mpz_get_str (s, -16, mGMPint) ; // -16 for getting 'A' to 'F' (16 provides 'a' to 'f')
   C_String result ;
-  result << s ;
-  macroMyDeletePODArray (s) ;
+  if (mIsSmall) {
+    if (mSmallValue < 0) {
+      result << "-" ;
+    }
+    result.appendUnsignedHex (magnitude (mSmallValue)) ;
+  }else{
+    char * s = NULL ;
+    const size_t neededSize = mpz_sizeinbase (mGMPint, 16) + 2 ;
+    macroMyNewPODArray (s, char, neededSize) ;
+    mpz_get_str (s, -16, mGMPint) ; // -16 for getting 'A' to 'F' (16 provides 'a' to 'f')
+    result << s ;
+    macroMyDeletePODArray (s) ;
+  }
   return result ;
 }
 
@@ -282,7 +432,11 @@ C_String C_BigInt::xString (void) const {
 
 C_BigInt C_BigInt::abs (void) const {
   C_BigInt result ;
-  mpz_abs (result.mGMPint, mGMPint) ;
+  if (mIsSmall && (mSmallValue != INT64_MIN)) {
+    result.mSmallValue = (mSmallValue < 0) ? (- mSmallValue) : mSmallValue ;
+  }else{
+    mpz_abs (result.gmpValueForUpdate (), gmpValue ()) ;
+  }
   return result ;
 }
 
@@ -295,7 +449,12 @@ C_BigInt C_BigInt::abs (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator &= (const C_BigInt inOperand) {
-  mpz_and (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall) {
+    mSmallValue &= inOperand.mSmallValue ;
+  }else{
+    mpz_and (gmpValueForUpdate (), mGMPint, inOperand.gmpValue ()) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -309,7 +468,12 @@ C_BigInt C_BigInt::operator & (const C_BigInt & inOperand) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator |= (const C_BigInt inOperand) {
-  mpz_ior (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall) {
+    mSmallValue |= inOperand.mSmallValue ;
+  }else{
+    mpz_ior (gmpValueForUpdate (), mGMPint, inOperand.gmpValue ()) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -323,7 +487,12 @@ C_BigInt C_BigInt::operator | (const C_BigInt & inOperand) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator ^= (const C_BigInt inOperand) {
-  mpz_xor (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall) {
+    mSmallValue ^= inOperand.mSmallValue ;
+  }else{
+    mpz_xor (gmpValueForUpdate (), mGMPint, inOperand.gmpValue ()) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -338,7 +507,12 @@ C_BigInt C_BigInt::operator ^ (const C_BigInt & inOperand) const {
 
 C_BigInt C_BigInt::operator ~ (void) const {
   C_BigInt result ;
-  mpz_com (result.mGMPint, mGMPint) ;
+  if (mIsSmall) {
+    result.mSmallValue = ~ mSmallValue ;
+  }else{
+    mpz_com (result.gmpValueForUpdate (), mGMPint) ;
+    result.normalize () ;
+  }
   return result ;
 }
 
@@ -351,7 +525,12 @@ C_BigInt C_BigInt::operator ~ (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator += (const uint32_t inOperand) {
-  mpz_add_ui (mGMPint, mGMPint, inOperand) ;
+  if (mIsSmall && ! addOverflows (mSmallValue, (int64_t) inOperand)) {
+    mSmallValue += (int64_t) inOperand ;
+  }else{
+    mpz_add_ui (gmpValueForUpdate (), mGMPint, inOperand) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -365,7 +544,12 @@ C_BigInt C_BigInt::operator + (const uint32_t inOperand) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator -= (const uint32_t inOperand) {
-  mpz_sub_ui (mGMPint, mGMPint, inOperand) ;
+  if (mIsSmall && ! subtractOverflows (mSmallValue, (int64_t) inOperand)) {
+    mSmallValue -= (int64_t) inOperand ;
+  }else{
+    mpz_sub_ui (gmpValueForUpdate (), mGMPint, inOperand) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -385,13 +569,23 @@ C_BigInt C_BigInt::operator - (const uint32_t inOperand) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator += (const C_BigInt inOperand) {
-  mpz_add (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall && ! addOverflows (mSmallValue, inOperand.mSmallValue)) {
+    mSmallValue += inOperand.mSmallValue ;
+  }else{
+    mpz_add (gmpValueForUpdate (), mGMPint, inOperand.gmpValue ()) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator -= (const C_BigInt inOperand) {
-  mpz_sub (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall && ! subtractOverflows (mSmallValue, inOperand.mSmallValue)) {
+    mSmallValue -= inOperand.mSmallValue ;
+  }else{
+    mpz_sub (gmpValueForUpdate (), mGMPint, inOperand.gmpValue ()) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -429,7 +623,12 @@ C_BigInt C_BigInt::operator - (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::negateInPlace (void) {
-  mpz_neg (mGMPint, mGMPint) ;
+  if (mIsSmall && (mSmallValue != INT64_MIN)) {
+    mSmallValue = - mSmallValue ;
+  }else{
+    mpz_neg (gmpValueForUpdate (), mGMPint) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -441,7 +640,12 @@ void C_BigInt::negateInPlace (void) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator *= (const uint32_t inMultiplicand) {
-  mpz_mul_ui (mGMPint, mGMPint, inMultiplicand) ;
+  if (mIsSmall && (mSmallValue >= - (int64_t) INT32_MAX) && (mSmallValue <= INT32_MAX)) {
+    mSmallValue *= (int64_t) inMultiplicand ;
+  }else{
+    mpz_mul_ui (gmpValueForUpdate (), mGMPint, inMultiplicand) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -461,7 +665,13 @@ C_BigInt C_BigInt::operator * (const uint32_t inMultiplicand) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator *= (const C_BigInt inMultiplicand) {
-  mpz_mul (mGMPint, mGMPint, inMultiplicand.mGMPint) ;
+  if (mIsSmall && inMultiplicand.mIsSmall
+   && fitsInInt32Range (mSmallValue) && fitsInInt32Range (inMultiplicand.mSmallValue)) {
+    mSmallValue *= inMultiplicand.mSmallValue ;
+  }else{
+    mpz_mul (gmpValueForUpdate (), mGMPint, inMultiplicand.gmpValue ()) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -483,21 +693,43 @@ C_BigInt C_BigInt::operator * (const C_BigInt & inMultiplicand) const {
 void C_BigInt::divideBy (const uint32_t inDivisor,
                          C_BigInt & outQuotient,
                          uint32_t & outRemainder) const {
-  outRemainder = (uint32_t) mpz_fdiv_q_ui (outQuotient.mGMPint, mGMPint, inDivisor) ;
+  if (mIsSmall && (inDivisor != 0)) {
+    const int64_t divisor = (int64_t) inDivisor ;
+    int64_t quotient = mSmallValue / divisor ;
+    int64_t remainder = mSmallValue % divisor ;
+    if (remainder < 0) { // Floor division
+      quotient -= 1 ;
+      remainder += divisor ;
+    }
+    outQuotient.mSmallValue = quotient ;
+    outQuotient.mIsSmall = true ;
+    outRemainder = (uint32_t) remainder ;
+  }else{
+    outRemainder = (uint32_t) mpz_fdiv_q_ui (outQuotient.gmpValueForUpdate (), gmpValue (), inDivisor) ;
+    outQuotient.normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::divideInPlace (const uint32_t inDivisor, uint32_t & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  if (mpz_sgn (mGMPint) >= 0) {
-    outRemainder = (uint32_t) mpz_fdiv_q_ui (quotient, mGMPint, inDivisor) ;
+  if (mIsSmall && (inDivisor != 0)) {
+    const int64_t divisor = (int64_t) inDivisor ;
+    outRemainder = (uint32_t) magnitude (mSmallValue % divisor) ;
+    mSmallValue /= divisor ;
   }else{
-    outRemainder = (uint32_t) mpz_cdiv_q_ui (quotient, mGMPint, inDivisor) ;
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_ptr value = gmpValueForUpdate () ;
+    if (mpz_sgn (value) >= 0) {
+      outRemainder = (uint32_t) mpz_fdiv_q_ui (quotient, value, inDivisor) ;
+    }else{
+      outRemainder = (uint32_t) mpz_cdiv_q_ui (quotient, value, inDivisor) ;
+    }
+    mpz_swap (quotient, value) ;
+    mpz_clear (quotient) ;
+    normalize () ;
   }
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -512,21 +744,45 @@ void C_BigInt::divideBy (const C_BigInt inDivisor,
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::divideInPlace (const C_BigInt inDivisor, C_BigInt & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_tdiv_qr (quotient, outRemainder.mGMPint, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsDefined (mSmallValue, inDivisor.mSmallValue)) {
+    const int64_t remainder = mSmallValue % inDivisor.mSmallValue ;
+    mSmallValue /= inDivisor.mSmallValue ;
+    outRemainder.mSmallValue = remainder ;
+    outRemainder.mIsSmall = true ;
+  }else{
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_tdiv_qr (quotient, outRemainder.gmpValueForUpdate (), gmpValueForUpdate (), inDivisor.gmpValue ()) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+    outRemainder.normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::ceilDivideInPlace (const C_BigInt inDivisor, C_BigInt & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_cdiv_qr (quotient, outRemainder.mGMPint, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsDefined (mSmallValue, inDivisor.mSmallValue)) {
+    const int64_t divisor = inDivisor.mSmallValue ;
+    int64_t quotient = mSmallValue / divisor ;
+    int64_t remainder = mSmallValue % divisor ;
+    if ((remainder != 0) && ((remainder > 0) == (divisor > 0))) {
+      quotient += 1 ;
+      remainder -= divisor ;
+    }
+    mSmallValue = quotient ;
+    outRemainder.mSmallValue = remainder ;
+    outRemainder.mIsSmall = true ;
+  }else{
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_cdiv_qr (quotient, outRemainder.gmpValueForUpdate (), gmpValueForUpdate (), inDivisor.gmpValue ()) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+    outRemainder.normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -541,11 +797,26 @@ void C_BigInt::ceilDivideBy (const C_BigInt inDivisor,
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::floorDivideInPlace (const C_BigInt inDivisor, C_BigInt & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_fdiv_qr (quotient, outRemainder.mGMPint, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsDefined (mSmallValue, inDivisor.mSmallValue)) {
+    const int64_t divisor = inDivisor.mSmallValue ;
+    int64_t quotient = mSmallValue / divisor ;
+    int64_t remainder = mSmallValue % divisor ;
+    if ((remainder != 0) && ((remainder < 0) != (divisor < 0))) {
+      quotient -= 1 ;
+      remainder += divisor ;
+    }
+    mSmallValue = quotient ;
+    outRemainder.mSmallValue = remainder ;
+    outRemainder.mIsSmall = true ;
+  }else{
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_fdiv_qr (quotient, outRemainder.gmpValueForUpdate (), gmpValueForUpdate (), inDivisor.gmpValue ()) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+    outRemainder.normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -575,14 +846,21 @@ C_BigInt C_BigInt::operator / (const C_BigInt & inDivisor) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator %= (const C_BigInt inDivisor) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_t remainder ;
-  mpz_init (remainder) ;
-  mpz_tdiv_qr (quotient, remainder, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (remainder, mGMPint) ;
-  mpz_clear (quotient) ;
-  mpz_clear (remainder) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsDefined (mSmallValue, inDivisor.mSmallValue)) {
+    mSmallValue %= inDivisor.mSmallValue ;
+  }else if (mIsSmall && inDivisor.mIsSmall && (inDivisor.mSmallValue == -1)) { // INT64_MIN % -1
+    mSmallValue = 0 ;
+  }else{
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_t remainder ;
+    mpz_init (remainder) ;
+    mpz_tdiv_qr (quotient, remainder, gmpValueForUpdate (), inDivisor.gmpValue ()) ;
+    mpz_swap (remainder, mGMPint) ;
+    mpz_clear (quotient) ;
+    mpz_clear (remainder) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -602,7 +880,16 @@ C_BigInt C_BigInt::operator % (const C_BigInt & inDivisor) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator <<= (const uint32_t inValue) {
-  mpz_mul_2exp (mGMPint, mGMPint, inValue) ;
+  if (mIsSmall && (mSmallValue == 0)) {
+    // Shifting zero leaves it unchanged
+  }else if (mIsSmall && (inValue < 63)
+         && (mSmallValue <= (INT64_MAX >> inValue))
+         && (mSmallValue >= (- (INT64_MAX >> inValue) - 1))) {
+    mSmallValue *= ((int64_t) 1) << inValue ;
+  }else{
+    mpz_mul_2exp (gmpValueForUpdate (), mGMPint, inValue) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -622,11 +909,20 @@ C_BigInt C_BigInt::operator << (const uint32_t inValue) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::operator >>= (const uint32_t inValue) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_fdiv_q_2exp (quotient, mGMPint, inValue) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall) { // Rounds toward minus infinity, as mpz_fdiv_q_2exp
+    if (mSmallValue >= 0) {
+      mSmallValue = (inValue >= 63) ? 0 : (mSmallValue >> inValue) ;
+    }else{
+      mSmallValue = (inValue >= 63) ? -1 : ~ ((~ mSmallValue) >> inValue) ;
+    }
+  }else{
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_fdiv_q_2exp (quotient, mGMPint, inValue) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -646,7 +942,13 @@ C_BigInt C_BigInt::operator >> (const uint32_t inValue) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 int32_t C_BigInt::compare (const C_BigInt & inValue) const {
-  return mpz_cmp (mGMPint, inValue.mGMPint) ;
+  int32_t result ;
+  if (mIsSmall && inValue.mIsSmall) {
+    result = (mSmallValue > inValue.mSmallValue) ? 1 : ((mSmallValue < inValue.mSmallValue) ? -1 : 0) ;
+  }else{
+    result = mpz_cmp (gmpValue (), inValue.gmpValue ()) ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -692,25 +994,45 @@ bool C_BigInt::operator < (const C_BigInt & inOperand) const {
 #endif
 
 //---------------------------------------------------------------------------------------------------------------------*
+// Bits of a small value are its two's complement bits, bit 63 being repeated above
 
 bool C_BigInt::bitAtIndex (const uint32_t inIndex) const {
-  return mpz_tstbit (mGMPint, inIndex) != 0 ;
+  bool result ;
+  if (mIsSmall) {
+    const uint32_t index = (inIndex > 63) ? 63 : inIndex ;
+    result = ((((uint64_t) mSmallValue) >> index) & 1) != 0 ;
+  }else{
+    result = mpz_tstbit (mGMPint, inIndex) != 0 ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::setBitAtIndex (const bool inBit, const uint32_t inIndex) {
-  if (inBit) {
-    mpz_setbit (mGMPint, inIndex) ;
+  if (mIsSmall && (inIndex < 63)) {
+    const uint64_t mask = ((uint64_t) 1) << inIndex ;
+    const uint64_t v = (uint64_t) mSmallValue ;
+    mSmallValue = (int64_t) (inBit ? (v | mask) : (v & ~ mask)) ;
   }else{
-    mpz_clrbit (mGMPint, inIndex) ;
+    if (inBit) {
+      mpz_setbit (gmpValueForUpdate (), inIndex) ;
+    }else{
+      mpz_clrbit (gmpValueForUpdate (), inIndex) ;
+    }
+    normalize () ;
   }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::complementBitAtIndex (const uint32_t inIndex) {
-  mpz_combit (mGMPint, inIndex) ;
+  if (mIsSmall && (inIndex < 63)) {
+    mSmallValue = (int64_t) (((uint64_t) mSmallValue) ^ (((uint64_t) 1) << inIndex)) ;
+  }else{
+    mpz_combit (gmpValueForUpdate (), inIndex) ;
+    normalize () ;
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -722,39 +1044,51 @@ void C_BigInt::complementBitAtIndex (const uint32_t inIndex) {
 //---------------------------------------------------------------------------------------------------------------------*
 
 bool C_BigInt::fitsInUInt32 (void) const {
-  return mpz_fits_uint_p (mGMPint) != 0 ;
+  bool result ;
+  if (mIsSmall) {
+    result = (mSmallValue >= 0) && (mSmallValue <= UINT32_MAX) ;
+  }else{
+    result = mpz_fits_uint_p (mGMPint) != 0 ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 bool C_BigInt::fitsInUInt64 (void) const {
-  return (mpz_sgn (mGMPint) >= 0) && (mpz_sizeinbase (mGMPint, 2) <= 64) ;
+  bool result ;
+  if (mIsSmall) {
+    result = mSmallValue >= 0 ;
+  }else{
+    result = (mpz_sgn (mGMPint) >= 0) && (mpz_sizeinbase (mGMPint, 2) <= 64) ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 bool C_BigInt::fitsInSInt32 (void) const {
-  return mpz_fits_sint_p (mGMPint) != 0 ;
+  bool result ;
+  if (mIsSmall) {
+    result = fitsInInt32Range (mSmallValue) ;
+  }else{
+    result = mpz_fits_sint_p (mGMPint) != 0 ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 bool C_BigInt::fitsInSInt64 (void) const {
-  const size_t requiredBitCount = mpz_sizeinbase (mGMPint, 2) ;
-  bool ok = requiredBitCount <= 63 ;
-  if ((requiredBitCount == 64) && (mpz_sgn (mGMPint) < 0)) { // INT64_MIN is a particular case
-    int64_t r ;
-    mpz_export (& r, NULL, 1, sizeof (int64_t), 0, 0, mGMPint) ;
-    ok = r == INT64_MIN ;
-  }
-  return ok ;
+  return mIsSmall || gmpFitsInSInt64 (mGMPint) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 uint32_t C_BigInt::requiredBitCountForSignedRepresentation (void) const {
-  size_t requiredBitCount = mpz_sizeinbase (mGMPint, 2) ;
-  if (mpz_sgn (mGMPint) > 0) {
+  mpz_srcptr value = gmpValue () ;
+  size_t requiredBitCount = mpz_sizeinbase (value, 2) ;
+  if (mpz_sgn (value) > 0) {
     requiredBitCount ++ ;
   }
   return (uint32_t) requiredBitCount ;
@@ -763,7 +1097,7 @@ uint32_t C_BigInt::requiredBitCountForSignedRepresentation (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 uint32_t C_BigInt::requiredBitCountForUnsignedRepresentation (void) const {
-  return (uint32_t) mpz_sizeinbase (mGMPint, 2) ;
+  return (uint32_t) mpz_sizeinbase (gmpValue (), 2) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -775,14 +1109,24 @@ uint32_t C_BigInt::requiredBitCountForUnsignedRepresentation (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 uint32_t C_BigInt::uint32 (void) const {
-  return (uint32_t) mpz_get_ui (mGMPint) ;
+  uint32_t result ;
+  if (mIsSmall) {
+    result = (uint32_t) (magnitude (mSmallValue) & UINT32_MAX) ;
+  }else{
+    result = (uint32_t) mpz_get_ui (mGMPint) ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 uint64_t C_BigInt::uint64 (void) const {
   uint64_t result = UINT64_MAX ;
-  if (fitsInUInt64 ()) {
+  if (mIsSmall) {
+    if (mSmallValue >= 0) {
+      result = (uint64_t) mSmallValue ;
+    }
+  }else if (fitsInUInt64 ()) {
     mpz_export (& result, NULL, 1, sizeof (uint64_t), 0, 0, mGMPint) ;
   }
   return result ;
@@ -791,19 +1135,30 @@ uint64_t C_BigInt::uint64 (void) const {
 //---------------------------------------------------------------------------------------------------------------------*
 
 int32_t C_BigInt::int32 (void) const {
-  return (int32_t) mpz_get_si (mGMPint) ;
+  int32_t result ;
+  if (mIsSmall) {
+    result = (int32_t) mSmallValue ;
+  }else{
+    result = (int32_t) mpz_get_si (mGMPint) ;
+  }
+  return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 int64_t C_BigInt::int64 (void) const {
-  uint64_t r = UINT64_MAX ;
-  if (fitsInSInt64 ()) {
-    mpz_export (& r, NULL, 1, sizeof (uint64_t), 0, 0, mGMPint) ;
-  }
-  int64_t result = (int64_t) r ;
-  if (mpz_sgn (mGMPint) < 0) {
-    result = - result ;
+  int64_t result ;
+  if (mIsSmall) {
+    result = mSmallValue ;
+  }else{
+    uint64_t r = UINT64_MAX ;
+    if (fitsInSInt64 ()) {
+      mpz_export (& r, NULL, 1, sizeof (uint64_t), 0, 0, mGMPint) ;
+    }
+    result = (int64_t) r ;
+    if (mpz_sgn (mGMPint) < 0) {
+      result = - result ;
+    }
   }
   return result ;
 }
@@ -812,7 +1167,7 @@ int64_t C_BigInt::int64 (void) const {
 
 void C_BigInt::extractBytesForUnsignedRepresentation (TC_UniqueArray <uint8_t> & outValue) const {
   size_t count = 0 ;
-  const uint8_t * ptr = (const uint8_t *) mpz_export (NULL, & count, -1, sizeof (uint8_t), 0, 0, mGMPint) ;
+  const uint8_t * ptr = (const uint8_t *) mpz_export (NULL, & count, -1, sizeof (uint8_t), 0, 0, gmpValue ()) ;
   outValue.setCountToZero () ;
   for (size_t i=0 ; i<count ; i++) {
     outValue.appendObject (ptr [i]) ;
@@ -826,10 +1181,10 @@ void C_BigInt::extractBytesForUnsignedRepresentation (TC_UniqueArray <uint8_t> &
 //---------------------------------------------------------------------------------------------------------------------*
 
 void C_BigInt::extractBytesForSignedRepresentation (TC_UniqueArray <uint8_t> & outValue) const {
-  if (mpz_sgn (mGMPint) == 0) { // zero
+  if (sign () == 0) { // zero
     outValue.setCountToZero () ;
     outValue.appendObject (0) ;
-  }else if (mpz_sgn (mGMPint) > 0) { // > 0
+  }else if (sign () > 0) { // > 0
     extractBytesForUnsignedRepresentation (outValue) ;
     if ((outValue.lastObject (HERE) & 0x80) != 0) {
       outValue.appendObject (0) ;
@@ -855,7 +1210,17 @@ void C_BigInt::extractBytesForSignedRepresentation (TC_UniqueArray <uint8_t> & o
 //---------------------------------------------------------------------------------------------------------------------*
 
 void swap (C_BigInt & ioOp1, C_BigInt & ioOp2) {
-  mpz_swap (ioOp1.mGMPint, ioOp2.mGMPint) ;
+  if (! ioOp1.mIsSmall || ! ioOp2.mIsSmall) {
+    ioOp1.gmpValue () ;
+    ioOp2.gmpValue () ;
+    mpz_swap (ioOp1.mGMPint, ioOp2.mGMPint) ;
+  }
+  const int64_t smallValue = ioOp1.mSmallValue ;
+  ioOp1.mSmallValue = ioOp2.mSmallValue ;
+  ioOp2.mSmallValue = smallValue ;
+  const bool isSmall = ioOp1.mIsSmall ;
+  ioOp1.mIsSmall = ioOp2.mIsSmall ;
+  ioOp2.mIsSmall = isSmall ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -885,4 +1250,3 @@ C_BigInt C_BigInt::randomNumber (void) {
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
-
@@ -173,7 +173,18 @@ class C_BigInt {
   public : uint32_t requiredBitCountForUnsignedRepresentation (void) const ;
   
 //--- Value
-  protected : mpz_t mGMPint ;
+//    A value that fits in an int64_t is held in mSmallValue, without any allocation. Otherwise it is held in
+//    mGMPint. When the value is small, mGMPint (allocated on demand) is a scratch copy for operations that
+//    have no int64_t fast path.
+  protected : int64_t mSmallValue ;
+  protected : bool mIsSmall ;
+  protected : mutable bool mGMPIsInitialized ;
+  protected : mutable mpz_t mGMPint ;
+
+//--- Access to the GMP representation
+  private : mpz_srcptr gmpValue (void) const ;
+  private : mpz_ptr gmpValueForUpdate (void) ;
+  private : void normalize (void) ;
 
 //--- Friend
   friend void swap (C_BigInt & ioOp1, C_BigInt & ioOp2) ;
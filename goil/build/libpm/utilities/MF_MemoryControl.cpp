@@ -91,7 +91,7 @@
       macroValidPointerThere (inPointer) ;
       unregisterPointer (inPointer, kAllocatedByMacroMyNewPODArray COMMA_THERE) ;
     }
-    void * ptr = realloc (inPointer, inSize) ;
+    void * ptr = myReallocRoutine (inPointer, inSize) ;
     registerPointerDescriptor (ptr, kAllocatedByMacroMyNewPODArray COMMA_THERE) ;
     gReallocatedPODArrayCount ++ ;
     if (ptr != inPointer) {
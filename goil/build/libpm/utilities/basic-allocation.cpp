@@ -26,6 +26,7 @@
 //---------------------------------------------------------------------------------------------------------------------*
 
 #include <stdlib.h>
+#include <string.h>
 
 //---------------------------------------------------------------------------------------------------------------------*
 
@@ -86,6 +87,23 @@
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+#ifdef USE_ARENA_ALLOCATION
+  static const size_t kArenaGranularity = 16 ;
+  static const size_t kArenaHeaderSize = 16 ; // Keeps blocks aligned as malloc does on 64-bit platforms
+  static const size_t kArenaSizeClassCount = 16 ; // Slots of 16, 32, ..., 256 bytes, header included
+  static const size_t kArenaChunkSize = 1 << 20 ;
+
+  typedef struct cArenaFreeBlock {
+    struct cArenaFreeBlock * mNext ;
+  }cArenaFreeBlock ;
+
+  static cArenaFreeBlock * gArenaFreeLists [kArenaSizeClassCount] ;
+  static char * gArenaCurrentChunk ;
+  static size_t gArenaAvailableSize ;
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Allocation routines
 #endif
@@ -117,7 +135,44 @@
 }
 #endif
 
-#ifndef USE_SMALL_BLOCK_FREE_LIST
+#ifdef USE_ARENA_ALLOCATION
+void * myAllocRoutine (const size_t inSizeInBytes) {
+//--- Each block is preceded by its size class, kArenaSizeClassCount for a block obtained from malloc.
+//    A free slot is linked through its header.
+  char * header = NULL ;
+  const size_t sizeClass = (inSizeInBytes + kArenaHeaderSize - 1) / kArenaGranularity ;
+  if (sizeClass < kArenaSizeClassCount) {
+    cArenaFreeBlock * freeBlock = gArenaFreeLists [sizeClass] ;
+    if (freeBlock != NULL) {
+      gArenaFreeLists [sizeClass] = freeBlock->mNext ;
+      header = (char *) freeBlock ;
+    }else{
+      const size_t slotSize = (sizeClass + 1) * kArenaGranularity ;
+      if (gArenaAvailableSize < slotSize) { // The end of the current chunk is lost
+        gArenaCurrentChunk = (char *) ::malloc (kArenaChunkSize) ;
+        gArenaAvailableSize = (gArenaCurrentChunk == NULL) ? 0 : kArenaChunkSize ;
+      }
+      if (gArenaCurrentChunk != NULL) {
+        header = gArenaCurrentChunk ;
+        gArenaCurrentChunk += slotSize ;
+        gArenaAvailableSize -= slotSize ;
+      }
+    }
+  }else{
+  #ifdef GENERATE_BLOCK_SIZE_STATS
+    noteAllocatedPointerSize (inSizeInBytes) ;
+  #endif
+    header = (char *) ::malloc (inSizeInBytes + kArenaHeaderSize) ;
+  }
+  if (header != NULL) {
+    * ((size_t *) header) = (sizeClass < kArenaSizeClassCount) ? sizeClass : kArenaSizeClassCount ;
+    header += kArenaHeaderSize ;
+  }
+  return header ;
+}
+#endif
+
+#if (! defined (USE_SMALL_BLOCK_FREE_LIST)) && (! defined (USE_ARENA_ALLOCATION))
 void * myAllocRoutine (const size_t inSizeInBytes) {
   #ifdef USE_MALLOC_GOOD_SIZE
     const size_t sizeInBytes = malloc_good_size (inSizeInBytes) ;
@@ -160,7 +215,21 @@ void myFreeRoutine (void * inPointer) {
 }
 #endif
 
-#ifndef USE_SMALL_BLOCK_FREE_LIST
+#ifdef USE_ARENA_ALLOCATION
+void myFreeRoutine (void * inPointer) {
+  char * header = ((char *) inPointer) - kArenaHeaderSize ;
+  const size_t sizeClass = * ((size_t *) header) ;
+  if (sizeClass < kArenaSizeClassCount) {
+    cArenaFreeBlock * freeBlock = (cArenaFreeBlock *) header ;
+    freeBlock->mNext = gArenaFreeLists [sizeClass] ;
+    gArenaFreeLists [sizeClass] = freeBlock ;
+  }else{
+    ::free (header) ;
+  }
+}
+#endif
+
+#if (! defined (USE_SMALL_BLOCK_FREE_LIST)) && (! defined (USE_ARENA_ALLOCATION))
 void myFreeRoutine (void * inPointer) {
   #ifdef CALL_MALLOC_DEBUG
     malloc_debug (4) ;
@@ -171,6 +240,75 @@ void myFreeRoutine (void * inPointer) {
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Reallocation routines
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+#ifdef USE_SMALL_BLOCK_FREE_LIST
+void * myReallocRoutine (void * inPointer, const size_t inSizeInBytes) {
+  void * ptr = NULL ;
+  if (inPointer == NULL) {
+    ptr = myAllocRoutine (inSizeInBytes) ;
+  }else{
+    int32_t * p = ((int32_t *) inPointer) - 1 ;
+    if (* p != 0) {
+      p = (int32_t *) ::realloc (p, inSizeInBytes + sizeof (int32_t)) ;
+      ptr = (p == NULL) ? NULL : (p + 1) ;
+    }else if (inSizeInBytes <= (sizeof (cBlock) - sizeof (int32_t))) {
+      ptr = inPointer ;
+    }else{
+      ptr = myAllocRoutine (inSizeInBytes) ;
+      if (ptr != NULL) {
+        ::memcpy (ptr, inPointer, sizeof (cBlock) - sizeof (int32_t)) ;
+        myFreeRoutine (inPointer) ;
+      }
+    }
+  }
+  return ptr ;
+}
+#endif
+
+#ifdef USE_ARENA_ALLOCATION
+void * myReallocRoutine (void * inPointer, const size_t inSizeInBytes) {
+  void * ptr = NULL ;
+  if (inPointer == NULL) {
+    ptr = myAllocRoutine (inSizeInBytes) ;
+  }else{
+    char * header = ((char *) inPointer) - kArenaHeaderSize ;
+    const size_t sizeClass = * ((size_t *) header) ;
+    if (sizeClass == kArenaSizeClassCount) { // Block obtained from malloc, it stays in malloc
+      header = (char *) ::realloc (header, inSizeInBytes + kArenaHeaderSize) ;
+      ptr = (header == NULL) ? NULL : (header + kArenaHeaderSize) ;
+    }else{
+      const size_t capacity = sizeClass * kArenaGranularity ;
+      if (inSizeInBytes <= capacity) {
+        ptr = inPointer ;
+      }else{
+        ptr = myAllocRoutine (inSizeInBytes) ;
+        if (ptr != NULL) {
+          ::memcpy (ptr, inPointer, capacity) ;
+          myFreeRoutine (inPointer) ;
+        }
+      }
+    }
+  }
+  return ptr ;
+}
+#endif
+
+#if (! defined (USE_SMALL_BLOCK_FREE_LIST)) && (! defined (USE_ARENA_ALLOCATION))
+void * myReallocRoutine (void * inPointer, const size_t inSizeInBytes) {
+  #ifdef CALL_MALLOC_DEBUG
+    malloc_debug (4) ;
+  #endif
+  return ::realloc (inPointer, inSizeInBytes) ;
+}
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Stats about block size
 #endif
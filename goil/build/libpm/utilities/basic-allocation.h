@@ -23,6 +23,14 @@
 #ifndef BASIC_ALLOCATION_ROUTINES_DEFINED
 #define BASIC_ALLOCATION_ROUTINES_DEFINED
 
+//---------------------------------------------------------------------------------------------------------------------*
+// If USE_ARENA_ALLOCATION is defined, blocks allocated by new are taken from large chunks that are never given back
+// to the system; a freed block is reused by the next allocation of the same size class. Blocks are 16-byte aligned.
+// Selectable here or from the compiler command line (-DUSE_ARENA_ALLOCATION).
+//---------------------------------------------------------------------------------------------------------------------*
+
+//#define USE_ARENA_ALLOCATION
+
 //---------------------------------------------------------------------------------------------------------------------*
 
 void * myAllocRoutine (const size_t inSizeInBytes) ;
@@ -31,6 +39,12 @@ void myFreeRoutine (void * inPointer) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+// Blocks obtained from myAllocRoutine are resized by myReallocRoutine, never by realloc
+
+void * myReallocRoutine (void * inPointer, const size_t inSizeInBytes) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 void displayAllocatedBlockSizeStats (void) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -57,6 +57,14 @@
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+#ifdef USE_ARENA_ALLOCATION
+  #ifndef REDEFINE_NEW_DELETE_OPERATORS
+    #define REDEFINE_NEW_DELETE_OPERATORS
+  #endif
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 #ifndef DO_NOT_GENERATE_CHECKINGS
   static int32_t gAllocProloguePendings = 0 ;
 #endif
@@ -2236,6 +2236,942 @@ class cPtr_gtlTemplate : public acPtr_class {
 
 } ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                             @gtlTemplateProfileMap map                                              *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cMapElement_gtlTemplateProfileMap ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const char * kSearchErrorMessage_gtlTemplateProfileMap_get ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlTemplateProfileMap : public AC_GALGAS_map {
+//--------------------------------- Default constructor
+  public : GALGAS_gtlTemplateProfileMap (void) ;
+
+//--------------------------------- Handle copy
+  public : GALGAS_gtlTemplateProfileMap (const GALGAS_gtlTemplateProfileMap & inSource) ;
+  public : GALGAS_gtlTemplateProfileMap & operator = (const GALGAS_gtlTemplateProfileMap & inSource) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlTemplateProfileMap extractObject (const GALGAS_object & inObject,
+                                                              C_Compiler * inCompiler
+                                                              COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlTemplateProfileMap constructor_emptyMap (LOCATION_ARGS) ;
+
+  public : static class GALGAS_gtlTemplateProfileMap constructor_mapWithMapToOverride (const class GALGAS_gtlTemplateProfileMap & inOperand0
+                                                                                       COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with list of field expressions)
+  public : VIRTUAL_IN_DEBUG void addAssign_operation (const class GALGAS_lstring & inOperand0,
+                                                      const class GALGAS_uint & inOperand1,
+                                                      const class GALGAS_uint & inOperand2,
+                                                      const class GALGAS_uint & inOperand3,
+                                                      const class GALGAS_uint & inOperand4,
+                                                      C_Compiler * inCompiler
+                                                      COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Setters
+  public : VIRTUAL_IN_DEBUG void setter_put (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_uint constinArgument1,
+                                             class GALGAS_uint constinArgument2,
+                                             class GALGAS_uint constinArgument3,
+                                             class GALGAS_uint constinArgument4,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setCallsForKey (class GALGAS_uint constinArgument0,
+                                                        class GALGAS_string constinArgument1,
+                                                        C_Compiler * inCompiler
+                                                        COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setEmittedCharactersForKey (class GALGAS_uint constinArgument0,
+                                                                    class GALGAS_string constinArgument1,
+                                                                    C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setExclusiveTimeForKey (class GALGAS_uint constinArgument0,
+                                                                class GALGAS_string constinArgument1,
+                                                                C_Compiler * inCompiler
+                                                                COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setInclusiveTimeForKey (class GALGAS_uint constinArgument0,
+                                                                class GALGAS_string constinArgument1,
+                                                                C_Compiler * inCompiler
+                                                                COMMA_LOCATION_ARGS) ;
+
+
+//--------------------------------- Instance Methods
+  public : VIRTUAL_IN_DEBUG void method_get (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_uint & outArgument1,
+                                             class GALGAS_uint & outArgument2,
+                                             class GALGAS_uint & outArgument3,
+                                             class GALGAS_uint & outArgument4,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) const ;
+
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_callsForKey (const class GALGAS_string & constinOperand0,
+                                                                  C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_emittedCharactersForKey (const class GALGAS_string & constinOperand0,
+                                                                              C_Compiler * inCompiler
+                                                                              COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_exclusiveTimeForKey (const class GALGAS_string & constinOperand0,
+                                                                          C_Compiler * inCompiler
+                                                                          COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_inclusiveTimeForKey (const class GALGAS_string & constinOperand0,
+                                                                          C_Compiler * inCompiler
+                                                                          COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplateProfileMap getter_overriddenMap (C_Compiler * inCompiler
+                                                                                     COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+  public : VIRTUAL_IN_DEBUG cMapElement_gtlTemplateProfileMap * readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                                   const GALGAS_string & inKey
+                                                                                                   COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Friend
+
+  friend class cEnumerator_gtlTemplateProfileMap ;
+ 
+} ; // End of GALGAS_gtlTemplateProfileMap class
+
+//---------------------------------------------------------------------------------------------------------------------*
+//   Enumerator declaration                                                                                            *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cEnumerator_gtlTemplateProfileMap : public cGenericAbstractEnumerator {
+  public : cEnumerator_gtlTemplateProfileMap (const GALGAS_gtlTemplateProfileMap & inEnumeratedObject,
+                                              const typeEnumerationOrder inOrder) ;
+
+//--- Current element access
+  public : class GALGAS_lstring current_lkey (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_calls (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_inclusiveTime (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_exclusiveTime (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_emittedCharacters (LOCATION_ARGS) const ;
+//--- Current element access
+  public : class GALGAS_gtlTemplateProfileMap_2D_element current (LOCATION_ARGS) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlTemplateProfileMap ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                  Class for element of '@gtlTemplateProfileMap' map                                  *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cMapElement_gtlTemplateProfileMap : public cMapElement {
+//--- Map attributes
+  public : GALGAS_uint mProperty_calls ;
+  public : GALGAS_uint mProperty_inclusiveTime ;
+  public : GALGAS_uint mProperty_exclusiveTime ;
+  public : GALGAS_uint mProperty_emittedCharacters ;
+
+//--- Constructor
+  public : cMapElement_gtlTemplateProfileMap (const GALGAS_lstring & inKey,
+                                              const GALGAS_uint & in_calls,
+                                              const GALGAS_uint & in_inclusiveTime,
+                                              const GALGAS_uint & in_exclusiveTime,
+                                              const GALGAS_uint & in_emittedCharacters
+                                              COMMA_LOCATION_ARGS) ;
+
+//--- Virtual method for comparing elements
+  public : virtual typeComparisonResult compare (const cCollectionElement * inOperand) const ;
+
+//--- Virtual method that checks that all attributes are valid
+  public : virtual bool isValid (void) const ;
+
+//--- Virtual method that returns a copy of current object
+  public : virtual cMapElement * copy (void) ;
+
+//--- Description
+ public : virtual void description (C_String & ioString, const int32_t inIndentation) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                      @gtlTemplateProfileMap_2D_element struct                                       *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlTemplateProfileMap_2D_element : public AC_GALGAS_root {
+//--------------------------------- Properties
+  public : GALGAS_lstring mProperty_lkey ;
+
+  public : GALGAS_uint mProperty_calls ;
+
+  public : GALGAS_uint mProperty_inclusiveTime ;
+
+  public : GALGAS_uint mProperty_exclusiveTime ;
+
+  public : GALGAS_uint mProperty_emittedCharacters ;
+
+//--------------------------------- Accessors
+  public : VIRTUAL_IN_DEBUG bool isValid (void) const ;
+  public : VIRTUAL_IN_DEBUG void drop (void) ;
+
+//--------------------------------- Default GALGAS constructor
+  public : static GALGAS_gtlTemplateProfileMap_2D_element constructor_default (LOCATION_ARGS) ;
+
+//--------------------------------- Default constructor
+  public : GALGAS_gtlTemplateProfileMap_2D_element (void) ;
+
+//--------------------------------- Virtual destructor (in debug mode)
+  public : VIRTUAL_IN_DEBUG ~ GALGAS_gtlTemplateProfileMap_2D_element (void) ;
+
+//--------------------------------- Native constructor
+  public : GALGAS_gtlTemplateProfileMap_2D_element (const GALGAS_lstring & in_lkey,
+                                                    const GALGAS_uint & in_calls,
+                                                    const GALGAS_uint & in_inclusiveTime,
+                                                    const GALGAS_uint & in_exclusiveTime,
+                                                    const GALGAS_uint & in_emittedCharacters) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlTemplateProfileMap_2D_element extractObject (const GALGAS_object & inObject,
+                                                                         C_Compiler * inCompiler
+                                                                         COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlTemplateProfileMap_2D_element constructor_new (const class GALGAS_lstring & inOperand0,
+                                                                                 const class GALGAS_uint & inOperand1,
+                                                                                 const class GALGAS_uint & inOperand2,
+                                                                                 const class GALGAS_uint & inOperand3,
+                                                                                 const class GALGAS_uint & inOperand4
+                                                                                 COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Implementation of getter 'description'
+  public : VIRTUAL_IN_DEBUG void description (C_String & ioString,
+                                              const int32_t inIndentation) const ;
+//--------------------------------- Comparison
+  public : typeComparisonResult objectCompare (const GALGAS_gtlTemplateProfileMap_2D_element & inOperand) const ;
+
+//--------------------------------- Setters
+
+//--------------------------------- Instance Methods
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_lstring getter_lkey (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_calls (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_inclusiveTime (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_exclusiveTime (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_emittedCharacters (LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+ 
+} ; // End of GALGAS_gtlTemplateProfileMap_2D_element class
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlTemplateProfileMap_2D_element ;
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                               @gtlFoldedStackMap map                                                *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cMapElement_gtlFoldedStackMap ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const char * kSearchErrorMessage_gtlFoldedStackMap_get ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlFoldedStackMap : public AC_GALGAS_map {
+//--------------------------------- Default constructor
+  public : GALGAS_gtlFoldedStackMap (void) ;
+
+//--------------------------------- Handle copy
+  public : GALGAS_gtlFoldedStackMap (const GALGAS_gtlFoldedStackMap & inSource) ;
+  public : GALGAS_gtlFoldedStackMap & operator = (const GALGAS_gtlFoldedStackMap & inSource) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlFoldedStackMap extractObject (const GALGAS_object & inObject,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlFoldedStackMap constructor_emptyMap (LOCATION_ARGS) ;
+
+  public : static class GALGAS_gtlFoldedStackMap constructor_mapWithMapToOverride (const class GALGAS_gtlFoldedStackMap & inOperand0
+                                                                                   COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with list of field expressions)
+  public : VIRTUAL_IN_DEBUG void addAssign_operation (const class GALGAS_lstring & inOperand0,
+                                                      const class GALGAS_uint & inOperand1,
+                                                      C_Compiler * inCompiler
+                                                      COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Setters
+  public : VIRTUAL_IN_DEBUG void setter_put (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_uint constinArgument1,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setTimeForKey (class GALGAS_uint constinArgument0,
+                                                       class GALGAS_string constinArgument1,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+
+//--------------------------------- Instance Methods
+  public : VIRTUAL_IN_DEBUG void method_get (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_uint & outArgument1,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) const ;
+
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlFoldedStackMap getter_overriddenMap (C_Compiler * inCompiler
+                                                                                 COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_timeForKey (const class GALGAS_string & constinOperand0,
+                                                                 C_Compiler * inCompiler
+                                                                 COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+  public : VIRTUAL_IN_DEBUG cMapElement_gtlFoldedStackMap * readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                               const GALGAS_string & inKey
+                                                                                               COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Friend
+
+  friend class cEnumerator_gtlFoldedStackMap ;
+ 
+} ; // End of GALGAS_gtlFoldedStackMap class
+
+//---------------------------------------------------------------------------------------------------------------------*
+//   Enumerator declaration                                                                                            *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cEnumerator_gtlFoldedStackMap : public cGenericAbstractEnumerator {
+  public : cEnumerator_gtlFoldedStackMap (const GALGAS_gtlFoldedStackMap & inEnumeratedObject,
+                                          const typeEnumerationOrder inOrder) ;
+
+//--- Current element access
+  public : class GALGAS_lstring current_lkey (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_time (LOCATION_ARGS) const ;
+//--- Current element access
+  public : class GALGAS_gtlFoldedStackMap_2D_element current (LOCATION_ARGS) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlFoldedStackMap ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                    Class for element of '@gtlFoldedStackMap' map                                    *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cMapElement_gtlFoldedStackMap : public cMapElement {
+//--- Map attributes
+  public : GALGAS_uint mProperty_time ;
+
+//--- Constructor
+  public : cMapElement_gtlFoldedStackMap (const GALGAS_lstring & inKey,
+                                          const GALGAS_uint & in_time
+                                          COMMA_LOCATION_ARGS) ;
+
+//--- Virtual method for comparing elements
+  public : virtual typeComparisonResult compare (const cCollectionElement * inOperand) const ;
+
+//--- Virtual method that checks that all attributes are valid
+  public : virtual bool isValid (void) const ;
+
+//--- Virtual method that returns a copy of current object
+  public : virtual cMapElement * copy (void) ;
+
+//--- Description
+ public : virtual void description (C_String & ioString, const int32_t inIndentation) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                        @gtlFoldedStackMap_2D_element struct                                         *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlFoldedStackMap_2D_element : public AC_GALGAS_root {
+//--------------------------------- Properties
+  public : GALGAS_lstring mProperty_lkey ;
+
+  public : GALGAS_uint mProperty_time ;
+
+//--------------------------------- Accessors
+  public : VIRTUAL_IN_DEBUG bool isValid (void) const ;
+  public : VIRTUAL_IN_DEBUG void drop (void) ;
+
+//--------------------------------- Default GALGAS constructor
+  public : static GALGAS_gtlFoldedStackMap_2D_element constructor_default (LOCATION_ARGS) ;
+
+//--------------------------------- Default constructor
+  public : GALGAS_gtlFoldedStackMap_2D_element (void) ;
+
+//--------------------------------- Virtual destructor (in debug mode)
+  public : VIRTUAL_IN_DEBUG ~ GALGAS_gtlFoldedStackMap_2D_element (void) ;
+
+//--------------------------------- Native constructor
+  public : GALGAS_gtlFoldedStackMap_2D_element (const GALGAS_lstring & in_lkey,
+                                                const GALGAS_uint & in_time) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlFoldedStackMap_2D_element extractObject (const GALGAS_object & inObject,
+                                                                     C_Compiler * inCompiler
+                                                                     COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlFoldedStackMap_2D_element constructor_new (const class GALGAS_lstring & inOperand0,
+                                                                             const class GALGAS_uint & inOperand1
+                                                                             COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Implementation of getter 'description'
+  public : VIRTUAL_IN_DEBUG void description (C_String & ioString,
+                                              const int32_t inIndentation) const ;
+//--------------------------------- Comparison
+  public : typeComparisonResult objectCompare (const GALGAS_gtlFoldedStackMap_2D_element & inOperand) const ;
+
+//--------------------------------- Setters
+
+//--------------------------------- Instance Methods
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_lstring getter_lkey (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_time (LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+ 
+} ; // End of GALGAS_gtlFoldedStackMap_2D_element class
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlFoldedStackMap_2D_element ;
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                            @gtlTemplateProfileList list                                             *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlTemplateProfileList : public AC_GALGAS_list {
+//--------------------------------- Default constructor
+  public : GALGAS_gtlTemplateProfileList (void) ;
+
+//--------------------------------- List constructor used by listmap
+  public : GALGAS_gtlTemplateProfileList (const capCollectionElementArray & inSharedArray) ;
+
+//--------------------------------- Element constructor
+  public : static void makeAttributesFromObjects (capCollectionElement & outAttributes,
+                                                  const class GALGAS_string & in_path,
+                                                  const class GALGAS_uint & in_calls,
+                                                  const class GALGAS_uint & in_inclusiveTime,
+                                                  const class GALGAS_uint & in_exclusiveTime,
+                                                  const class GALGAS_uint & in_emittedCharacters
+                                                  COMMA_LOCATION_ARGS) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlTemplateProfileList extractObject (const GALGAS_object & inObject,
+                                                               C_Compiler * inCompiler
+                                                               COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlTemplateProfileList constructor_emptyList (LOCATION_ARGS) ;
+
+  public : static class GALGAS_gtlTemplateProfileList constructor_listWithValue (const class GALGAS_string & inOperand0,
+                                                                                 const class GALGAS_uint & inOperand1,
+                                                                                 const class GALGAS_uint & inOperand2,
+                                                                                 const class GALGAS_uint & inOperand3,
+                                                                                 const class GALGAS_uint & inOperand4
+                                                                                 COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with expression)
+  public : VIRTUAL_IN_DEBUG void plusAssign_operation (const GALGAS_gtlTemplateProfileList inOperand,
+                                                       class C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with list of field expressions)
+  public : VIRTUAL_IN_DEBUG void addAssign_operation (const class GALGAS_string & inOperand0,
+                                                      const class GALGAS_uint & inOperand1,
+                                                      const class GALGAS_uint & inOperand2,
+                                                      const class GALGAS_uint & inOperand3,
+                                                      const class GALGAS_uint & inOperand4
+                                                      COMMA_LOCATION_ARGS) ;
+//--------------------------------- + operator
+  public : VIRTUAL_IN_DEBUG GALGAS_gtlTemplateProfileList add_operation (const GALGAS_gtlTemplateProfileList & inOperand,
+                                                                         C_Compiler * inCompiler
+                                                                         COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Setters
+  public : VIRTUAL_IN_DEBUG void setter_insertAtIndex (class GALGAS_string constinArgument0,
+                                                       class GALGAS_uint constinArgument1,
+                                                       class GALGAS_uint constinArgument2,
+                                                       class GALGAS_uint constinArgument3,
+                                                       class GALGAS_uint constinArgument4,
+                                                       class GALGAS_uint constinArgument5,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_popFirst (class GALGAS_string & outArgument0,
+                                                  class GALGAS_uint & outArgument1,
+                                                  class GALGAS_uint & outArgument2,
+                                                  class GALGAS_uint & outArgument3,
+                                                  class GALGAS_uint & outArgument4,
+                                                  C_Compiler * inCompiler
+                                                  COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_popLast (class GALGAS_string & outArgument0,
+                                                 class GALGAS_uint & outArgument1,
+                                                 class GALGAS_uint & outArgument2,
+                                                 class GALGAS_uint & outArgument3,
+                                                 class GALGAS_uint & outArgument4,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_removeAtIndex (class GALGAS_string & outArgument0,
+                                                       class GALGAS_uint & outArgument1,
+                                                       class GALGAS_uint & outArgument2,
+                                                       class GALGAS_uint & outArgument3,
+                                                       class GALGAS_uint & outArgument4,
+                                                       class GALGAS_uint constinArgument5,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+
+//--------------------------------- Instance Methods
+  public : VIRTUAL_IN_DEBUG void method_first (class GALGAS_string & outArgument0,
+                                               class GALGAS_uint & outArgument1,
+                                               class GALGAS_uint & outArgument2,
+                                               class GALGAS_uint & outArgument3,
+                                               class GALGAS_uint & outArgument4,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG void method_last (class GALGAS_string & outArgument0,
+                                              class GALGAS_uint & outArgument1,
+                                              class GALGAS_uint & outArgument2,
+                                              class GALGAS_uint & outArgument3,
+                                              class GALGAS_uint & outArgument4,
+                                              C_Compiler * inCompiler
+                                              COMMA_LOCATION_ARGS) const ;
+
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_callsAtIndex (const class GALGAS_uint & constinOperand0,
+                                                                   C_Compiler * inCompiler
+                                                                   COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_emittedCharactersAtIndex (const class GALGAS_uint & constinOperand0,
+                                                                               C_Compiler * inCompiler
+                                                                               COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_exclusiveTimeAtIndex (const class GALGAS_uint & constinOperand0,
+                                                                           C_Compiler * inCompiler
+                                                                           COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_inclusiveTimeAtIndex (const class GALGAS_uint & constinOperand0,
+                                                                           C_Compiler * inCompiler
+                                                                           COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_string getter_pathAtIndex (const class GALGAS_uint & constinOperand0,
+                                                                    C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplateProfileList getter_subListFromIndex (const class GALGAS_uint & constinOperand0,
+                                                                                         C_Compiler * inCompiler
+                                                                                         COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplateProfileList getter_subListToIndex (const class GALGAS_uint & constinOperand0,
+                                                                                       C_Compiler * inCompiler
+                                                                                       COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplateProfileList getter_subListWithRange (const class GALGAS_range & constinOperand0,
+                                                                                         C_Compiler * inCompiler
+                                                                                         COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+//--------------------------------- Friend
+
+  friend class cEnumerator_gtlTemplateProfileList ;
+ 
+} ; // End of GALGAS_gtlTemplateProfileList class
+
+//---------------------------------------------------------------------------------------------------------------------*
+//   Enumerator declaration                                                                                            *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cEnumerator_gtlTemplateProfileList : public cGenericAbstractEnumerator {
+  public : cEnumerator_gtlTemplateProfileList (const GALGAS_gtlTemplateProfileList & inEnumeratedObject,
+                                               const typeEnumerationOrder inOrder) ;
+
+//--- Current element access
+  public : class GALGAS_string current_path (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_calls (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_inclusiveTime (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_exclusiveTime (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_emittedCharacters (LOCATION_ARGS) const ;
+//--- Current element access
+  public : class GALGAS_gtlTemplateProfileList_2D_element current (LOCATION_ARGS) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlTemplateProfileList ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                      @gtlTemplateProfileList_2D_element struct                                      *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlTemplateProfileList_2D_element : public AC_GALGAS_root {
+//--------------------------------- Properties
+  public : GALGAS_string mProperty_path ;
+
+  public : GALGAS_uint mProperty_calls ;
+
+  public : GALGAS_uint mProperty_inclusiveTime ;
+
+  public : GALGAS_uint mProperty_exclusiveTime ;
+
+  public : GALGAS_uint mProperty_emittedCharacters ;
+
+//--------------------------------- Accessors
+  public : VIRTUAL_IN_DEBUG bool isValid (void) const ;
+  public : VIRTUAL_IN_DEBUG void drop (void) ;
+
+//--------------------------------- Default GALGAS constructor
+  public : static GALGAS_gtlTemplateProfileList_2D_element constructor_default (LOCATION_ARGS) ;
+
+//--------------------------------- Default constructor
+  public : GALGAS_gtlTemplateProfileList_2D_element (void) ;
+
+//--------------------------------- Virtual destructor (in debug mode)
+  public : VIRTUAL_IN_DEBUG ~ GALGAS_gtlTemplateProfileList_2D_element (void) ;
+
+//--------------------------------- Native constructor
+  public : GALGAS_gtlTemplateProfileList_2D_element (const GALGAS_string & in_path,
+                                                     const GALGAS_uint & in_calls,
+                                                     const GALGAS_uint & in_inclusiveTime,
+                                                     const GALGAS_uint & in_exclusiveTime,
+                                                     const GALGAS_uint & in_emittedCharacters) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlTemplateProfileList_2D_element extractObject (const GALGAS_object & inObject,
+                                                                          C_Compiler * inCompiler
+                                                                          COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlTemplateProfileList_2D_element constructor_new (const class GALGAS_string & inOperand0,
+                                                                                  const class GALGAS_uint & inOperand1,
+                                                                                  const class GALGAS_uint & inOperand2,
+                                                                                  const class GALGAS_uint & inOperand3,
+                                                                                  const class GALGAS_uint & inOperand4
+                                                                                  COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Implementation of getter 'description'
+  public : VIRTUAL_IN_DEBUG void description (C_String & ioString,
+                                              const int32_t inIndentation) const ;
+//--------------------------------- Comparison
+  public : typeComparisonResult objectCompare (const GALGAS_gtlTemplateProfileList_2D_element & inOperand) const ;
+
+//--------------------------------- Setters
+
+//--------------------------------- Instance Methods
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_string getter_path (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_calls (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_inclusiveTime (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_exclusiveTime (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_emittedCharacters (LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+ 
+} ; // End of GALGAS_gtlTemplateProfileList_2D_element class
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlTemplateProfileList_2D_element ;
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                               @gtlTemplatePathMap map                                               *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cMapElement_gtlTemplatePathMap ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const char * kSearchErrorMessage_gtlTemplatePathMap_get ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlTemplatePathMap : public AC_GALGAS_map {
+//--------------------------------- Default constructor
+  public : GALGAS_gtlTemplatePathMap (void) ;
+
+//--------------------------------- Handle copy
+  public : GALGAS_gtlTemplatePathMap (const GALGAS_gtlTemplatePathMap & inSource) ;
+  public : GALGAS_gtlTemplatePathMap & operator = (const GALGAS_gtlTemplatePathMap & inSource) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlTemplatePathMap extractObject (const GALGAS_object & inObject,
+                                                           C_Compiler * inCompiler
+                                                           COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlTemplatePathMap constructor_emptyMap (LOCATION_ARGS) ;
+
+  public : static class GALGAS_gtlTemplatePathMap constructor_mapWithMapToOverride (const class GALGAS_gtlTemplatePathMap & inOperand0
+                                                                                    COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with list of field expressions)
+  public : VIRTUAL_IN_DEBUG void addAssign_operation (const class GALGAS_lstring & inOperand0,
+                                                      const class GALGAS_string & inOperand1,
+                                                      C_Compiler * inCompiler
+                                                      COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Setters
+  public : VIRTUAL_IN_DEBUG void setter_put (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_string constinArgument1,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setFullPathForKey (class GALGAS_string constinArgument0,
+                                                           class GALGAS_string constinArgument1,
+                                                           C_Compiler * inCompiler
+                                                           COMMA_LOCATION_ARGS) ;
+
+
+//--------------------------------- Instance Methods
+  public : VIRTUAL_IN_DEBUG void method_get (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_string & outArgument1,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) const ;
+
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_string getter_fullPathForKey (const class GALGAS_string & constinOperand0,
+                                                                       C_Compiler * inCompiler
+                                                                       COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplatePathMap getter_overriddenMap (C_Compiler * inCompiler
+                                                                                  COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+  public : VIRTUAL_IN_DEBUG cMapElement_gtlTemplatePathMap * readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                                const GALGAS_string & inKey
+                                                                                                COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Friend
+
+  friend class cEnumerator_gtlTemplatePathMap ;
+ 
+} ; // End of GALGAS_gtlTemplatePathMap class
+
+//---------------------------------------------------------------------------------------------------------------------*
+//   Enumerator declaration                                                                                            *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cEnumerator_gtlTemplatePathMap : public cGenericAbstractEnumerator {
+  public : cEnumerator_gtlTemplatePathMap (const GALGAS_gtlTemplatePathMap & inEnumeratedObject,
+                                           const typeEnumerationOrder inOrder) ;
+
+//--- Current element access
+  public : class GALGAS_lstring current_lkey (LOCATION_ARGS) const ;
+  public : class GALGAS_string current_fullPath (LOCATION_ARGS) const ;
+//--- Current element access
+  public : class GALGAS_gtlTemplatePathMap_2D_element current (LOCATION_ARGS) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlTemplatePathMap ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                   Class for element of '@gtlTemplatePathMap' map                                    *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cMapElement_gtlTemplatePathMap : public cMapElement {
+//--- Map attributes
+  public : GALGAS_string mProperty_fullPath ;
+
+//--- Constructor
+  public : cMapElement_gtlTemplatePathMap (const GALGAS_lstring & inKey,
+                                           const GALGAS_string & in_fullPath
+                                           COMMA_LOCATION_ARGS) ;
+
+//--- Virtual method for comparing elements
+  public : virtual typeComparisonResult compare (const cCollectionElement * inOperand) const ;
+
+//--- Virtual method that checks that all attributes are valid
+  public : virtual bool isValid (void) const ;
+
+//--- Virtual method that returns a copy of current object
+  public : virtual cMapElement * copy (void) ;
+
+//--- Description
+ public : virtual void description (C_String & ioString, const int32_t inIndentation) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                        @gtlTemplatePathMap_2D_element struct                                        *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlTemplatePathMap_2D_element : public AC_GALGAS_root {
+//--------------------------------- Properties
+  public : GALGAS_lstring mProperty_lkey ;
+
+  public : GALGAS_string mProperty_fullPath ;
+
+//--------------------------------- Accessors
+  public : VIRTUAL_IN_DEBUG bool isValid (void) const ;
+  public : VIRTUAL_IN_DEBUG void drop (void) ;
+
+//--------------------------------- Default GALGAS constructor
+  public : static GALGAS_gtlTemplatePathMap_2D_element constructor_default (LOCATION_ARGS) ;
+
+//--------------------------------- Default constructor
+  public : GALGAS_gtlTemplatePathMap_2D_element (void) ;
+
+//--------------------------------- Virtual destructor (in debug mode)
+  public : VIRTUAL_IN_DEBUG ~ GALGAS_gtlTemplatePathMap_2D_element (void) ;
+
+//--------------------------------- Native constructor
+  public : GALGAS_gtlTemplatePathMap_2D_element (const GALGAS_lstring & in_lkey,
+                                                 const GALGAS_string & in_fullPath) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlTemplatePathMap_2D_element extractObject (const GALGAS_object & inObject,
+                                                                      C_Compiler * inCompiler
+                                                                      COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlTemplatePathMap_2D_element constructor_new (const class GALGAS_lstring & inOperand0,
+                                                                              const class GALGAS_string & inOperand1
+                                                                              COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Implementation of getter 'description'
+  public : VIRTUAL_IN_DEBUG void description (C_String & ioString,
+                                              const int32_t inIndentation) const ;
+//--------------------------------- Comparison
+  public : typeComparisonResult objectCompare (const GALGAS_gtlTemplatePathMap_2D_element & inOperand) const ;
+
+//--------------------------------- Setters
+
+//--------------------------------- Instance Methods
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_lstring getter_lkey (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_string getter_fullPath (LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+ 
+} ; // End of GALGAS_gtlTemplatePathMap_2D_element class
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlTemplatePathMap_2D_element ;
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                                   @library class                                                    *
@@ -2246,9 +3182,6 @@ class GALGAS_library : public AC_GALGAS_class {
 //--- Constructor
   public : GALGAS_library (void) ;
 
-//--------------------------------- Default GALGAS constructor
-  public : static GALGAS_library constructor_default (LOCATION_ARGS) ;
-
 //---
   public : inline const class cPtr_library * ptr (void) const { return (const cPtr_library *) mObjectPtr ; }
 
@@ -2270,7 +3203,14 @@ class GALGAS_library : public AC_GALGAS_class {
                                                         const class GALGAS_gtlGetterMap & inOperand1,
                                                         const class GALGAS_gtlSetterMap & inOperand2,
                                                         const class GALGAS_gtlTemplateMap & inOperand3,
-                                                        const class GALGAS_stringset & inOperand4
+                                                        const class GALGAS_stringset & inOperand4,
+                                                        const class GALGAS_gtlTemplatePathMap & inOperand5,
+                                                        const class GALGAS_stringset & inOperand6,
+                                                        const class GALGAS_timer & inOperand7,
+                                                        const class GALGAS_uint & inOperand8,
+                                                        const class GALGAS_string & inOperand9,
+                                                        const class GALGAS_gtlTemplateProfileMap & inOperand10,
+                                                        const class GALGAS_gtlFoldedStackMap & inOperand11
                                                         COMMA_LOCATION_ARGS) ;
 
 //--------------------------------- Comparison
@@ -2284,14 +3224,28 @@ class GALGAS_library : public AC_GALGAS_class {
 //--------------------------------- Getters
   public : VIRTUAL_IN_DEBUG class GALGAS_stringset getter_doneImports (LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlFoldedStackMap getter_foldedStacks (LOCATION_ARGS) const ;
+
   public : VIRTUAL_IN_DEBUG class GALGAS_gtlFuncMap getter_funcMap (LOCATION_ARGS) const ;
 
   public : VIRTUAL_IN_DEBUG class GALGAS_gtlGetterMap getter_getterMap (LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG class GALGAS_stringset getter_missingTemplates (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_profileChildTime (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_string getter_profileStack (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_timer getter_profileTimer (LOCATION_ARGS) const ;
+
   public : VIRTUAL_IN_DEBUG class GALGAS_gtlSetterMap getter_setterMap (LOCATION_ARGS) const ;
 
   public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplateMap getter_templateMap (LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplatePathMap getter_templatePaths (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplateProfileMap getter_templateProfiles (LOCATION_ARGS) const ;
+
 
 //--------------------------------- Introspection
   public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
@@ -3170,13 +4124,27 @@ class cPtr_library : public acPtr_class {
   public : GALGAS_gtlSetterMap mProperty_setterMap ;
   public : GALGAS_gtlTemplateMap mProperty_templateMap ;
   public : GALGAS_stringset mProperty_doneImports ;
+  public : GALGAS_gtlTemplatePathMap mProperty_templatePaths ;
+  public : GALGAS_stringset mProperty_missingTemplates ;
+  public : GALGAS_timer mProperty_profileTimer ;
+  public : GALGAS_uint mProperty_profileChildTime ;
+  public : GALGAS_string mProperty_profileStack ;
+  public : GALGAS_gtlTemplateProfileMap mProperty_templateProfiles ;
+  public : GALGAS_gtlFoldedStackMap mProperty_foldedStacks ;
 
 //--- Constructor
   public : cPtr_library (const GALGAS_gtlFuncMap & in_funcMap,
                          const GALGAS_gtlGetterMap & in_getterMap,
                          const GALGAS_gtlSetterMap & in_setterMap,
                          const GALGAS_gtlTemplateMap & in_templateMap,
-                         const GALGAS_stringset & in_doneImports
+                         const GALGAS_stringset & in_doneImports,
+                         const GALGAS_gtlTemplatePathMap & in_templatePaths,
+                         const GALGAS_stringset & in_missingTemplates,
+                         const GALGAS_timer & in_profileTimer,
+                         const GALGAS_uint & in_profileChildTime,
+                         const GALGAS_string & in_profileStack,
+                         const GALGAS_gtlTemplateProfileMap & in_templateProfiles,
+                         const GALGAS_gtlFoldedStackMap & in_foldedStacks
                          COMMA_LOCATION_ARGS) ;
 
 //--- Duplication
@@ -3188,6 +4156,13 @@ class cPtr_library : public acPtr_class {
   public : VIRTUAL_IN_DEBUG GALGAS_gtlSetterMap getter_setterMap (LOCATION_ARGS) const ;
   public : VIRTUAL_IN_DEBUG GALGAS_gtlTemplateMap getter_templateMap (LOCATION_ARGS) const ;
   public : VIRTUAL_IN_DEBUG GALGAS_stringset getter_doneImports (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG GALGAS_gtlTemplatePathMap getter_templatePaths (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG GALGAS_stringset getter_missingTemplates (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG GALGAS_timer getter_profileTimer (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG GALGAS_uint getter_profileChildTime (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG GALGAS_string getter_profileStack (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG GALGAS_gtlTemplateProfileMap getter_templateProfiles (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG GALGAS_gtlFoldedStackMap getter_foldedStacks (LOCATION_ARGS) const ;
 //--- Description
   public : virtual void description (C_String & ioString,
                                      const int32_t inIndentation) const ;
@@ -5191,6 +6166,27 @@ class cPtr_gtlExpression : public acPtr_class {
 
 } ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                      Extension getter '@gtlExpression folded'                                       *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef class GALGAS_gtlExpression (*enterExtensionGetter_gtlExpression_folded) (const class cPtr_gtlExpression * inObject,
+                                                                                 C_Compiler * inCompiler
+                                                                                 COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_folded (const int32_t inClassIndex,
+                                  enterExtensionGetter_gtlExpression_folded inGetter) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlExpression callExtensionGetter_folded (const cPtr_gtlExpression * inObject,
+                                                       class C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                        @gtlExpressionList_2D_element struct                                         *
@@ -10567,6 +11563,8 @@ class GALGAS_type extensionGetter_gtlType (const class GALGAS_lstring & inObject
 
 extern C_BoolCommandLineOption gOption_gtl_5F_options_debug ;
 
+extern C_BoolCommandLineOption gOption_gtl_5F_options_profileTemplates ;
+
 extern C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ;
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -12888,6 +13886,211 @@ class GALGAS_sortingKeyList_2D_element : public AC_GALGAS_root {
 
 extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_sortingKeyList_2D_element ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                               @gtlSortEntryList list                                                *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlSortEntryList : public AC_GALGAS_list {
+//--------------------------------- Default constructor
+  public : GALGAS_gtlSortEntryList (void) ;
+
+//--------------------------------- List constructor used by listmap
+  public : GALGAS_gtlSortEntryList (const capCollectionElementArray & inSharedArray) ;
+
+//--------------------------------- Element constructor
+  public : static void makeAttributesFromObjects (capCollectionElement & outAttributes,
+                                                  const class GALGAS_gtlData & in_value,
+                                                  const class GALGAS_list & in_keys
+                                                  COMMA_LOCATION_ARGS) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlSortEntryList extractObject (const GALGAS_object & inObject,
+                                                         C_Compiler * inCompiler
+                                                         COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlSortEntryList constructor_emptyList (LOCATION_ARGS) ;
+
+  public : static class GALGAS_gtlSortEntryList constructor_listWithValue (const class GALGAS_gtlData & inOperand0,
+                                                                           const class GALGAS_list & inOperand1
+                                                                           COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with expression)
+  public : VIRTUAL_IN_DEBUG void plusAssign_operation (const GALGAS_gtlSortEntryList inOperand,
+                                                       class C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with list of field expressions)
+  public : VIRTUAL_IN_DEBUG void addAssign_operation (const class GALGAS_gtlData & inOperand0,
+                                                      const class GALGAS_list & inOperand1
+                                                      COMMA_LOCATION_ARGS) ;
+//--------------------------------- + operator
+  public : VIRTUAL_IN_DEBUG GALGAS_gtlSortEntryList add_operation (const GALGAS_gtlSortEntryList & inOperand,
+                                                                   C_Compiler * inCompiler
+                                                                   COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Setters
+  public : VIRTUAL_IN_DEBUG void setter_insertAtIndex (class GALGAS_gtlData constinArgument0,
+                                                       class GALGAS_list constinArgument1,
+                                                       class GALGAS_uint constinArgument2,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_popFirst (class GALGAS_gtlData & outArgument0,
+                                                  class GALGAS_list & outArgument1,
+                                                  C_Compiler * inCompiler
+                                                  COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_popLast (class GALGAS_gtlData & outArgument0,
+                                                 class GALGAS_list & outArgument1,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_removeAtIndex (class GALGAS_gtlData & outArgument0,
+                                                       class GALGAS_list & outArgument1,
+                                                       class GALGAS_uint constinArgument2,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+
+//--------------------------------- Instance Methods
+  public : VIRTUAL_IN_DEBUG void method_first (class GALGAS_gtlData & outArgument0,
+                                               class GALGAS_list & outArgument1,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG void method_last (class GALGAS_gtlData & outArgument0,
+                                              class GALGAS_list & outArgument1,
+                                              C_Compiler * inCompiler
+                                              COMMA_LOCATION_ARGS) const ;
+
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_list getter_keysAtIndex (const class GALGAS_uint & constinOperand0,
+                                                                  C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlSortEntryList getter_subListFromIndex (const class GALGAS_uint & constinOperand0,
+                                                                                   C_Compiler * inCompiler
+                                                                                   COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlSortEntryList getter_subListToIndex (const class GALGAS_uint & constinOperand0,
+                                                                                 C_Compiler * inCompiler
+                                                                                 COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlSortEntryList getter_subListWithRange (const class GALGAS_range & constinOperand0,
+                                                                                   C_Compiler * inCompiler
+                                                                                   COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlData getter_valueAtIndex (const class GALGAS_uint & constinOperand0,
+                                                                      C_Compiler * inCompiler
+                                                                      COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+//--------------------------------- Friend
+
+  friend class cEnumerator_gtlSortEntryList ;
+ 
+} ; // End of GALGAS_gtlSortEntryList class
+
+//---------------------------------------------------------------------------------------------------------------------*
+//   Enumerator declaration                                                                                            *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cEnumerator_gtlSortEntryList : public cGenericAbstractEnumerator {
+  public : cEnumerator_gtlSortEntryList (const GALGAS_gtlSortEntryList & inEnumeratedObject,
+                                         const typeEnumerationOrder inOrder) ;
+
+//--- Current element access
+  public : class GALGAS_gtlData current_value (LOCATION_ARGS) const ;
+  public : class GALGAS_list current_keys (LOCATION_ARGS) const ;
+//--- Current element access
+  public : class GALGAS_gtlSortEntryList_2D_element current (LOCATION_ARGS) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlSortEntryList ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                         @gtlSortEntryList_2D_element struct                                         *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlSortEntryList_2D_element : public AC_GALGAS_root {
+//--------------------------------- Properties
+  public : GALGAS_gtlData mProperty_value ;
+
+  public : GALGAS_list mProperty_keys ;
+
+//--------------------------------- Accessors
+  public : VIRTUAL_IN_DEBUG bool isValid (void) const ;
+  public : VIRTUAL_IN_DEBUG void drop (void) ;
+
+//--------------------------------- Default constructor
+  public : GALGAS_gtlSortEntryList_2D_element (void) ;
+
+//--------------------------------- Virtual destructor (in debug mode)
+  public : VIRTUAL_IN_DEBUG ~ GALGAS_gtlSortEntryList_2D_element (void) ;
+
+//--------------------------------- Native constructor
+  public : GALGAS_gtlSortEntryList_2D_element (const GALGAS_gtlData & in_value,
+                                               const GALGAS_list & in_keys) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlSortEntryList_2D_element extractObject (const GALGAS_object & inObject,
+                                                                    C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlSortEntryList_2D_element constructor_new (const class GALGAS_gtlData & inOperand0,
+                                                                            const class GALGAS_list & inOperand1
+                                                                            COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Implementation of getter 'description'
+  public : VIRTUAL_IN_DEBUG void description (C_String & ioString,
+                                              const int32_t inIndentation) const ;
+//--------------------------------- Comparison
+  public : typeComparisonResult objectCompare (const GALGAS_gtlSortEntryList_2D_element & inOperand) const ;
+
+//--------------------------------- Setters
+
+//--------------------------------- Instance Methods
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlData getter_value (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_list getter_keys (LOCATION_ARGS) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+ 
+} ; // End of GALGAS_gtlSortEntryList_2D_element class
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlSortEntryList_2D_element ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                          @gtlAbstractSortInstruction class                                          *
@@ -12966,84 +14169,109 @@ class cPtr_gtlAbstractSortInstruction : public cPtr_gtlInstruction {
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
-//                           Abstract extension getter '@gtlAbstractSortInstruction compare'                           *
+//                          Abstract extension getter '@gtlAbstractSortInstruction sortKeys'                           *
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
-typedef class GALGAS_sint (*enterExtensionGetter_gtlAbstractSortInstruction_compare) (const class cPtr_gtlAbstractSortInstruction * inObject,
-                                                                                      const class GALGAS_gtlData constinArgument0,
-                                                                                      const class GALGAS_gtlData constinArgument1,
-                                                                                      class C_Compiler * inCompiler
-                                                                                      COMMA_LOCATION_ARGS) ;
+typedef class GALGAS_list (*enterExtensionGetter_gtlAbstractSortInstruction_sortKeys) (const class cPtr_gtlAbstractSortInstruction * inObject,
+                                                                                       const class GALGAS_gtlData constinArgument0,
+                                                                                       class C_Compiler * inCompiler
+                                                                                       COMMA_LOCATION_ARGS) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-void enterExtensionGetter_compare (const int32_t inClassIndex,
-                                   enterExtensionGetter_gtlAbstractSortInstruction_compare inMethod) ;
+void enterExtensionGetter_sortKeys (const int32_t inClassIndex,
+                                    enterExtensionGetter_gtlAbstractSortInstruction_sortKeys inMethod) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-class GALGAS_sint callExtensionGetter_compare (const class cPtr_gtlAbstractSortInstruction * inObject,
-                                               const GALGAS_gtlData constin_s_31_,
-                                               const GALGAS_gtlData constin_s_32_,
-                                               C_Compiler * inCompiler
-                                               COMMA_LOCATION_ARGS) ;
+class GALGAS_list callExtensionGetter_sortKeys (const class cPtr_gtlAbstractSortInstruction * inObject,
+                                                const GALGAS_gtlData constin_element,
+                                                C_Compiler * inCompiler
+                                                COMMA_LOCATION_ARGS) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
-//                                 Extension method '@gtlAbstractSortInstruction swap'                                 *
+//                         Abstract extension getter '@gtlAbstractSortInstruction compareKeys'                         *
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
-typedef void (*extensionMethodSignature_gtlAbstractSortInstruction_swap) (const class cPtr_gtlAbstractSortInstruction * inObject,
-                                                                          class GALGAS_list & ioArgument0,
-                                                                          const class GALGAS_uint constinArgument1,
-                                                                          const class GALGAS_uint constinArgument2,
-                                                                          class C_Compiler * inCompiler
-                                                                          COMMA_LOCATION_ARGS) ;
+typedef class GALGAS_sint (*enterExtensionGetter_gtlAbstractSortInstruction_compareKeys) (const class cPtr_gtlAbstractSortInstruction * inObject,
+                                                                                          const class GALGAS_list constinArgument0,
+                                                                                          const class GALGAS_list constinArgument1,
+                                                                                          class C_Compiler * inCompiler
+                                                                                          COMMA_LOCATION_ARGS) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-void enterExtensionMethod_swap (const int32_t inClassIndex,
-                                extensionMethodSignature_gtlAbstractSortInstruction_swap inMethod) ;
+void enterExtensionGetter_compareKeys (const int32_t inClassIndex,
+                                       enterExtensionGetter_gtlAbstractSortInstruction_compareKeys inMethod) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-void callExtensionMethod_swap (const class cPtr_gtlAbstractSortInstruction * inObject,
-                               GALGAS_list & io_aList,
-                               const GALGAS_uint constin_index_31_,
-                               const GALGAS_uint constin_index_32_,
-                               C_Compiler * inCompiler
-                               COMMA_LOCATION_ARGS) ;
+class GALGAS_sint callExtensionGetter_compareKeys (const class cPtr_gtlAbstractSortInstruction * inObject,
+                                                   const GALGAS_list constin_keys_31_,
+                                                   const GALGAS_list constin_keys_32_,
+                                                   C_Compiler * inCompiler
+                                                   COMMA_LOCATION_ARGS) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
-//                              Extension method '@gtlAbstractSortInstruction partition'                               *
+//                             Extension getter '@gtlAbstractSortInstruction compareData'                              *
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
-typedef void (*extensionMethodSignature_gtlAbstractSortInstruction_partition) (const class cPtr_gtlAbstractSortInstruction * inObject,
-                                                                               class GALGAS_list & ioArgument0,
-                                                                               const class GALGAS_uint constinArgument1,
-                                                                               const class GALGAS_uint constinArgument2,
-                                                                               class GALGAS_uint & ioArgument3,
-                                                                               class C_Compiler * inCompiler
-                                                                               COMMA_LOCATION_ARGS) ;
+typedef class GALGAS_sint (*enterExtensionGetter_gtlAbstractSortInstruction_compareData) (const class cPtr_gtlAbstractSortInstruction * inObject,
+                                                                                          const class GALGAS_gtlData constinArgument0,
+                                                                                          const class GALGAS_gtlData constinArgument1,
+                                                                                          const class GALGAS_lsint constinArgument2,
+                                                                                          C_Compiler * inCompiler
+                                                                                          COMMA_LOCATION_ARGS) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-void enterExtensionMethod_partition (const int32_t inClassIndex,
-                                     extensionMethodSignature_gtlAbstractSortInstruction_partition inMethod) ;
+void enterExtensionGetter_compareData (const int32_t inClassIndex,
+                                       enterExtensionGetter_gtlAbstractSortInstruction_compareData inGetter) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-void callExtensionMethod_partition (const class cPtr_gtlAbstractSortInstruction * inObject,
-                                    GALGAS_list & io_aList,
-                                    const GALGAS_uint constin_min,
-                                    const GALGAS_uint constin_max,
-                                    GALGAS_uint & io_pivotIndex,
-                                    C_Compiler * inCompiler
-                                    COMMA_LOCATION_ARGS) ;
+class GALGAS_sint callExtensionGetter_compareData (const cPtr_gtlAbstractSortInstruction * inObject,
+                                                   const GALGAS_gtlData constin_s_31_,
+                                                   const GALGAS_gtlData constin_s_32_,
+                                                   const GALGAS_lsint constin_order,
+                                                   class C_Compiler * inCompiler
+                                                   COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                Extension method '@gtlAbstractSortInstruction merge'                                 *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef void (*extensionMethodSignature_gtlAbstractSortInstruction_merge) (const class cPtr_gtlAbstractSortInstruction * inObject,
+                                                                           const class GALGAS_gtlSortEntryList constinArgument0,
+                                                                           const class GALGAS_uint constinArgument1,
+                                                                           const class GALGAS_uint constinArgument2,
+                                                                           const class GALGAS_uint constinArgument3,
+                                                                           class GALGAS_gtlSortEntryList & ioArgument4,
+                                                                           class C_Compiler * inCompiler
+                                                                           COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionMethod_merge (const int32_t inClassIndex,
+                                 extensionMethodSignature_gtlAbstractSortInstruction_merge inMethod) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionMethod_merge (const class cPtr_gtlAbstractSortInstruction * inObject,
+                                const GALGAS_gtlSortEntryList constin_source,
+                                const GALGAS_uint constin_first,
+                                const GALGAS_uint constin_middle,
+                                const GALGAS_uint constin_last,
+                                GALGAS_gtlSortEntryList & io_merged,
+                                C_Compiler * inCompiler
+                                COMMA_LOCATION_ARGS) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
@@ -13053,8 +14281,6 @@ void callExtensionMethod_partition (const class cPtr_gtlAbstractSortInstruction
 
 typedef void (*extensionMethodSignature_gtlAbstractSortInstruction_sort) (const class cPtr_gtlAbstractSortInstruction * inObject,
                                                                           class GALGAS_list & ioArgument0,
-                                                                          const class GALGAS_uint constinArgument1,
-                                                                          const class GALGAS_uint constinArgument2,
                                                                           class C_Compiler * inCompiler
                                                                           COMMA_LOCATION_ARGS) ;
 
@@ -13067,8 +14293,6 @@ void enterExtensionMethod_sort (const int32_t inClassIndex,
 
 void callExtensionMethod_sort (const class cPtr_gtlAbstractSortInstruction * inObject,
                                GALGAS_list & io_aList,
-                               const GALGAS_uint constin_min,
-                               const GALGAS_uint constin_max,
                                C_Compiler * inCompiler
                                COMMA_LOCATION_ARGS) ;
 
@@ -13162,33 +14386,6 @@ class cPtr_gtlSortStatementStructInstruction : public cPtr_gtlAbstractSortInstru
 
 } ;
 
-//---------------------------------------------------------------------------------------------------------------------*
-//                                                                                                                     *
-//                        Extension getter '@gtlSortStatementStructInstruction compareElements'                        *
-//                                                                                                                     *
-//---------------------------------------------------------------------------------------------------------------------*
-
-typedef class GALGAS_sint (*enterExtensionGetter_gtlSortStatementStructInstruction_compareElements) (const class cPtr_gtlSortStatementStructInstruction * inObject,
-                                                                                                     const class GALGAS_gtlData constinArgument0,
-                                                                                                     const class GALGAS_gtlData constinArgument1,
-                                                                                                     class GALGAS_sortingKeyList inArgument2,
-                                                                                                     C_Compiler * inCompiler
-                                                                                                     COMMA_LOCATION_ARGS) ;
-
-//---------------------------------------------------------------------------------------------------------------------*
-
-void enterExtensionGetter_compareElements (const int32_t inClassIndex,
-                                           enterExtensionGetter_gtlSortStatementStructInstruction_compareElements inGetter) ;
-
-//---------------------------------------------------------------------------------------------------------------------*
-
-class GALGAS_sint callExtensionGetter_compareElements (const cPtr_gtlSortStatementStructInstruction * inObject,
-                                                       const GALGAS_gtlData constin_s_31_,
-                                                       const GALGAS_gtlData constin_s_32_,
-                                                       GALGAS_sortingKeyList in_keyList,
-                                                       class C_Compiler * inCompiler
-                                                       COMMA_LOCATION_ARGS) ;
-
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                      Abstract extension getter '@gtlData bool'                                      *
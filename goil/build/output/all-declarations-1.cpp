@@ -9965,7 +9965,7 @@ void C_Lexique_goil_5F_lexique::enterToken (cTokenFor_goil_5F_lexique & ioToken)
   ptr->mTemplateStringBeforeToken = ioToken.mTemplateStringBeforeToken ;
   ioToken.mTemplateStringBeforeToken = "" ;
   ptr->mLexicalAttribute_a_5F_string = ioToken.mLexicalAttribute_a_5F_string ;
-  ptr->mLexicalAttribute_att_5F_token = ioToken.mLexicalAttribute_att_5F_token ;
+  ptr->mLexicalAttribute_att_5F_token = internedString (ioToken.mLexicalAttribute_att_5F_token) ;
   ptr->mLexicalAttribute_floatNumber = ioToken.mLexicalAttribute_floatNumber ;
   ptr->mLexicalAttribute_integerNumber = ioToken.mLexicalAttribute_integerNumber ;
   ptr->mLexicalAttribute_number = ioToken.mLexicalAttribute_number ;
@@ -5681,37 +5681,34 @@ static void extensionMethod_gtlWriteToInstruction_execute (const cPtr_gtlInstruc
                                                            COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlWriteToInstruction * object = (const cPtr_gtlWriteToInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlWriteToInstruction) ;
-  GALGAS_uint var_currentErrorCount_12230 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 418)) ;
-  GALGAS_string var_fullFileName_12272 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileNameExpression.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 419)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 419)) ;
-  GALGAS_gtlString var_fileName_12351 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 422)), var_fullFileName_12272.getter_lastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 423))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 420)) ;
-  GALGAS_gtlString var_filePath_12454 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 427)), var_fullFileName_12272.getter_nativePathWithUnixPath (SOURCE_FILE ("gtl_instructions.galgas", 428))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 425)) ;
-  GALGAS_string var_result_12559 = GALGAS_string::makeEmptyString () ;
-  GALGAS_gtlData var_varsCopy_12584 = ioArgument_vars ;
+  GALGAS_uint var_currentErrorCount_12366 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 420)) ;
+  GALGAS_string var_fullFileName_12408 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileNameExpression.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 421)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 421)) ;
+  GALGAS_gtlString var_fileName_12487 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 424)), var_fullFileName_12408.getter_lastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 425))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 422)) ;
+  GALGAS_gtlString var_filePath_12590 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 429)), var_fullFileName_12408.getter_nativePathWithUnixPath (SOURCE_FILE ("gtl_instructions.galgas", 430))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 427)) ;
+  GALGAS_string var_result_12695 = GALGAS_string::makeEmptyString () ;
+  GALGAS_gtlData var_varsCopy_12720 = ioArgument_vars ;
   {
-  var_varsCopy_12584.insulate (HERE) ;
-  cPtr_gtlData * ptr_12686 = (cPtr_gtlData *) var_varsCopy_12584.ptr () ;
-  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12686, GALGAS_lstring::constructor_new (GALGAS_string ("FILENAME"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 435)), var_fileName_12351, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 434)) ;
+  var_varsCopy_12720.insulate (HERE) ;
+  cPtr_gtlData * ptr_12822 = (cPtr_gtlData *) var_varsCopy_12720.ptr () ;
+  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12822, GALGAS_lstring::constructor_new (GALGAS_string ("FILENAME"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 437)), var_fileName_12487, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 436)) ;
   }
   {
-  var_varsCopy_12584.insulate (HERE) ;
-  cPtr_gtlData * ptr_12785 = (cPtr_gtlData *) var_varsCopy_12584.ptr () ;
-  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12785, GALGAS_lstring::constructor_new (GALGAS_string ("FILEPATH"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 440)), var_filePath_12454, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 439)) ;
+  var_varsCopy_12720.insulate (HERE) ;
+  cPtr_gtlData * ptr_12921 = (cPtr_gtlData *) var_varsCopy_12720.ptr () ;
+  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12921, GALGAS_lstring::constructor_new (GALGAS_string ("FILEPATH"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 442)), var_filePath_12590, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 441)) ;
   }
-  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, var_currentErrorCount_12230.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 445)))).boolEnum () ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, var_currentErrorCount_12366.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 447)))).boolEnum () ;
   if (kBoolTrue == test_0) {
-    extensionMethod_execute (object->mProperty_instructions, ioArgument_context, var_varsCopy_12584, ioArgument_lib, var_result_12559, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 446)) ;
-    const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, var_currentErrorCount_12230.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 447)))).boolEnum () ;
+    extensionMethod_execute (object->mProperty_instructions, ioArgument_context, var_varsCopy_12720, ioArgument_lib, var_result_12695, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 448)) ;
+    const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, var_currentErrorCount_12366.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 449)))).boolEnum () ;
     if (kBoolTrue == test_1) {
       const enumGalgasBool test_2 = object->mProperty_isExecutable.boolEnum () ;
       if (kBoolTrue == test_2) {
-        GALGAS_string var_directory_13091 = var_fullFileName_12272.getter_stringByDeletingLastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 449)) ;
-        const enumGalgasBool test_3 = GALGAS_bool (kIsNotEqual, var_directory_13091.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
-        if (kBoolTrue == test_3) {
-          var_directory_13091.method_makeDirectory (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 450)) ;
-        }
-        var_result_12559.method_writeToExecutableFile (var_fullFileName_12272, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 451)) ;
+        GALGAS_bool joker_13276 ; // Joker input parameter
+        var_result_12695.method_writeToExecutableFileWhenDifferentContents (var_fullFileName_12408, joker_13276, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 451)) ;
       }else if (kBoolFalse == test_2) {
-        var_result_12559.method_makeDirectoryAndWriteToFile (var_fullFileName_12272, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 453)) ;
+        GALGAS_bool joker_13354 ; // Joker input parameter
+        var_result_12695.method_writeToFileWhenDifferentContents (var_fullFileName_12408, joker_13354, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 453)) ;
       }
     }
   }
@@ -5743,62 +5740,67 @@ static void extensionMethod_gtlTemplateInstruction_execute (const cPtr_gtlInstru
                                                             COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlTemplateInstruction * object = (const cPtr_gtlTemplateInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlTemplateInstruction) ;
-  GALGAS_gtlContext var_newContext_13981 = ioArgument_context ;
+  GALGAS_gtlContext var_newContext_14010 = ioArgument_context ;
   const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_prefix.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 479)))).boolEnum () ;
   if (kBoolTrue == test_0) {
     {
-    var_newContext_13981.setter_setPrefix (object->mProperty_prefix COMMA_SOURCE_FILE ("gtl_instructions.galgas", 480)) ;
+    var_newContext_14010.setter_setPrefix (object->mProperty_prefix COMMA_SOURCE_FILE ("gtl_instructions.galgas", 480)) ;
     }
   }
   GALGAS_gtlString temp_1 ;
-  if (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).isValid ()) {
-    if (NULL != dynamic_cast <const cPtr_gtlString *> (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).ptr ())) {
-      temp_1 = (cPtr_gtlString *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).ptr () ;
+  if (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 487)).isValid ()) {
+    if (NULL != dynamic_cast <const cPtr_gtlString *> (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 487)).ptr ())) {
+      temp_1 = (cPtr_gtlString *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 487)).ptr () ;
     }else{
-      inCompiler->castError ("gtlString", callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)) ;
+      inCompiler->castError ("gtlString", callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 487)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 487)) ;
     }
   }
-  GALGAS_lstring var_templateFileName_14087 = callExtensionGetter_fullTemplateFileName ((const cPtr_gtlContext *) var_newContext_13981.ptr (), ioArgument_context, ioArgument_vars, callExtensionGetter_lstring ((const cPtr_gtlString *) temp_1.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 483)) ;
-  GALGAS_gtlData var_localVars_14238 ;
+  GALGAS_lstring var_templateFileName_14260 ;
+  {
+  ioArgument_lib.insulate (HERE) ;
+  cPtr_library * ptr_14097 = (cPtr_library *) ioArgument_lib.ptr () ;
+  callExtensionSetter_resolveTemplateFileName ((cPtr_library *) ptr_14097, var_newContext_14010, ioArgument_context, ioArgument_vars, callExtensionGetter_lstring ((const cPtr_gtlString *) temp_1.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 487)), var_templateFileName_14260, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 483)) ;
+  }
+  GALGAS_gtlData var_localVars_14288 ;
   {
-  var_newContext_13981.setter_setInputVars (GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 490)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 490)) ;
+  var_newContext_14010.setter_setInputVars (GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 492)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 492)) ;
   }
-  const enumGalgasBool test_2 = object->mProperty_isGlobal.operator_not (SOURCE_FILE ("gtl_instructions.galgas", 491)).boolEnum () ;
+  const enumGalgasBool test_2 = object->mProperty_isGlobal.operator_not (SOURCE_FILE ("gtl_instructions.galgas", 493)).boolEnum () ;
   if (kBoolTrue == test_2) {
-    var_localVars_14238 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 493)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_instructions.galgas", 493))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 493)) ;
-    cEnumerator_gtlExpressionList enumerator_14460 (object->mProperty_arguments, kENUMERATION_UP) ;
-    while (enumerator_14460.hasCurrentObject ()) {
-      GALGAS_gtlData var_evaluedArg_14489 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_14460.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 495)) ;
+    var_localVars_14288 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 495)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_instructions.galgas", 495))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 495)) ;
+    cEnumerator_gtlExpressionList enumerator_14510 (object->mProperty_arguments, kENUMERATION_UP) ;
+    while (enumerator_14510.hasCurrentObject ()) {
+      GALGAS_gtlData var_evaluedArg_14539 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_14510.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 497)) ;
       {
-      var_newContext_13981.insulate (HERE) ;
-      cPtr_gtlContext * ptr_14557 = (cPtr_gtlContext *) var_newContext_13981.ptr () ;
-      callExtensionSetter_addInputVariable ((cPtr_gtlContext *) ptr_14557, var_evaluedArg_14489, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 496)) ;
+      var_newContext_14010.insulate (HERE) ;
+      cPtr_gtlContext * ptr_14607 = (cPtr_gtlContext *) var_newContext_14010.ptr () ;
+      callExtensionSetter_addInputVariable ((cPtr_gtlContext *) ptr_14607, var_evaluedArg_14539, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 498)) ;
       }
-      enumerator_14460.gotoNextObject () ;
+      enumerator_14510.gotoNextObject () ;
     }
   }else if (kBoolFalse == test_2) {
-    var_localVars_14238 = ioArgument_vars ;
+    var_localVars_14288 = ioArgument_vars ;
   }
-  GALGAS_bool var_found_14739 ;
-  GALGAS_gtlTemplate var_result_14764 ;
+  GALGAS_bool var_found_14789 ;
+  GALGAS_gtlTemplate var_result_14814 ;
   {
   ioArgument_lib.insulate (HERE) ;
-  cPtr_library * ptr_14641 = (cPtr_library *) ioArgument_lib.ptr () ;
-  callExtensionSetter_getTemplate ((cPtr_library *) ptr_14641, var_newContext_13981, var_templateFileName_14087, object->mProperty_ifExists, ioArgument_lib, var_found_14739, var_result_14764, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 502)) ;
+  cPtr_library * ptr_14691 = (cPtr_library *) ioArgument_lib.ptr () ;
+  callExtensionSetter_getTemplate ((cPtr_library *) ptr_14691, var_newContext_14010, var_templateFileName_14260, object->mProperty_ifExists, ioArgument_lib, var_found_14789, var_result_14814, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 504)) ;
   }
-  const enumGalgasBool test_3 = var_found_14739.boolEnum () ;
+  const enumGalgasBool test_3 = var_found_14789.boolEnum () ;
   if (kBoolTrue == test_3) {
-    callExtensionMethod_execute ((const cPtr_gtlTemplate *) var_result_14764.ptr (), var_newContext_13981, var_localVars_14238, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 512)) ;
+    callExtensionMethod_execute ((const cPtr_gtlTemplate *) var_result_14814.ptr (), var_newContext_14010, var_localVars_14288, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 514)) ;
   }else if (kBoolFalse == test_3) {
     const enumGalgasBool test_4 = object->mProperty_ifExists.boolEnum () ;
     if (kBoolTrue == test_4) {
-      GALGAS_gtlData var_localMap_14906 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 515)) ;
-      extensionMethod_execute (object->mProperty_instructionsIfNotFound, ioArgument_context, var_localMap_14906, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 516)) ;
-      ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_14906.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 517)) ;
+      GALGAS_gtlData var_localMap_14956 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 517)) ;
+      extensionMethod_execute (object->mProperty_instructionsIfNotFound, ioArgument_context, var_localMap_14956, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 518)) ;
+      ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_14956.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 519)) ;
     }
   }
   {
-  ioArgument_context.setter_setDebuggerContext (var_newContext_13981.getter_debuggerContext (SOURCE_FILE ("gtl_instructions.galgas", 521)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 521)) ;
+  ioArgument_context.setter_setDebuggerContext (var_newContext_14010.getter_debuggerContext (SOURCE_FILE ("gtl_instructions.galgas", 523)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 523)) ;
   }
 }
 
@@ -5828,33 +5830,8 @@ static void extensionMethod_gtlGetColumnInstruction_execute (const cPtr_gtlInstr
                                                              COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlGetColumnInstruction * object = (const cPtr_gtlGetColumnInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlGetColumnInstruction) ;
-  GALGAS_string var_value_15673 = GALGAS_string::makeEmptyString () ;
-  GALGAS_bool var_searchEndOfLine_15702 = GALGAS_bool (true) ;
-  GALGAS_uint var_index_15723 = ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 540)) ;
-  if (ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 541)).isValid ()) {
-    uint32_t variant_15754 = ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 541)).uintValue () ;
-    bool loop_15754 = true ;
-    while (loop_15754) {
-      loop_15754 = GALGAS_bool (kIsStrictSup, var_index_15723.objectCompare (GALGAS_uint ((uint32_t) 0U))).operator_and (var_searchEndOfLine_15702 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 541)).isValid () ;
-      if (loop_15754) {
-        loop_15754 = GALGAS_bool (kIsStrictSup, var_index_15723.objectCompare (GALGAS_uint ((uint32_t) 0U))).operator_and (var_searchEndOfLine_15702 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 541)).boolValue () ;
-      }
-      if (loop_15754 && (0 == variant_15754)) {
-        loop_15754 = false ;
-        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 541)) ;
-      }
-      if (loop_15754) {
-        variant_15754 -- ;
-        var_searchEndOfLine_15702 = GALGAS_bool (kIsNotEqual, ioArgument_outputString.getter_characterAtIndex (var_index_15723.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 542)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 542)).objectCompare (GALGAS_char (TO_UNICODE (10)))) ;
-        var_index_15723.decrement_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 543)) ;
-        const enumGalgasBool test_0 = var_searchEndOfLine_15702.boolEnum () ;
-        if (kBoolTrue == test_0) {
-          var_value_15673.plusAssign_operation(GALGAS_string (" "), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 545)) ;
-        }
-      }
-    }
-  }
-  extensionMethod_set (object->mProperty_destVariable, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 552)), var_value_15673  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 552)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 548)) ;
+  GALGAS_string var_value_15723 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), ioArgument_outputString.getter_currentColumn (SOURCE_FILE ("gtl_instructions.galgas", 542))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 540)) ;
+  extensionMethod_set (object->mProperty_destVariable, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 548)), var_value_15723  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 548)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 544)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5883,44 +5860,44 @@ static void extensionMethod_gtlIfStatementInstruction_execute (const cPtr_gtlIns
                                                                COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlIfStatementInstruction * object = (const cPtr_gtlIfStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlIfStatementInstruction) ;
-  GALGAS_gtlData var_localMap_16684 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 576)) ;
-  GALGAS_bool var_noConditionMatching_16736 = GALGAS_bool (true) ;
-  cEnumerator_gtlThenElsifStatementList enumerator_16769 (object->mProperty_thenElsifList, kENUMERATION_UP) ;
-  bool bool_0 = var_noConditionMatching_16736.isValidAndTrue () ;
-  if (enumerator_16769.hasCurrentObject () && bool_0) {
-    while (enumerator_16769.hasCurrentObject () && bool_0) {
-      GALGAS_gtlData var_dataCondition_16825 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_16769.current_condition (HERE).ptr (), ioArgument_context, var_localMap_16684, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 580)) ;
-      const enumGalgasBool test_1 = GALGAS_bool (var_dataCondition_16825.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlBool).boolEnum () ;
+  GALGAS_gtlData var_localMap_16533 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 572)) ;
+  GALGAS_bool var_noConditionMatching_16585 = GALGAS_bool (true) ;
+  cEnumerator_gtlThenElsifStatementList enumerator_16618 (object->mProperty_thenElsifList, kENUMERATION_UP) ;
+  bool bool_0 = var_noConditionMatching_16585.isValidAndTrue () ;
+  if (enumerator_16618.hasCurrentObject () && bool_0) {
+    while (enumerator_16618.hasCurrentObject () && bool_0) {
+      GALGAS_gtlData var_dataCondition_16674 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_16618.current_condition (HERE).ptr (), ioArgument_context, var_localMap_16533, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 576)) ;
+      const enumGalgasBool test_1 = GALGAS_bool (var_dataCondition_16674.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlBool).boolEnum () ;
       if (kBoolTrue == test_1) {
         GALGAS_gtlBool temp_2 ;
-        if (var_dataCondition_16825.isValid ()) {
-          if (NULL != dynamic_cast <const cPtr_gtlBool *> (var_dataCondition_16825.ptr ())) {
-            temp_2 = (cPtr_gtlBool *) var_dataCondition_16825.ptr () ;
+        if (var_dataCondition_16674.isValid ()) {
+          if (NULL != dynamic_cast <const cPtr_gtlBool *> (var_dataCondition_16674.ptr ())) {
+            temp_2 = (cPtr_gtlBool *) var_dataCondition_16674.ptr () ;
           }else{
-            inCompiler->castError ("gtlBool", var_dataCondition_16825.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 582)) ;
+            inCompiler->castError ("gtlBool", var_dataCondition_16674.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 578)) ;
           }
         }
-        GALGAS_bool var_boolCondition_16935 = temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 582)) ;
-        const enumGalgasBool test_3 = var_boolCondition_16935.boolEnum () ;
+        GALGAS_bool var_boolCondition_16784 = temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 578)) ;
+        const enumGalgasBool test_3 = var_boolCondition_16784.boolEnum () ;
         if (kBoolTrue == test_3) {
-          extensionMethod_execute (enumerator_16769.current_instructionList (HERE), ioArgument_context, var_localMap_16684, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 584)) ;
-          var_noConditionMatching_16736 = GALGAS_bool (false) ;
+          extensionMethod_execute (enumerator_16618.current_instructionList (HERE), ioArgument_context, var_localMap_16533, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 580)) ;
+          var_noConditionMatching_16585 = GALGAS_bool (false) ;
         }
       }else if (kBoolFalse == test_1) {
         TC_Array <C_FixItDescription> fixItArray4 ;
-        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_dataCondition_16825.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 588)), GALGAS_string ("bool expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 588)) ;
+        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_dataCondition_16674.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 584)), GALGAS_string ("bool expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 584)) ;
       }
-      enumerator_16769.gotoNextObject () ;
-      if (enumerator_16769.hasCurrentObject ()) {
-        bool_0 = var_noConditionMatching_16736.isValidAndTrue () ;
+      enumerator_16618.gotoNextObject () ;
+      if (enumerator_16618.hasCurrentObject ()) {
+        bool_0 = var_noConditionMatching_16585.isValidAndTrue () ;
       }
     }
   }
-  const enumGalgasBool test_5 = var_noConditionMatching_16736.boolEnum () ;
+  const enumGalgasBool test_5 = var_noConditionMatching_16585.boolEnum () ;
   if (kBoolTrue == test_5) {
-    extensionMethod_execute (object->mProperty_elseList, ioArgument_context, var_localMap_16684, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 592)) ;
+    extensionMethod_execute (object->mProperty_elseList, ioArgument_context, var_localMap_16533, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 588)) ;
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_16684.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 595)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_16533.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 591)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5949,27 +5926,27 @@ static void extensionMethod_gtlForeachStatementInstruction_execute (const cPtr_g
                                                                     COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlForeachStatementInstruction * object = (const cPtr_gtlForeachStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
-  GALGAS_gtlData var_localMap_20509 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 706)) ;
-  GALGAS_gtlData var_iterableData_20554 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), ioArgument_context, var_localMap_20509, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 707)) ;
-  if (var_iterableData_20554.isValid ()) {
-    if (var_iterableData_20554.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlMap) {
-      GALGAS_gtlMap cast_20647_iterableMap ((cPtr_gtlMap *) var_iterableData_20554.ptr ()) ;
+  GALGAS_gtlData var_localMap_20358 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 702)) ;
+  GALGAS_gtlData var_iterableData_20403 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), ioArgument_context, var_localMap_20358, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 703)) ;
+  if (var_iterableData_20403.isValid ()) {
+    if (var_iterableData_20403.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlMap) {
+      GALGAS_gtlMap cast_20496_iterableMap ((cPtr_gtlMap *) var_iterableData_20403.ptr ()) ;
       const GALGAS_gtlForeachStatementInstruction temp_0 = object ;
-      callExtensionMethod_iterateOnMap ((const cPtr_gtlForeachStatementInstruction *) temp_0.ptr (), ioArgument_context, var_localMap_20509, ioArgument_lib, ioArgument_outputString, cast_20647_iterableMap, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 710)) ;
-    }else if (var_iterableData_20554.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
-      GALGAS_gtlList cast_20759_iterableList ((cPtr_gtlList *) var_iterableData_20554.ptr ()) ;
+      callExtensionMethod_iterateOnMap ((const cPtr_gtlForeachStatementInstruction *) temp_0.ptr (), ioArgument_context, var_localMap_20358, ioArgument_lib, ioArgument_outputString, cast_20496_iterableMap, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 706)) ;
+    }else if (var_iterableData_20403.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
+      GALGAS_gtlList cast_20608_iterableList ((cPtr_gtlList *) var_iterableData_20403.ptr ()) ;
       const GALGAS_gtlForeachStatementInstruction temp_1 = object ;
-      callExtensionMethod_iterateOnList ((const cPtr_gtlForeachStatementInstruction *) temp_1.ptr (), ioArgument_context, var_localMap_20509, ioArgument_lib, ioArgument_outputString, cast_20759_iterableList, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 712)) ;
-    }else if (var_iterableData_20554.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlSet) {
-      GALGAS_gtlSet cast_20872_iterableSet ((cPtr_gtlSet *) var_iterableData_20554.ptr ()) ;
+      callExtensionMethod_iterateOnList ((const cPtr_gtlForeachStatementInstruction *) temp_1.ptr (), ioArgument_context, var_localMap_20358, ioArgument_lib, ioArgument_outputString, cast_20608_iterableList, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 708)) ;
+    }else if (var_iterableData_20403.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlSet) {
+      GALGAS_gtlSet cast_20721_iterableSet ((cPtr_gtlSet *) var_iterableData_20403.ptr ()) ;
       const GALGAS_gtlForeachStatementInstruction temp_2 = object ;
-      callExtensionMethod_iterateOnSet ((const cPtr_gtlForeachStatementInstruction *) temp_2.ptr (), ioArgument_context, var_localMap_20509, ioArgument_lib, ioArgument_outputString, cast_20872_iterableSet, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 714)) ;
+      callExtensionMethod_iterateOnSet ((const cPtr_gtlForeachStatementInstruction *) temp_2.ptr (), ioArgument_context, var_localMap_20358, ioArgument_lib, ioArgument_outputString, cast_20721_iterableSet, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 710)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 716)), GALGAS_string ("Map, list or set expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 716)) ;
+      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 712)), GALGAS_string ("Map, list or set expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 712)) ;
     }
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_20509.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 718)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_20358.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 714)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5998,30 +5975,30 @@ static void extensionMethod_gtlForStatementInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlForStatementInstruction * object = (const cPtr_gtlForStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlForStatementInstruction) ;
-  GALGAS_lstring var_indexName_21616 = GALGAS_lstring::constructor_new (GALGAS_string ("INDEX"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 737)) ;
-  GALGAS_gtlData var_localMap_21660 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 738)) ;
-  cEnumerator_gtlExpressionList enumerator_21702 (object->mProperty_iterable, kENUMERATION_UP) ;
-  GALGAS_uint index_21687 ((uint32_t) 0) ;
-  while (enumerator_21702.hasCurrentObject ()) {
-    GALGAS_gtlData var_value_21734 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_21702.current_expression (HERE).ptr (), ioArgument_context, var_localMap_21660, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 741)) ;
+  GALGAS_lstring var_indexName_21465 = GALGAS_lstring::constructor_new (GALGAS_string ("INDEX"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 733)) ;
+  GALGAS_gtlData var_localMap_21509 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 734)) ;
+  cEnumerator_gtlExpressionList enumerator_21551 (object->mProperty_iterable, kENUMERATION_UP) ;
+  GALGAS_uint index_21536 ((uint32_t) 0) ;
+  while (enumerator_21551.hasCurrentObject ()) {
+    GALGAS_gtlData var_value_21583 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_21551.current_expression (HERE).ptr (), ioArgument_context, var_localMap_21509, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 737)) ;
     {
-    var_localMap_21660.insulate (HERE) ;
-    cPtr_gtlData * ptr_21794 = (cPtr_gtlData *) var_localMap_21660.ptr () ;
-    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21794, object->mProperty_identifier, var_value_21734, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 742)) ;
+    var_localMap_21509.insulate (HERE) ;
+    cPtr_gtlData * ptr_21643 = (cPtr_gtlData *) var_localMap_21509.ptr () ;
+    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21643, object->mProperty_identifier, var_value_21583, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 738)) ;
     }
     {
-    var_localMap_21660.insulate (HERE) ;
-    cPtr_gtlData * ptr_21845 = (cPtr_gtlData *) var_localMap_21660.ptr () ;
-    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21845, var_indexName_21616, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 745)), index_21687.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 745))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 745)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 743)) ;
+    var_localMap_21509.insulate (HERE) ;
+    cPtr_gtlData * ptr_21694 = (cPtr_gtlData *) var_localMap_21509.ptr () ;
+    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21694, var_indexName_21465, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 741)), index_21536.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 741))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 741)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 739)) ;
     }
-    extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_21660, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 747)) ;
-    if (enumerator_21702.hasNextObject ()) {
-      extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_21660, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 749)) ;
+    extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_21509, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 743)) ;
+    if (enumerator_21551.hasNextObject ()) {
+      extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_21509, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 745)) ;
     }
-    enumerator_21702.gotoNextObject () ;
-    index_21687.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 739)) ;
+    enumerator_21551.gotoNextObject () ;
+    index_21536.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 735)) ;
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_21660.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 751)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_21509.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 747)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6050,98 +6027,98 @@ static void extensionMethod_gtlLoopStatementInstruction_execute (const cPtr_gtlI
                                                                  COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLoopStatementInstruction * object = (const cPtr_gtlLoopStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLoopStatementInstruction) ;
-  GALGAS_gtlData var_localMap_22830 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 775)) ;
-  GALGAS_gtlData var_startData_22872 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), ioArgument_context, var_localMap_22830, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 776)) ;
-  GALGAS_gtlData var_stopData_22931 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), ioArgument_context, var_localMap_22830, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 777)) ;
-  GALGAS_gtlData var_stepData_22991 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), ioArgument_context, var_localMap_22830, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 778)) ;
-  GALGAS_bigint var_startVal_23050 ;
-  GALGAS_bigint var_stopVal_23068 ;
-  GALGAS_bigint var_stepVal_23086 ;
-  const enumGalgasBool test_0 = GALGAS_bool (var_startData_22872.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
+  GALGAS_gtlData var_localMap_22679 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 771)) ;
+  GALGAS_gtlData var_startData_22721 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), ioArgument_context, var_localMap_22679, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 772)) ;
+  GALGAS_gtlData var_stopData_22780 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), ioArgument_context, var_localMap_22679, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 773)) ;
+  GALGAS_gtlData var_stepData_22840 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), ioArgument_context, var_localMap_22679, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 774)) ;
+  GALGAS_bigint var_startVal_22899 ;
+  GALGAS_bigint var_stopVal_22917 ;
+  GALGAS_bigint var_stepVal_22935 ;
+  const enumGalgasBool test_0 = GALGAS_bool (var_startData_22721.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
   if (kBoolTrue == test_0) {
     GALGAS_gtlInt temp_1 ;
-    if (var_startData_22872.isValid ()) {
-      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_startData_22872.ptr ())) {
-        temp_1 = (cPtr_gtlInt *) var_startData_22872.ptr () ;
+    if (var_startData_22721.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_startData_22721.ptr ())) {
+        temp_1 = (cPtr_gtlInt *) var_startData_22721.ptr () ;
       }else{
-        inCompiler->castError ("gtlInt", var_startData_22872.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 783)) ;
+        inCompiler->castError ("gtlInt", var_startData_22721.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 779)) ;
       }
     }
-    var_startVal_23050 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 783)) ;
+    var_startVal_22899 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 779)) ;
   }else if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 785)), GALGAS_string ("int expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 785)) ;
-    var_startVal_23050.drop () ; // Release error dropped variable
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 781)), GALGAS_string ("int expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 781)) ;
+    var_startVal_22899.drop () ; // Release error dropped variable
   }
-  const enumGalgasBool test_3 = GALGAS_bool (var_stopData_22931.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
+  const enumGalgasBool test_3 = GALGAS_bool (var_stopData_22780.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
   if (kBoolTrue == test_3) {
     GALGAS_gtlInt temp_4 ;
-    if (var_stopData_22931.isValid ()) {
-      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_stopData_22931.ptr ())) {
-        temp_4 = (cPtr_gtlInt *) var_stopData_22931.ptr () ;
+    if (var_stopData_22780.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_stopData_22780.ptr ())) {
+        temp_4 = (cPtr_gtlInt *) var_stopData_22780.ptr () ;
       }else{
-        inCompiler->castError ("gtlInt", var_stopData_22931.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 788)) ;
+        inCompiler->castError ("gtlInt", var_stopData_22780.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 784)) ;
       }
     }
-    var_stopVal_23068 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 788)) ;
+    var_stopVal_22917 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 784)) ;
   }else if (kBoolFalse == test_3) {
     TC_Array <C_FixItDescription> fixItArray5 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 790)), GALGAS_string ("int expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 790)) ;
-    var_stopVal_23068.drop () ; // Release error dropped variable
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 786)), GALGAS_string ("int expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 786)) ;
+    var_stopVal_22917.drop () ; // Release error dropped variable
   }
-  const enumGalgasBool test_6 = GALGAS_bool (var_stepData_22991.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
+  const enumGalgasBool test_6 = GALGAS_bool (var_stepData_22840.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
   if (kBoolTrue == test_6) {
     GALGAS_gtlInt temp_7 ;
-    if (var_stepData_22991.isValid ()) {
-      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_stepData_22991.ptr ())) {
-        temp_7 = (cPtr_gtlInt *) var_stepData_22991.ptr () ;
+    if (var_stepData_22840.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_stepData_22840.ptr ())) {
+        temp_7 = (cPtr_gtlInt *) var_stepData_22840.ptr () ;
       }else{
-        inCompiler->castError ("gtlInt", var_stepData_22991.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 793)) ;
+        inCompiler->castError ("gtlInt", var_stepData_22840.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 789)) ;
       }
     }
-    var_stepVal_23086 = temp_7.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 793)).multiply_operation (object->mProperty_upDown.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 793)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 793)) ;
+    var_stepVal_22935 = temp_7.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 789)).multiply_operation (object->mProperty_upDown.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 789)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 789)) ;
   }else if (kBoolFalse == test_6) {
     TC_Array <C_FixItDescription> fixItArray8 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 795)), GALGAS_string ("int expected"), fixItArray8  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 795)) ;
-    var_stepVal_23086.drop () ; // Release error dropped variable
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 791)), GALGAS_string ("int expected"), fixItArray8  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 791)) ;
+    var_stepVal_22935.drop () ; // Release error dropped variable
   }
-  GALGAS_bigint var_direction_23548 = GALGAS_bigint ("1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 797)) ;
-  const enumGalgasBool test_9 = GALGAS_bool (kIsStrictInf, var_stepVal_23086.objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 798)))).boolEnum () ;
+  GALGAS_bigint var_direction_23397 = GALGAS_bigint ("1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 793)) ;
+  const enumGalgasBool test_9 = GALGAS_bool (kIsStrictInf, var_stepVal_22935.objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 794)))).boolEnum () ;
   if (kBoolTrue == test_9) {
-    var_direction_23548 = GALGAS_bigint ("-1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 798)) ;
+    var_direction_23397 = GALGAS_bigint ("-1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 794)) ;
   }
-  const enumGalgasBool test_10 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23068.substract_operation (var_startVal_23050, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 799)).multiply_operation (var_direction_23548, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 799)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 799)))).boolEnum () ;
+  const enumGalgasBool test_10 = GALGAS_bool (kIsSupOrEqual, var_stopVal_22917.substract_operation (var_startVal_22899, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 795)).multiply_operation (var_direction_23397, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 795)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 795)))).boolEnum () ;
   if (kBoolTrue == test_10) {
-    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, var_localMap_22830, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 800)) ;
-    GALGAS_uint var_count_23732 = var_stopVal_23068.substract_operation (var_startVal_23050, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)).multiply_operation (var_direction_23548, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)).add_operation (GALGAS_sint_36__34_ ((int64_t) 1LL).getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 801)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)) ;
-    if (var_count_23732.isValid ()) {
-      uint32_t variant_23789 = var_count_23732.uintValue () ;
-      bool loop_23789 = true ;
-      while (loop_23789) {
+    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, var_localMap_22679, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 796)) ;
+    GALGAS_uint var_count_23581 = var_stopVal_22917.substract_operation (var_startVal_22899, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 797)).multiply_operation (var_direction_23397, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 797)).add_operation (GALGAS_sint_36__34_ ((int64_t) 1LL).getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 797)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 797)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 797)) ;
+    if (var_count_23581.isValid ()) {
+      uint32_t variant_23638 = var_count_23581.uintValue () ;
+      bool loop_23638 = true ;
+      while (loop_23638) {
           {
-          var_localMap_22830.insulate (HERE) ;
-          cPtr_gtlData * ptr_23815 = (cPtr_gtlData *) var_localMap_22830.ptr () ;
-          callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_23815, object->mProperty_identifier, GALGAS_gtlInt::constructor_new (object->mProperty_identifier.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 805)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)), var_startVal_23050  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 803)) ;
+          var_localMap_22679.insulate (HERE) ;
+          cPtr_gtlData * ptr_23664 = (cPtr_gtlData *) var_localMap_22679.ptr () ;
+          callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_23664, object->mProperty_identifier, GALGAS_gtlInt::constructor_new (object->mProperty_identifier.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 801)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)), var_startVal_22899  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 799)) ;
           }
-          extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_22830, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 807)) ;
-          var_startVal_23050 = var_startVal_23050.add_operation (var_stepVal_23086, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 808)) ;
-        loop_23789 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23068.substract_operation (var_startVal_23050, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).multiply_operation (var_direction_23548, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)))).isValid () ;
-        if (loop_23789) {
-          loop_23789 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23068.substract_operation (var_startVal_23050, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).multiply_operation (var_direction_23548, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)))).boolValue () ;
+          extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_22679, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 803)) ;
+          var_startVal_22899 = var_startVal_22899.add_operation (var_stepVal_22935, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 804)) ;
+        loop_23638 = GALGAS_bool (kIsSupOrEqual, var_stopVal_22917.substract_operation (var_startVal_22899, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)).multiply_operation (var_direction_23397, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)))).isValid () ;
+        if (loop_23638) {
+          loop_23638 = GALGAS_bool (kIsSupOrEqual, var_stopVal_22917.substract_operation (var_startVal_22899, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)).multiply_operation (var_direction_23397, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)))).boolValue () ;
         }
-        if (loop_23789 && (0 == variant_23789)) {
-          loop_23789 = false ;
-          inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 802)) ;
+        if (loop_23638 && (0 == variant_23638)) {
+          loop_23638 = false ;
+          inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 798)) ;
         }
-        if (loop_23789) {
-          variant_23789 -- ;
-          extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_22830, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 810)) ;
+        if (loop_23638) {
+          variant_23638 -- ;
+          extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_22679, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 806)) ;
         }
       }
     }
-    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, var_localMap_22830, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 812)) ;
+    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, var_localMap_22679, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 808)) ;
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_22830.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 814)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_22679.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 810)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6170,62 +6147,62 @@ static void extensionMethod_gtlRepeatStatementInstruction_execute (const cPtr_gt
                                                                    COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlRepeatStatementInstruction * object = (const cPtr_gtlRepeatStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlRepeatStatementInstruction) ;
-  GALGAS_gtlData var_localMap_24828 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 833)) ;
-  GALGAS_bool var_boolCondition_24871 = GALGAS_bool (false) ;
-  GALGAS_gtlData var_limitData_24900 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 835)) ;
-  GALGAS_uint var_limitVal_24952 ;
-  const enumGalgasBool test_0 = GALGAS_bool (var_limitData_24900.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
+  GALGAS_gtlData var_localMap_24677 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 829)) ;
+  GALGAS_bool var_boolCondition_24720 = GALGAS_bool (false) ;
+  GALGAS_gtlData var_limitData_24749 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 831)) ;
+  GALGAS_uint var_limitVal_24801 ;
+  const enumGalgasBool test_0 = GALGAS_bool (var_limitData_24749.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
   if (kBoolTrue == test_0) {
     GALGAS_gtlInt temp_1 ;
-    if (var_limitData_24900.isValid ()) {
-      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_limitData_24900.ptr ())) {
-        temp_1 = (cPtr_gtlInt *) var_limitData_24900.ptr () ;
+    if (var_limitData_24749.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_limitData_24749.ptr ())) {
+        temp_1 = (cPtr_gtlInt *) var_limitData_24749.ptr () ;
       }else{
-        inCompiler->castError ("gtlInt", var_limitData_24900.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 839)) ;
+        inCompiler->castError ("gtlInt", var_limitData_24749.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 835)) ;
       }
     }
-    var_limitVal_24952 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 839)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 839)) ;
+    var_limitVal_24801 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 835)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 835)) ;
   }else if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 841)), GALGAS_string ("int exprected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 841)) ;
-    var_limitVal_24952.drop () ; // Release error dropped variable
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 837)), GALGAS_string ("int exprected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 837)) ;
+    var_limitVal_24801.drop () ; // Release error dropped variable
   }
-  if (var_limitVal_24952.isValid ()) {
-    uint32_t variant_25108 = var_limitVal_24952.uintValue () ;
-    bool loop_25108 = true ;
-    while (loop_25108) {
-        extensionMethod_execute (object->mProperty_continueList, ioArgument_context, var_localMap_24828, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 845)) ;
-        GALGAS_gtlData var_conditionData_25215 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_condition.ptr (), ioArgument_context, var_localMap_24828, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 846)) ;
-        const enumGalgasBool test_3 = GALGAS_bool (kIsEqual, var_conditionData_25215.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 847)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlBool))).boolEnum () ;
+  if (var_limitVal_24801.isValid ()) {
+    uint32_t variant_24957 = var_limitVal_24801.uintValue () ;
+    bool loop_24957 = true ;
+    while (loop_24957) {
+        extensionMethod_execute (object->mProperty_continueList, ioArgument_context, var_localMap_24677, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 841)) ;
+        GALGAS_gtlData var_conditionData_25064 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_condition.ptr (), ioArgument_context, var_localMap_24677, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 842)) ;
+        const enumGalgasBool test_3 = GALGAS_bool (kIsEqual, var_conditionData_25064.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 843)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlBool))).boolEnum () ;
         if (kBoolTrue == test_3) {
           GALGAS_gtlBool temp_4 ;
-          if (var_conditionData_25215.isValid ()) {
-            if (NULL != dynamic_cast <const cPtr_gtlBool *> (var_conditionData_25215.ptr ())) {
-              temp_4 = (cPtr_gtlBool *) var_conditionData_25215.ptr () ;
+          if (var_conditionData_25064.isValid ()) {
+            if (NULL != dynamic_cast <const cPtr_gtlBool *> (var_conditionData_25064.ptr ())) {
+              temp_4 = (cPtr_gtlBool *) var_conditionData_25064.ptr () ;
             }else{
-              inCompiler->castError ("gtlBool", var_conditionData_25215.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 848)) ;
+              inCompiler->castError ("gtlBool", var_conditionData_25064.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 844)) ;
             }
           }
-          var_boolCondition_24871 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 848)) ;
+          var_boolCondition_24720 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 844)) ;
         }else if (kBoolFalse == test_3) {
           TC_Array <C_FixItDescription> fixItArray5 ;
-          inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_conditionData_25215.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 850)), GALGAS_string ("bool expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 850)) ;
+          inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_conditionData_25064.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 846)), GALGAS_string ("bool expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 846)) ;
         }
-      loop_25108 = var_boolCondition_24871.isValid () ;
-      if (loop_25108) {
-        loop_25108 = var_boolCondition_24871.boolValue () ;
+      loop_24957 = var_boolCondition_24720.isValid () ;
+      if (loop_24957) {
+        loop_24957 = var_boolCondition_24720.boolValue () ;
       }
-      if (loop_25108 && (0 == variant_25108)) {
-        loop_25108 = false ;
-        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 844)) ;
+      if (loop_24957 && (0 == variant_24957)) {
+        loop_24957 = false ;
+        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 840)) ;
       }
-      if (loop_25108) {
-        variant_25108 -- ;
-        extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_24828, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 853)) ;
+      if (loop_24957) {
+        variant_24957 -- ;
+        extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_24677, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 849)) ;
       }
     }
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_24828.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 855)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_24677.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 851)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6254,32 +6231,32 @@ static void extensionMethod_gtlErrorStatementInstruction_execute (const cPtr_gtl
                                                                   COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlErrorStatementInstruction * object = (const cPtr_gtlErrorStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlErrorStatementInstruction) ;
-  GALGAS_location var_errorLocation_26096 ;
+  GALGAS_location var_errorLocation_25945 ;
   const enumGalgasBool test_0 = object->mProperty_hereInstead.boolEnum () ;
   if (kBoolTrue == test_0) {
-    var_errorLocation_26096 = object->mProperty_where ;
+    var_errorLocation_25945 = object->mProperty_where ;
   }else if (kBoolFalse == test_0) {
-    var_errorLocation_26096 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 877)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 877)) ;
+    var_errorLocation_25945 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 873)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 873)) ;
   }
-  GALGAS_gtlData var_errorMessageData_26251 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 879)) ;
-  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, var_errorMessageData_26251.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 880)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
+  GALGAS_gtlData var_errorMessageData_26100 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 875)) ;
+  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, var_errorMessageData_26100.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 876)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
   if (kBoolTrue == test_1) {
     GALGAS_gtlString temp_2 ;
-    if (var_errorMessageData_26251.isValid ()) {
-      if (NULL != dynamic_cast <const cPtr_gtlString *> (var_errorMessageData_26251.ptr ())) {
-        temp_2 = (cPtr_gtlString *) var_errorMessageData_26251.ptr () ;
+    if (var_errorMessageData_26100.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlString *> (var_errorMessageData_26100.ptr ())) {
+        temp_2 = (cPtr_gtlString *) var_errorMessageData_26100.ptr () ;
       }else{
-        inCompiler->castError ("gtlString", var_errorMessageData_26251.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)) ;
+        inCompiler->castError ("gtlString", var_errorMessageData_26100.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 877)) ;
       }
     }
     TC_Array <C_FixItDescription> fixItArray3 ;
-    inCompiler->emitSemanticError (var_errorLocation_26096, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 881)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)) ;
+    inCompiler->emitSemanticError (var_errorLocation_25945, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 877)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 877)) ;
     {
-    ioArgument_context.setter_setPropagateError (GALGAS_bool (false) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 882)) ;
+    ioArgument_context.setter_setPropagateError (GALGAS_bool (false) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 878)) ;
     }
   }else if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 884)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 884)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 880)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 880)) ;
   }
 }
 
@@ -6309,29 +6286,29 @@ static void extensionMethod_gtlWarningStatementInstruction_execute (const cPtr_g
                                                                     COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlWarningStatementInstruction * object = (const cPtr_gtlWarningStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlWarningStatementInstruction) ;
-  GALGAS_location var_warningLocation_27072 ;
+  GALGAS_location var_warningLocation_26921 ;
   const enumGalgasBool test_0 = object->mProperty_hereInstead.boolEnum () ;
   if (kBoolTrue == test_0) {
-    var_warningLocation_27072 = object->mProperty_where ;
+    var_warningLocation_26921 = object->mProperty_where ;
   }else if (kBoolFalse == test_0) {
-    var_warningLocation_27072 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 907)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 907)) ;
+    var_warningLocation_26921 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 903)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 903)) ;
   }
-  GALGAS_gtlData var_warningMessageData_27233 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 909)) ;
-  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, var_warningMessageData_27233.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 910)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
+  GALGAS_gtlData var_warningMessageData_27082 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 905)) ;
+  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, var_warningMessageData_27082.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 906)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
   if (kBoolTrue == test_1) {
     GALGAS_gtlString temp_2 ;
-    if (var_warningMessageData_27233.isValid ()) {
-      if (NULL != dynamic_cast <const cPtr_gtlString *> (var_warningMessageData_27233.ptr ())) {
-        temp_2 = (cPtr_gtlString *) var_warningMessageData_27233.ptr () ;
+    if (var_warningMessageData_27082.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlString *> (var_warningMessageData_27082.ptr ())) {
+        temp_2 = (cPtr_gtlString *) var_warningMessageData_27082.ptr () ;
       }else{
-        inCompiler->castError ("gtlString", var_warningMessageData_27233.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 911)) ;
+        inCompiler->castError ("gtlString", var_warningMessageData_27082.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 907)) ;
       }
     }
     TC_Array <C_FixItDescription> fixItArray3 ;
-    inCompiler->emitSemanticWarning (var_warningLocation_27072, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 911)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 911)) ;
+    inCompiler->emitSemanticWarning (var_warningLocation_26921, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 907)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 907)) ;
   }else if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 913)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 913)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 909)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 909)) ;
   }
 }
 
@@ -6361,11 +6338,11 @@ static void extensionMethod_gtlPrintStatementInstruction_execute (const cPtr_gtl
                                                                   COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlPrintStatementInstruction * object = (const cPtr_gtlPrintStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlPrintStatementInstruction) ;
-  GALGAS_string var_messageToPrintString_27996 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_messageToPrint.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 932)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 932)) ;
-  inCompiler->printMessage (var_messageToPrintString_27996  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 933)) ;
+  GALGAS_string var_messageToPrintString_27845 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_messageToPrint.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 928)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 928)) ;
+  inCompiler->printMessage (var_messageToPrintString_27845  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 929)) ;
   const enumGalgasBool test_0 = object->mProperty_carriageReturn.boolEnum () ;
   if (kBoolTrue == test_0) {
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 934)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 930)) ;
   }
 }
 
@@ -6395,8 +6372,8 @@ static void extensionMethod_gtlDisplayStatementInstruction_execute (const cPtr_g
                                                                     COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlDisplayStatementInstruction * object = (const cPtr_gtlDisplayStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlDisplayStatementInstruction) ;
-  GALGAS_gtlData var_variable_28605 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 950)) ;
-  inCompiler->printMessage (extensionGetter_stringPath (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)).add_operation (GALGAS_string (" from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)).add_operation (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) var_variable_28605.ptr (), GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 953)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)) ;
+  GALGAS_gtlData var_variable_28454 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 946)) ;
+  inCompiler->printMessage (extensionGetter_stringPath (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 947)).add_operation (GALGAS_string (" from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 947)).add_operation (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 948)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 948)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 948)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) var_variable_28454.ptr (), GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 949)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 948))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 947)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6425,23 +6402,22 @@ static void extensionMethod_gtlAbstractSortInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlAbstractSortInstruction * object = (const cPtr_gtlAbstractSortInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlAbstractSortInstruction) ;
-  GALGAS_gtlData var_variable_30530 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1024)) ;
-  if (var_variable_30530.isValid ()) {
-    if (var_variable_30530.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
-      GALGAS_gtlList cast_30619_variableList ((cPtr_gtlList *) var_variable_30530.ptr ()) ;
-      GALGAS_list var_listToSort_30641 = cast_30619_variableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1027)) ;
-      GALGAS_uint var_length_30681 = var_listToSort_30641.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1028)) ;
-      const enumGalgasBool test_0 = GALGAS_bool (kIsStrictSup, var_length_30681.objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+  GALGAS_gtlData var_variable_32154 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1076)) ;
+  if (var_variable_32154.isValid ()) {
+    if (var_variable_32154.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
+      GALGAS_gtlList cast_32243_variableList ((cPtr_gtlList *) var_variable_32154.ptr ()) ;
+      GALGAS_list var_listToSort_32265 = cast_32243_variableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1079)) ;
+      const enumGalgasBool test_0 = GALGAS_bool (kIsStrictSup, var_listToSort_32265.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1080)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
       if (kBoolTrue == test_0) {
         const GALGAS_gtlAbstractSortInstruction temp_1 = object ;
-        callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_1.ptr (), var_listToSort_30641, GALGAS_uint ((uint32_t) 0U), var_length_30681.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1030)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1030)) ;
+        callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_1.ptr (), var_listToSort_32265, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1081)) ;
       }
-      extensionMethod_set (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1036)), var_listToSort_30641  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1036)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1032)) ;
+      extensionMethod_set (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1087)), var_listToSort_32265  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1087)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1083)) ;
     }else{
-      GALGAS_gtlVarItem var_lastComponent_30966 ;
-      object->mProperty_variablePath.method_last (var_lastComponent_30966, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1039)) ;
+      GALGAS_gtlVarItem var_lastComponent_32547 ;
+      object->mProperty_variablePath.method_last (var_lastComponent_32547, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1090)) ;
       TC_Array <C_FixItDescription> fixItArray2 ;
-      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVarItem *) var_lastComponent_30966.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1040)), GALGAS_string ("list expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1040)) ;
+      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVarItem *) var_lastComponent_32547.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1091)), GALGAS_string ("list expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1091)) ;
     }
   }
 }
@@ -6459,20 +6435,120 @@ C_PrologueEpilogue gMethod_gtlAbstractSortInstruction_execute (defineExtensionMe
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
-//                      Overriding extension getter '@gtlSortStatementStructInstruction compare'                       *
+//                      Overriding extension getter '@gtlSortStatementStructInstruction sortKeys'                      *
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
-static GALGAS_sint extensionGetter_gtlSortStatementStructInstruction_compare (const cPtr_gtlAbstractSortInstruction * inObject,
-                                                                              const GALGAS_gtlData constinArgument_s_31_,
-                                                                              const GALGAS_gtlData constinArgument_s_32_,
-                                                                              C_Compiler * inCompiler
-                                                                              COMMA_UNUSED_LOCATION_ARGS) {
+static GALGAS_list extensionGetter_gtlSortStatementStructInstruction_sortKeys (const cPtr_gtlAbstractSortInstruction * inObject,
+                                                                               const GALGAS_gtlData constinArgument_element,
+                                                                               C_Compiler * inCompiler
+                                                                               COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_list result_result ; // Returned variable
+  const cPtr_gtlSortStatementStructInstruction * object = (const cPtr_gtlSortStatementStructInstruction *) inObject ;
+  macroValidSharedObject (object, cPtr_gtlSortStatementStructInstruction) ;
+  result_result = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 1104)) ;
+  const enumGalgasBool test_0 = GALGAS_bool (constinArgument_element.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    GALGAS_gtlStruct temp_1 ;
+    if (constinArgument_element.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlStruct *> (constinArgument_element.ptr ())) {
+        temp_1 = (cPtr_gtlStruct *) constinArgument_element.ptr () ;
+      }else{
+        inCompiler->castError ("gtlStruct", constinArgument_element.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1106)) ;
+      }
+    }
+    GALGAS_gtlStruct var_elementStruct_32979 = temp_1 ;
+    cEnumerator_sortingKeyList enumerator_33028 (object->mProperty_sortingKey, kENUMERATION_UP) ;
+    while (enumerator_33028.hasCurrentObject ()) {
+      GALGAS_gtlData var_elementField_33092 ;
+      var_elementStruct_32979.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1108)).method_get (enumerator_33028.current_key (HERE), var_elementField_33092, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1108)) ;
+      result_result.addAssign_operation (var_elementField_33092  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1109)) ;
+      enumerator_33028.gotoNextObject () ;
+    }
+  }else if (kBoolFalse == test_0) {
+    TC_Array <C_FixItDescription> fixItArray2 ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) constinArgument_element.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1112)), GALGAS_string ("struct expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1112)) ;
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlSortStatementStructInstruction_sortKeys (void) {
+  enterExtensionGetter_sortKeys (kTypeDescriptor_GALGAS_gtlSortStatementStructInstruction.mSlotID,
+                                 extensionGetter_gtlSortStatementStructInstruction_sortKeys) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlSortStatementStructInstruction_sortKeys (defineExtensionGetter_gtlSortStatementStructInstruction_sortKeys, NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                    Overriding extension getter '@gtlSortStatementStructInstruction compareKeys'                     *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_sint extensionGetter_gtlSortStatementStructInstruction_compareKeys (const cPtr_gtlAbstractSortInstruction * inObject,
+                                                                                  const GALGAS_list constinArgument_keys_31_,
+                                                                                  const GALGAS_list constinArgument_keys_32_,
+                                                                                  C_Compiler * inCompiler
+                                                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_sint result_result ; // Returned variable
   const cPtr_gtlSortStatementStructInstruction * object = (const cPtr_gtlSortStatementStructInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlSortStatementStructInstruction) ;
-  const GALGAS_gtlSortStatementStructInstruction temp_0 = object ;
-  result_result = callExtensionGetter_compareElements ((const cPtr_gtlSortStatementStructInstruction *) temp_0.ptr (), constinArgument_s_31_, constinArgument_s_32_, object->mProperty_sortingKey, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1054)) ;
+  result_result = GALGAS_sint ((int32_t) 0L) ;
+  GALGAS_uint var_index_33347 = GALGAS_uint ((uint32_t) 0U) ;
+  if (object->mProperty_sortingKey.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1123)).isValid ()) {
+    uint32_t variant_33358 = object->mProperty_sortingKey.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1123)).uintValue () ;
+    bool loop_33358 = true ;
+    while (loop_33358) {
+      loop_33358 = GALGAS_bool (kIsEqual, result_result.objectCompare (GALGAS_sint ((int32_t) 0L))).operator_and (GALGAS_bool (kIsStrictInf, var_index_33347.objectCompare (constinArgument_keys_31_.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1124)))) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1124)).operator_and (GALGAS_bool (kIsStrictInf, var_index_33347.objectCompare (constinArgument_keys_32_.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1124)))) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1124)).isValid () ;
+      if (loop_33358) {
+        loop_33358 = GALGAS_bool (kIsEqual, result_result.objectCompare (GALGAS_sint ((int32_t) 0L))).operator_and (GALGAS_bool (kIsStrictInf, var_index_33347.objectCompare (constinArgument_keys_31_.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1124)))) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1124)).operator_and (GALGAS_bool (kIsStrictInf, var_index_33347.objectCompare (constinArgument_keys_32_.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1124)))) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1124)).boolValue () ;
+      }
+      if (loop_33358 && (0 == variant_33358)) {
+        loop_33358 = false ;
+        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 1123)) ;
+      }
+      if (loop_33358) {
+        variant_33358 -- ;
+        const GALGAS_gtlSortStatementStructInstruction temp_0 = object ;
+        result_result = callExtensionGetter_compareData ((const cPtr_gtlAbstractSortInstruction *) temp_0.ptr (), constinArgument_keys_31_.getter_valueAtIndex (var_index_33347, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1126)), constinArgument_keys_32_.getter_valueAtIndex (var_index_33347, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1127)), object->mProperty_sortingKey.getter_orderAtIndex (var_index_33347, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1128)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1125)) ;
+        var_index_33347.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1130)) ;
+      }
+    }
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlSortStatementStructInstruction_compareKeys (void) {
+  enterExtensionGetter_compareKeys (kTypeDescriptor_GALGAS_gtlSortStatementStructInstruction.mSlotID,
+                                    extensionGetter_gtlSortStatementStructInstruction_compareKeys) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlSortStatementStructInstruction_compareKeys (defineExtensionGetter_gtlSortStatementStructInstruction_compareKeys, NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                         Overriding extension getter '@gtlSortStatementInstruction sortKeys'                         *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_list extensionGetter_gtlSortStatementInstruction_sortKeys (const cPtr_gtlAbstractSortInstruction * /* inObject */,
+                                                                         const GALGAS_gtlData constinArgument_element,
+                                                                         C_Compiler * /* inCompiler */
+                                                                         COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_list result_result ; // Returned variable
+  result_result = GALGAS_list::constructor_listWithValue (constinArgument_element  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1143)) ;
 //---
   return result_result ;
 }
@@ -6480,40 +6556,31 @@ static GALGAS_sint extensionGetter_gtlSortStatementStructInstruction_compare (co
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-static void defineExtensionGetter_gtlSortStatementStructInstruction_compare (void) {
-  enterExtensionGetter_compare (kTypeDescriptor_GALGAS_gtlSortStatementStructInstruction.mSlotID,
-                                extensionGetter_gtlSortStatementStructInstruction_compare) ;
+static void defineExtensionGetter_gtlSortStatementInstruction_sortKeys (void) {
+  enterExtensionGetter_sortKeys (kTypeDescriptor_GALGAS_gtlSortStatementInstruction.mSlotID,
+                                 extensionGetter_gtlSortStatementInstruction_sortKeys) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-C_PrologueEpilogue gGetter_gtlSortStatementStructInstruction_compare (defineExtensionGetter_gtlSortStatementStructInstruction_compare, NULL) ;
+C_PrologueEpilogue gGetter_gtlSortStatementInstruction_sortKeys (defineExtensionGetter_gtlSortStatementInstruction_sortKeys, NULL) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
-//                         Overriding extension getter '@gtlSortStatementInstruction compare'                          *
+//                       Overriding extension getter '@gtlSortStatementInstruction compareKeys'                        *
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
-static GALGAS_sint extensionGetter_gtlSortStatementInstruction_compare (const cPtr_gtlAbstractSortInstruction * inObject,
-                                                                        const GALGAS_gtlData constinArgument_s_31_,
-                                                                        const GALGAS_gtlData constinArgument_s_32_,
-                                                                        C_Compiler * inCompiler
-                                                                        COMMA_UNUSED_LOCATION_ARGS) {
+static GALGAS_sint extensionGetter_gtlSortStatementInstruction_compareKeys (const cPtr_gtlAbstractSortInstruction * inObject,
+                                                                            const GALGAS_list constinArgument_keys_31_,
+                                                                            const GALGAS_list constinArgument_keys_32_,
+                                                                            C_Compiler * inCompiler
+                                                                            COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_sint result_result ; // Returned variable
   const cPtr_gtlSortStatementInstruction * object = (const cPtr_gtlSortStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlSortStatementInstruction) ;
-  const enumGalgasBool test_0 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_ltOp ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), constinArgument_s_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1101)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1108)).boolEnum () ;
-  if (kBoolTrue == test_0) {
-    result_result = GALGAS_sint ((int32_t) 1L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1102)).multiply_operation (object->mProperty_order.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1102)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1102)) ;
-  }else if (kBoolFalse == test_0) {
-    const enumGalgasBool test_1 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_gtOp ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), constinArgument_s_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1104)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1107)).boolEnum () ;
-    if (kBoolTrue == test_1) {
-      result_result = GALGAS_sint ((int32_t) 1L).multiply_operation (object->mProperty_order.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1105)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1105)) ;
-    }else if (kBoolFalse == test_1) {
-      result_result = GALGAS_sint ((int32_t) 0L) ;
-    }
-  }
+  const GALGAS_gtlSortStatementInstruction temp_0 = object ;
+  result_result = callExtensionGetter_compareData ((const cPtr_gtlAbstractSortInstruction *) temp_0.ptr (), constinArgument_keys_31_.getter_valueAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1152)), constinArgument_keys_32_.getter_valueAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1153)), object->mProperty_order, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1151)) ;
 //---
   return result_result ;
 }
@@ -6521,14 +6588,14 @@ static GALGAS_sint extensionGetter_gtlSortStatementInstruction_compare (const cP
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-static void defineExtensionGetter_gtlSortStatementInstruction_compare (void) {
-  enterExtensionGetter_compare (kTypeDescriptor_GALGAS_gtlSortStatementInstruction.mSlotID,
-                                extensionGetter_gtlSortStatementInstruction_compare) ;
+static void defineExtensionGetter_gtlSortStatementInstruction_compareKeys (void) {
+  enterExtensionGetter_compareKeys (kTypeDescriptor_GALGAS_gtlSortStatementInstruction.mSlotID,
+                                    extensionGetter_gtlSortStatementInstruction_compareKeys) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-C_PrologueEpilogue gGetter_gtlSortStatementInstruction_compare (defineExtensionGetter_gtlSortStatementInstruction_compare, NULL) ;
+C_PrologueEpilogue gGetter_gtlSortStatementInstruction_compareKeys (defineExtensionGetter_gtlSortStatementInstruction_compareKeys, NULL) ;
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
@@ -6545,30 +6612,30 @@ static void extensionMethod_gtlTabStatementInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlTabStatementInstruction * object = (const cPtr_gtlTabStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlTabStatementInstruction) ;
-  GALGAS_gtlData var_tabValueData_33240 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_tabValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1125)) ;
-  const enumGalgasBool test_0 = GALGAS_bool (var_tabValueData_33240.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
+  GALGAS_gtlData var_tabValueData_34599 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_tabValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1171)) ;
+  const enumGalgasBool test_0 = GALGAS_bool (var_tabValueData_34599.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
   if (kBoolTrue == test_0) {
     GALGAS_gtlInt temp_1 ;
-    if (var_tabValueData_33240.isValid ()) {
-      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_tabValueData_33240.ptr ())) {
-        temp_1 = (cPtr_gtlInt *) var_tabValueData_33240.ptr () ;
+    if (var_tabValueData_34599.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_tabValueData_34599.ptr ())) {
+        temp_1 = (cPtr_gtlInt *) var_tabValueData_34599.ptr () ;
       }else{
-        inCompiler->castError ("gtlInt", var_tabValueData_33240.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1127)) ;
+        inCompiler->castError ("gtlInt", var_tabValueData_34599.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1173)) ;
       }
     }
-    GALGAS_gtlInt var_tabValueInt_33339 = temp_1 ;
-    GALGAS_uint var_currentColumn_33389 = ioArgument_outputString.getter_currentColumn (SOURCE_FILE ("gtl_instructions.galgas", 1128)) ;
-    const enumGalgasBool test_2 = GALGAS_bool (kIsSupOrEqual, var_tabValueInt_33339.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1129)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1129)))).boolEnum () ;
+    GALGAS_gtlInt var_tabValueInt_34698 = temp_1 ;
+    GALGAS_uint var_currentColumn_34748 = ioArgument_outputString.getter_currentColumn (SOURCE_FILE ("gtl_instructions.galgas", 1174)) ;
+    const enumGalgasBool test_2 = GALGAS_bool (kIsSupOrEqual, var_tabValueInt_34698.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1175)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1175)))).boolEnum () ;
     if (kBoolTrue == test_2) {
-      GALGAS_uint var_tabColumn_33481 = var_tabValueInt_33339.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1130)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1130)) ;
-      const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_tabColumn_33481.objectCompare (var_currentColumn_33389)).boolEnum () ;
+      GALGAS_uint var_tabColumn_34840 = var_tabValueInt_34698.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1176)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1176)) ;
+      const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_tabColumn_34840.objectCompare (var_currentColumn_34748)).boolEnum () ;
       if (kBoolTrue == test_3) {
-        ioArgument_outputString.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), var_tabColumn_33481.substract_operation (var_currentColumn_33389, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1134)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1134))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1132)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1132)) ;
+        ioArgument_outputString.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), var_tabColumn_34840.substract_operation (var_currentColumn_34748, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1180)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1180))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1178)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1178)) ;
       }
     }
   }else if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_tabValueData_33240.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1140)), GALGAS_string ("int expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1140)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_tabValueData_34599.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1186)), GALGAS_string ("int expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1186)) ;
   }
 }
 
@@ -6601,10 +6668,10 @@ static void extensionMethod_gtlVariablesInstruction_execute (const cPtr_gtlInstr
   const enumGalgasBool test_0 = object->mProperty_shortDisplay.boolEnum () ;
   if (kBoolTrue == test_0) {
     const GALGAS_gtlVariablesInstruction temp_1 = object ;
-    callExtensionMethod_displayShort ((const cPtr_gtlVariablesInstruction *) temp_1.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1198)) ;
+    callExtensionMethod_displayShort ((const cPtr_gtlVariablesInstruction *) temp_1.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1244)) ;
   }else if (kBoolFalse == test_0) {
     const GALGAS_gtlVariablesInstruction temp_2 = object ;
-    callExtensionMethod_displayLong ((const cPtr_gtlVariablesInstruction *) temp_2.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1200)) ;
+    callExtensionMethod_displayLong ((const cPtr_gtlVariablesInstruction *) temp_2.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1246)) ;
   }
 }
 
@@ -6634,104 +6701,104 @@ static void extensionMethod_gtlLibrariesInstruction_execute (const cPtr_gtlInstr
                                                              COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLibrariesInstruction * object = (const cPtr_gtlLibrariesInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLibrariesInstruction) ;
-  GALGAS_string var_delimitor_35863 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1215)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1215)) ;
-  GALGAS_string var_varDelim_35941 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (45)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1216)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1216)) ;
-  GALGAS_string var_separator_36021 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 17U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1217)) ;
-  inCompiler->printMessage (var_separator_36021.add_operation (GALGAS_string (" Libraries "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1218)).add_operation (var_separator_36021, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1218)).add_operation (GALGAS_string ("= Displayed from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1219)).add_operation (var_separator_36021, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1219)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1220))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1218)) ;
-  inCompiler->printMessage (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1221)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1221))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1221)) ;
-  inCompiler->printMessage (var_delimitor_35863  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1222)) ;
-  inCompiler->printMessage (GALGAS_string (" Functions \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1223)) ;
-  inCompiler->printMessage (var_varDelim_35941  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1224)) ;
-  GALGAS_uint var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlFuncMap enumerator_36336 (ioArgument_lib.getter_funcMap (SOURCE_FILE ("gtl_instructions.galgas", 1226)), kENUMERATION_UP) ;
+  GALGAS_string var_delimitor_37222 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1261)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1261)) ;
+  GALGAS_string var_varDelim_37300 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (45)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1262)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1262)) ;
+  GALGAS_string var_separator_37380 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 17U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1263)) ;
+  inCompiler->printMessage (var_separator_37380.add_operation (GALGAS_string (" Libraries "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1264)).add_operation (var_separator_37380, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1264)).add_operation (GALGAS_string ("= Displayed from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1265)).add_operation (var_separator_37380, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1265)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1266))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1264)) ;
+  inCompiler->printMessage (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1267)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1267))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1267)) ;
+  inCompiler->printMessage (var_delimitor_37222  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1268)) ;
+  inCompiler->printMessage (GALGAS_string (" Functions \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1269)) ;
+  inCompiler->printMessage (var_varDelim_37300  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1270)) ;
+  GALGAS_uint var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+  cEnumerator_gtlFuncMap enumerator_37695 (ioArgument_lib.getter_funcMap (SOURCE_FILE ("gtl_instructions.galgas", 1272)), kENUMERATION_UP) ;
   const bool bool_0 = true ;
-  if (enumerator_36336.hasCurrentObject () && bool_0) {
-    while (enumerator_36336.hasCurrentObject () && bool_0) {
-      const enumGalgasBool test_1 = GALGAS_bool (kIsStrictSup, var_lineSize_36300.add_operation (enumerator_36336.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1227)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1227)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1227)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+  if (enumerator_37695.hasCurrentObject () && bool_0) {
+    while (enumerator_37695.hasCurrentObject () && bool_0) {
+      const enumGalgasBool test_1 = GALGAS_bool (kIsStrictSup, var_lineSize_37659.add_operation (enumerator_37695.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1273)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1273)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1273)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
       if (kBoolTrue == test_1) {
-        var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1229)) ;
+        var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1275)) ;
       }
-      inCompiler->printMessage (enumerator_36336.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1231))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1231)) ;
-      var_lineSize_36300.plusAssign_operation(enumerator_36336.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1232)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1232)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1232)) ;
-      enumerator_36336.gotoNextObject () ;
-      if (enumerator_36336.hasCurrentObject () && bool_0) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1234)) ;
-        var_lineSize_36300.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1235)) ;
+      inCompiler->printMessage (enumerator_37695.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1277))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1277)) ;
+      var_lineSize_37659.plusAssign_operation(enumerator_37695.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1278)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1278)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1278)) ;
+      enumerator_37695.gotoNextObject () ;
+      if (enumerator_37695.hasCurrentObject () && bool_0) {
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1280)) ;
+        var_lineSize_37659.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1281)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1237)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1283)) ;
   }
-  inCompiler->printMessage (var_delimitor_35863  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1239)) ;
-  inCompiler->printMessage (GALGAS_string (" Getters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1240)) ;
-  inCompiler->printMessage (var_varDelim_35941  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1241)) ;
-  var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlGetterMap enumerator_36689 (ioArgument_lib.getter_getterMap (SOURCE_FILE ("gtl_instructions.galgas", 1243)), kENUMERATION_UP) ;
+  inCompiler->printMessage (var_delimitor_37222  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1285)) ;
+  inCompiler->printMessage (GALGAS_string (" Getters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1286)) ;
+  inCompiler->printMessage (var_varDelim_37300  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1287)) ;
+  var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+  cEnumerator_gtlGetterMap enumerator_38048 (ioArgument_lib.getter_getterMap (SOURCE_FILE ("gtl_instructions.galgas", 1289)), kENUMERATION_UP) ;
   const bool bool_2 = true ;
-  if (enumerator_36689.hasCurrentObject () && bool_2) {
-    while (enumerator_36689.hasCurrentObject () && bool_2) {
-      const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_lineSize_36300.add_operation (enumerator_36689.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1244)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1244)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1244)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+  if (enumerator_38048.hasCurrentObject () && bool_2) {
+    while (enumerator_38048.hasCurrentObject () && bool_2) {
+      const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_lineSize_37659.add_operation (enumerator_38048.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1290)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1290)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1290)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
       if (kBoolTrue == test_3) {
-        var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1246)) ;
+        var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1292)) ;
       }
-      inCompiler->printMessage (enumerator_36689.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1248))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1248)) ;
-      var_lineSize_36300.plusAssign_operation(enumerator_36689.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1249)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1249)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1249)) ;
-      enumerator_36689.gotoNextObject () ;
-      if (enumerator_36689.hasCurrentObject () && bool_2) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1251)) ;
-        var_lineSize_36300.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1252)) ;
+      inCompiler->printMessage (enumerator_38048.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1294))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1294)) ;
+      var_lineSize_37659.plusAssign_operation(enumerator_38048.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1295)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1295)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1295)) ;
+      enumerator_38048.gotoNextObject () ;
+      if (enumerator_38048.hasCurrentObject () && bool_2) {
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1297)) ;
+        var_lineSize_37659.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1298)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1254)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1300)) ;
   }
-  inCompiler->printMessage (var_delimitor_35863  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1256)) ;
-  inCompiler->printMessage (GALGAS_string (" Setters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1257)) ;
-  inCompiler->printMessage (var_varDelim_35941  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1258)) ;
-  var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlSetterMap enumerator_37042 (ioArgument_lib.getter_setterMap (SOURCE_FILE ("gtl_instructions.galgas", 1260)), kENUMERATION_UP) ;
+  inCompiler->printMessage (var_delimitor_37222  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1302)) ;
+  inCompiler->printMessage (GALGAS_string (" Setters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1303)) ;
+  inCompiler->printMessage (var_varDelim_37300  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1304)) ;
+  var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+  cEnumerator_gtlSetterMap enumerator_38401 (ioArgument_lib.getter_setterMap (SOURCE_FILE ("gtl_instructions.galgas", 1306)), kENUMERATION_UP) ;
   const bool bool_4 = true ;
-  if (enumerator_37042.hasCurrentObject () && bool_4) {
-    while (enumerator_37042.hasCurrentObject () && bool_4) {
-      const enumGalgasBool test_5 = GALGAS_bool (kIsStrictSup, var_lineSize_36300.add_operation (enumerator_37042.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1261)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1261)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1261)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+  if (enumerator_38401.hasCurrentObject () && bool_4) {
+    while (enumerator_38401.hasCurrentObject () && bool_4) {
+      const enumGalgasBool test_5 = GALGAS_bool (kIsStrictSup, var_lineSize_37659.add_operation (enumerator_38401.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1307)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1307)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1307)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
       if (kBoolTrue == test_5) {
-        var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1263)) ;
+        var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1309)) ;
       }
-      inCompiler->printMessage (enumerator_37042.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1265))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1265)) ;
-      var_lineSize_36300.plusAssign_operation(enumerator_37042.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1266)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1266)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1266)) ;
-      enumerator_37042.gotoNextObject () ;
-      if (enumerator_37042.hasCurrentObject () && bool_4) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1268)) ;
-        var_lineSize_36300.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1269)) ;
+      inCompiler->printMessage (enumerator_38401.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1311))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1311)) ;
+      var_lineSize_37659.plusAssign_operation(enumerator_38401.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1312)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1312)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1312)) ;
+      enumerator_38401.gotoNextObject () ;
+      if (enumerator_38401.hasCurrentObject () && bool_4) {
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1314)) ;
+        var_lineSize_37659.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1315)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1271)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1317)) ;
   }
-  inCompiler->printMessage (var_delimitor_35863  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1273)) ;
-  inCompiler->printMessage (GALGAS_string (" Templates \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1274)) ;
-  inCompiler->printMessage (var_varDelim_35941  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1275)) ;
-  var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlTemplateMap enumerator_37399 (ioArgument_lib.getter_templateMap (SOURCE_FILE ("gtl_instructions.galgas", 1277)), kENUMERATION_UP) ;
+  inCompiler->printMessage (var_delimitor_37222  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1319)) ;
+  inCompiler->printMessage (GALGAS_string (" Templates \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1320)) ;
+  inCompiler->printMessage (var_varDelim_37300  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1321)) ;
+  var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+  cEnumerator_gtlTemplateMap enumerator_38758 (ioArgument_lib.getter_templateMap (SOURCE_FILE ("gtl_instructions.galgas", 1323)), kENUMERATION_UP) ;
   const bool bool_6 = true ;
-  if (enumerator_37399.hasCurrentObject () && bool_6) {
-    while (enumerator_37399.hasCurrentObject () && bool_6) {
-      const enumGalgasBool test_7 = GALGAS_bool (kIsStrictSup, var_lineSize_36300.add_operation (enumerator_37399.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1278)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1278)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1278)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+  if (enumerator_38758.hasCurrentObject () && bool_6) {
+    while (enumerator_38758.hasCurrentObject () && bool_6) {
+      const enumGalgasBool test_7 = GALGAS_bool (kIsStrictSup, var_lineSize_37659.add_operation (enumerator_38758.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1324)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1324)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1324)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
       if (kBoolTrue == test_7) {
-        var_lineSize_36300 = GALGAS_uint ((uint32_t) 0U) ;
-        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1280)) ;
+        var_lineSize_37659 = GALGAS_uint ((uint32_t) 0U) ;
+        inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1326)) ;
       }
-      inCompiler->printMessage (enumerator_37399.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1282))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1282)) ;
-      var_lineSize_36300.plusAssign_operation(enumerator_37399.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1283)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1283)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1283)) ;
-      enumerator_37399.gotoNextObject () ;
-      if (enumerator_37399.hasCurrentObject () && bool_6) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1285)) ;
-        var_lineSize_36300.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1286)) ;
+      inCompiler->printMessage (enumerator_38758.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1328))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1328)) ;
+      var_lineSize_37659.plusAssign_operation(enumerator_38758.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1329)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1329)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1329)) ;
+      enumerator_38758.gotoNextObject () ;
+      if (enumerator_38758.hasCurrentObject () && bool_6) {
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1331)) ;
+        var_lineSize_37659.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1332)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1288)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)) ;
   }
-  inCompiler->printMessage (var_delimitor_35863  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1290)) ;
+  inCompiler->printMessage (var_delimitor_37222  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1336)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6760,19 +6827,19 @@ static void extensionMethod_gtlSetterCallInstruction_execute (const cPtr_gtlInst
                                                               COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlSetterCallInstruction * object = (const cPtr_gtlSetterCallInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlSetterCallInstruction) ;
-  GALGAS_gtlDataList var_dataArguments_38217 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 1308)) ;
-  cEnumerator_gtlExpressionList enumerator_38252 (object->mProperty_arguments, kENUMERATION_UP) ;
-  while (enumerator_38252.hasCurrentObject ()) {
-    var_dataArguments_38217.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_38252.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1310))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1310)) ;
-    enumerator_38252.gotoNextObject () ;
+  GALGAS_gtlDataList var_dataArguments_39576 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 1354)) ;
+  cEnumerator_gtlExpressionList enumerator_39611 (object->mProperty_arguments, kENUMERATION_UP) ;
+  while (enumerator_39611.hasCurrentObject ()) {
+    var_dataArguments_39576.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_39611.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1356))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1356)) ;
+    enumerator_39611.gotoNextObject () ;
   }
-  GALGAS_gtlData var_targetData_38343 = extensionGetter_get (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1312)) ;
+  GALGAS_gtlData var_targetData_39702 = extensionGetter_get (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1358)) ;
   {
-  var_targetData_38343.insulate (HERE) ;
-  cPtr_gtlData * ptr_38394 = (cPtr_gtlData *) var_targetData_38343.ptr () ;
-  callExtensionSetter_performSetter ((cPtr_gtlData *) ptr_38394, object->mProperty_setterName, var_dataArguments_38217, ioArgument_context, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1313)) ;
+  var_targetData_39702.insulate (HERE) ;
+  cPtr_gtlData * ptr_39753 = (cPtr_gtlData *) var_targetData_39702.ptr () ;
+  callExtensionSetter_performSetter ((cPtr_gtlData *) ptr_39753, object->mProperty_setterName, var_dataArguments_39576, ioArgument_context, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1359)) ;
   }
-  extensionMethod_set (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, var_targetData_38343, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1314)) ;
+  extensionMethod_set (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, var_targetData_39702, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1360)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6801,30 +6868,30 @@ static void extensionMethod_gtlInputStatementInstruction_execute (const cPtr_gtl
                                                                   COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlInputStatementInstruction * object = (const cPtr_gtlInputStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlInputStatementInstruction) ;
-  cEnumerator_gtlArgumentList enumerator_39012 (object->mProperty_formalArguments, kENUMERATION_UP) ;
-  while (enumerator_39012.hasCurrentObject ()) {
-    GALGAS_gtlData var_arg_39067 ;
+  cEnumerator_gtlArgumentList enumerator_40371 (object->mProperty_formalArguments, kENUMERATION_UP) ;
+  while (enumerator_40371.hasCurrentObject ()) {
+    GALGAS_gtlData var_arg_40426 ;
     {
     ioArgument_context.insulate (HERE) ;
-    cPtr_gtlContext * ptr_39030 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-    callExtensionSetter_popFirstInputArg ((cPtr_gtlContext *) ptr_39030, enumerator_39012.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1331)), var_arg_39067, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1331)) ;
+    cPtr_gtlContext * ptr_40389 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
+    callExtensionSetter_popFirstInputArg ((cPtr_gtlContext *) ptr_40389, enumerator_40371.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1377)), var_arg_40426, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1377)) ;
     }
-    const enumGalgasBool test_0 = enumerator_39012.current_typed (HERE).boolEnum () ;
+    const enumGalgasBool test_0 = enumerator_40371.current_typed (HERE).boolEnum () ;
     if (kBoolTrue == test_0) {
-      const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, enumerator_39012.current_type (HERE).objectCompare (var_arg_39067.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1333)))).boolEnum () ;
+      const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, enumerator_40371.current_type (HERE).objectCompare (var_arg_40426.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1379)))).boolEnum () ;
       if (kBoolTrue == test_1) {
         TC_Array <C_FixItDescription> fixItArray2 ;
-        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_arg_39067.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)), GALGAS_string ("mistyped argument, ").add_operation (extensionGetter_typeName (var_arg_39067.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1334)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)) ;
+        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_arg_40426.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1380)), GALGAS_string ("mistyped argument, ").add_operation (extensionGetter_typeName (var_arg_40426.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1380)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1380)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1380)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1380)), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1380)) ;
         TC_Array <C_FixItDescription> fixItArray3 ;
-        inCompiler->emitSemanticError (enumerator_39012.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1335)), extensionGetter_typeName (enumerator_39012.current_type (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1335)).add_operation (GALGAS_string (" expected"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1335)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1335)) ;
+        inCompiler->emitSemanticError (enumerator_40371.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1381)), extensionGetter_typeName (enumerator_40371.current_type (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1381)).add_operation (GALGAS_string (" expected"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1381)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1381)) ;
       }
     }
     {
     ioArgument_vars.insulate (HERE) ;
-    cPtr_gtlData * ptr_39294 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_39294, enumerator_39012.current_name (HERE), var_arg_39067, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1338)) ;
+    cPtr_gtlData * ptr_40653 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_40653, enumerator_40371.current_name (HERE), var_arg_40426, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1384)) ;
     }
-    enumerator_39012.gotoNextObject () ;
+    enumerator_40371.gotoNextObject () ;
   }
 }
 
@@ -7946,6 +8013,12 @@ C_BoolCommandLineOption gOption_gtl_5F_options_debug ("gtl_options",
                                          "debug",
                                          "Execute the GTL templates in debug mode") ;
 
+C_BoolCommandLineOption gOption_gtl_5F_options_profileTemplates ("gtl_options",
+                                         "profileTemplates",
+                                         0,
+                                         "profile-templates",
+                                         "Write the time spent in each GTL template to gtl-profile.txt and gtl-profile.folded") ;
+
 C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ("gtl_options",
                                          "warnDeprecated",
                                          0,
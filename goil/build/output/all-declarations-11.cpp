@@ -2005,6 +2005,12 @@ C_BoolCommandLineOption gOption_goil_5F_options_pierreOption ("goil_options",
                                          "pierre",
                                          "Special option to pass a galgas bug to Pierre") ;
 
+C_BoolCommandLineOption gOption_goil_5F_options_stats ("goil_options",
+                                         "stats",
+                                         0,
+                                         "stats",
+                                         "Print the time spent in each phase of the compilation") ;
+
 C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ("goil_options",
                                          "warnMultiple",
                                          0,
@@ -2051,6 +2057,13 @@ C_StringCommandLineOption gOption_goil_5F_options_root ("goil_options",
                                          "Specifies the root template file to use to generate the output files",
                                          "root") ;
 
+C_StringCommandLineOption gOption_goil_5F_options_stats_5F_file ("goil_options",
+                                         "stats_file",
+                                         0,
+                                         "stats-file",
+                                         "Write the time spent in each phase of the compilation to a JSON file",
+                                         "") ;
+
 C_StringCommandLineOption gOption_goil_5F_options_target_5F_platform ("goil_options",
                                          "target_platform",
                                          116,
@@ -6034,47 +6047,77 @@ C_galgas_function_descriptor functionDescriptor_add_5F_path_5F_component ("add_p
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
-//                                          Function 'rootTemplatesDirectory'                                          *
+//                                       Once function 'rootTemplatesDirectory'                                        *
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
-GALGAS_string function_rootTemplatesDirectory (C_Compiler * inCompiler
-                                               COMMA_UNUSED_LOCATION_ARGS) {
+static GALGAS_string onceFunction_rootTemplatesDirectory (C_Compiler * inCompiler
+                                                          COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result_templateDirectory ; // Returned variable
   const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string (gOption_goil_5F_options_template_5F_dir.getter_value ()).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
   if (kBoolTrue == test_0) {
     result_templateDirectory = GALGAS_string (gOption_goil_5F_options_template_5F_dir.getter_value ()) ;
   }else if (kBoolFalse == test_0) {
-    GALGAS_string var_env_3086 = GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("GOIL_TEMPLATES")  COMMA_SOURCE_FILE ("goil_routines.galgas", 110)) ;
-    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_env_3086.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+    GALGAS_string var_env_3192 = GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("GOIL_TEMPLATES")  COMMA_SOURCE_FILE ("goil_routines.galgas", 112)) ;
+    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_env_3192.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
     if (kBoolTrue == test_1) {
-      result_templateDirectory = var_env_3086 ;
+      result_templateDirectory = var_env_3192 ;
     }else if (kBoolFalse == test_1) {
       TC_Array <C_FixItDescription> fixItArray2 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 114)), GALGAS_string ("The templates path is not set. Use --templates option or set the GOIL_TEMPLATES environment variable"), fixItArray2  COMMA_SOURCE_FILE ("goil_routines.galgas", 114)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 116)), GALGAS_string ("The templates path is not set. Use --templates option or set the GOIL_TEMPLATES environment variable"), fixItArray2  COMMA_SOURCE_FILE ("goil_routines.galgas", 116)) ;
       result_templateDirectory.drop () ; // Release error dropped variable
     }
   }
-  result_templateDirectory = result_templateDirectory.getter_unixPathWithNativePath (SOURCE_FILE ("goil_routines.galgas", 118)) ;
-  result_templateDirectory = result_templateDirectory.getter_stringByStandardizingPath (SOURCE_FILE ("goil_routines.galgas", 119)) ;
-  const enumGalgasBool test_3 = GALGAS_bool (kIsNotEqual, result_templateDirectory.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 121)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
+  result_templateDirectory = result_templateDirectory.getter_unixPathWithNativePath (SOURCE_FILE ("goil_routines.galgas", 120)) ;
+  result_templateDirectory = result_templateDirectory.getter_stringByStandardizingPath (SOURCE_FILE ("goil_routines.galgas", 121)) ;
+  const enumGalgasBool test_3 = GALGAS_bool (kIsNotEqual, result_templateDirectory.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 123)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
   if (kBoolTrue == test_3) {
-    const enumGalgasBool test_4 = GALGAS_bool (kIsEqual, result_templateDirectory.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 122)).objectCompare (GALGAS_char (TO_UNICODE (126)))).boolEnum () ;
+    const enumGalgasBool test_4 = GALGAS_bool (kIsEqual, result_templateDirectory.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 124)).objectCompare (GALGAS_char (TO_UNICODE (126)))).boolEnum () ;
     if (kBoolTrue == test_4) {
-      GALGAS_string var_home_3651 = GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("HOME")  COMMA_SOURCE_FILE ("goil_routines.galgas", 123)) ;
-      GALGAS_string var_relativeToHome_3738 = result_templateDirectory.getter_rightSubString (result_templateDirectory.getter_length (SOURCE_FILE ("goil_routines.galgas", 124)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 124)) COMMA_SOURCE_FILE ("goil_routines.galgas", 124)) ;
-      result_templateDirectory = var_home_3651.add_operation (var_relativeToHome_3738, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 125)) ;
+      GALGAS_string var_home_3757 = GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("HOME")  COMMA_SOURCE_FILE ("goil_routines.galgas", 125)) ;
+      GALGAS_string var_relativeToHome_3844 = result_templateDirectory.getter_rightSubString (result_templateDirectory.getter_length (SOURCE_FILE ("goil_routines.galgas", 126)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 126)) COMMA_SOURCE_FILE ("goil_routines.galgas", 126)) ;
+      result_templateDirectory = var_home_3757.add_operation (var_relativeToHome_3844, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 127)) ;
     }else if (kBoolFalse == test_4) {
-      GALGAS_string var_currentDirectory_3895 = GALGAS_string::constructor_stringWithCurrentDirectory (SOURCE_FILE ("goil_routines.galgas", 127)) ;
-      result_templateDirectory = var_currentDirectory_3895.add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 128)).add_operation (result_templateDirectory, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 128)) ;
+      GALGAS_string var_currentDirectory_4001 = GALGAS_string::constructor_stringWithCurrentDirectory (SOURCE_FILE ("goil_routines.galgas", 129)) ;
+      result_templateDirectory = var_currentDirectory_4001.add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 130)).add_operation (result_templateDirectory, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 130)) ;
     }
-    result_templateDirectory = result_templateDirectory.getter_stringByStandardizingPath (SOURCE_FILE ("goil_routines.galgas", 130)) ;
+    result_templateDirectory = result_templateDirectory.getter_stringByStandardizingPath (SOURCE_FILE ("goil_routines.galgas", 132)) ;
   }
 //---
   return result_templateDirectory ;
 }
 
 
+
+//---------------------------------------------------------------------------------------------------------------------*
+//  Function implementation                                                                                            *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool gOnceFunctionResultAvailable_rootTemplatesDirectory = false ;
+static GALGAS_string gOnceFunctionResult_rootTemplatesDirectory ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string function_rootTemplatesDirectory (class C_Compiler * inCompiler
+              COMMA_LOCATION_ARGS) {
+  if (! gOnceFunctionResultAvailable_rootTemplatesDirectory) {
+    gOnceFunctionResult_rootTemplatesDirectory = onceFunction_rootTemplatesDirectory (inCompiler COMMA_THERE) ;
+    gOnceFunctionResultAvailable_rootTemplatesDirectory = true ;
+  }
+  return gOnceFunctionResult_rootTemplatesDirectory ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void releaseOnceFunctionResult_rootTemplatesDirectory (void) {
+  gOnceFunctionResult_rootTemplatesDirectory.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gEpilogueForOnceFunction_rootTemplatesDirectory (NULL,
+                                                                    releaseOnceFunctionResult_rootTemplatesDirectory) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //  Function introspection                                                                                             *
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6110,22 +6153,22 @@ GALGAS_string function_templates_5F_directory (GALGAS_string inArgument_prefix,
                                                C_Compiler * inCompiler
                                                COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result_temp_5F_dir ; // Returned variable
-  result_temp_5F_dir = function_rootTemplatesDirectory (inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 135)) ;
+  result_temp_5F_dir = function_rootTemplatesDirectory (inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 137)) ;
   const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, result_temp_5F_dir.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
   if (kBoolTrue == test_0) {
-    result_temp_5F_dir = function_add_5F_path_5F_component (result_temp_5F_dir, inArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 137)) ;
-    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, result_temp_5F_dir.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 139)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
+    result_temp_5F_dir = function_add_5F_path_5F_component (result_temp_5F_dir, inArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 139)) ;
+    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, result_temp_5F_dir.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 141)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
     if (kBoolTrue == test_1) {
-      GALGAS_string var_curdir_4402 = GALGAS_string::constructor_stringWithCurrentDirectory (SOURCE_FILE ("goil_routines.galgas", 140)) ;
-      const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, result_temp_5F_dir.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 141)).objectCompare (GALGAS_char (TO_UNICODE (46)))).operator_and (GALGAS_bool (kIsEqual, result_temp_5F_dir.getter_characterAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 141)).objectCompare (GALGAS_char (TO_UNICODE (47)))) COMMA_SOURCE_FILE ("goil_routines.galgas", 141)).boolEnum () ;
+      GALGAS_string var_curdir_4508 = GALGAS_string::constructor_stringWithCurrentDirectory (SOURCE_FILE ("goil_routines.galgas", 142)) ;
+      const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, result_temp_5F_dir.getter_characterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 143)).objectCompare (GALGAS_char (TO_UNICODE (46)))).operator_and (GALGAS_bool (kIsEqual, result_temp_5F_dir.getter_characterAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 143)).objectCompare (GALGAS_char (TO_UNICODE (47)))) COMMA_SOURCE_FILE ("goil_routines.galgas", 143)).boolEnum () ;
       if (kBoolTrue == test_2) {
-        result_temp_5F_dir = result_temp_5F_dir.getter_stringByRemovingCharacterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 142)).getter_stringByRemovingCharacterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 142)) ;
+        result_temp_5F_dir = result_temp_5F_dir.getter_stringByRemovingCharacterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 144)).getter_stringByRemovingCharacterAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 144)) ;
       }
-      result_temp_5F_dir = var_curdir_4402.add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 144)).add_operation (result_temp_5F_dir, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 144)) ;
+      result_temp_5F_dir = var_curdir_4508.add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 146)).add_operation (result_temp_5F_dir, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 146)) ;
     }
-    const enumGalgasBool test_3 = GALGAS_bool (kIsNotEqual, result_temp_5F_dir.getter_characterAtIndex (result_temp_5F_dir.getter_length (SOURCE_FILE ("goil_routines.galgas", 146)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 146)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 146)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
+    const enumGalgasBool test_3 = GALGAS_bool (kIsNotEqual, result_temp_5F_dir.getter_characterAtIndex (result_temp_5F_dir.getter_length (SOURCE_FILE ("goil_routines.galgas", 148)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 148)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 148)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
     if (kBoolTrue == test_3) {
-      result_temp_5F_dir.plusAssign_operation(GALGAS_string ("/"), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 147)) ;
+      result_temp_5F_dir.plusAssign_operation(GALGAS_string ("/"), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 149)) ;
     }
   }
 //---
@@ -6175,39 +6218,39 @@ GALGAS_string function_templateFilePath (const GALGAS_string & constinArgument_p
                                          C_Compiler * inCompiler
                                          COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result_path ; // Returned variable
-  GALGAS_stringlist var_components_5004 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 158)) ;
-  GALGAS_string var_templateDir_5107 = function_templates_5F_directory (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 159)) ;
-  GALGAS_bool var_notFound_5155 = GALGAS_bool (true) ;
-  GALGAS_bool var_notOver_5178 = GALGAS_bool (true) ;
+  GALGAS_stringlist var_components_5110 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 160)) ;
+  GALGAS_string var_templateDir_5213 = function_templates_5F_directory (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 161)) ;
+  GALGAS_bool var_notFound_5261 = GALGAS_bool (true) ;
+  GALGAS_bool var_notOver_5284 = GALGAS_bool (true) ;
   result_path = GALGAS_string::makeEmptyString () ;
-  if (var_components_5004.getter_length (SOURCE_FILE ("goil_routines.galgas", 164)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 164)).isValid ()) {
-    uint32_t variant_5207 = var_components_5004.getter_length (SOURCE_FILE ("goil_routines.galgas", 164)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 164)).uintValue () ;
-    bool loop_5207 = true ;
-    while (loop_5207) {
-      loop_5207 = var_notFound_5155.operator_and (var_notOver_5178 COMMA_SOURCE_FILE ("goil_routines.galgas", 165)).isValid () ;
-      if (loop_5207) {
-        loop_5207 = var_notFound_5155.operator_and (var_notOver_5178 COMMA_SOURCE_FILE ("goil_routines.galgas", 165)).boolValue () ;
+  if (var_components_5110.getter_length (SOURCE_FILE ("goil_routines.galgas", 166)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 166)).isValid ()) {
+    uint32_t variant_5313 = var_components_5110.getter_length (SOURCE_FILE ("goil_routines.galgas", 166)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 166)).uintValue () ;
+    bool loop_5313 = true ;
+    while (loop_5313) {
+      loop_5313 = var_notFound_5261.operator_and (var_notOver_5284 COMMA_SOURCE_FILE ("goil_routines.galgas", 167)).isValid () ;
+      if (loop_5313) {
+        loop_5313 = var_notFound_5261.operator_and (var_notOver_5284 COMMA_SOURCE_FILE ("goil_routines.galgas", 167)).boolValue () ;
       }
-      if (loop_5207 && (0 == variant_5207)) {
-        loop_5207 = false ;
-        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 164)) ;
+      if (loop_5313 && (0 == variant_5313)) {
+        loop_5313 = false ;
+        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 166)) ;
       }
-      if (loop_5207) {
-        variant_5207 -- ;
-        GALGAS_string var_targetPath_5284 = var_templateDir_5107.add_operation (GALGAS_string::constructor_componentsJoinedByString (var_components_5004, GALGAS_string ("/")  COMMA_SOURCE_FILE ("goil_routines.galgas", 166)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 166)).add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 166)).add_operation (constinArgument_file, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 166)) ;
-        const enumGalgasBool test_0 = var_targetPath_5284.getter_fileExists (SOURCE_FILE ("goil_routines.galgas", 168)).boolEnum () ;
+      if (loop_5313) {
+        variant_5313 -- ;
+        GALGAS_string var_targetPath_5390 = var_templateDir_5213.add_operation (GALGAS_string::constructor_componentsJoinedByString (var_components_5110, GALGAS_string ("/")  COMMA_SOURCE_FILE ("goil_routines.galgas", 168)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 168)).add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 168)).add_operation (constinArgument_file, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 168)) ;
+        const enumGalgasBool test_0 = var_targetPath_5390.getter_fileExists (SOURCE_FILE ("goil_routines.galgas", 170)).boolEnum () ;
         if (kBoolTrue == test_0) {
-          var_notFound_5155 = GALGAS_bool (false) ;
-          result_path = var_targetPath_5284 ;
+          var_notFound_5261 = GALGAS_bool (false) ;
+          result_path = var_targetPath_5390 ;
         }
-        const enumGalgasBool test_1 = GALGAS_bool (kIsStrictSup, var_components_5004.getter_length (SOURCE_FILE ("goil_routines.galgas", 172)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+        const enumGalgasBool test_1 = GALGAS_bool (kIsStrictSup, var_components_5110.getter_length (SOURCE_FILE ("goil_routines.galgas", 174)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
         if (kBoolTrue == test_1) {
           {
-          GALGAS_string joker_5560 ; // Joker input parameter
-          var_components_5004.setter_popLast (joker_5560, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 173)) ;
+          GALGAS_string joker_5666 ; // Joker input parameter
+          var_components_5110.setter_popLast (joker_5666, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 175)) ;
           }
         }else if (kBoolFalse == test_1) {
-          var_notOver_5178 = GALGAS_bool (false) ;
+          var_notOver_5284 = GALGAS_bool (false) ;
         }
       }
     }
@@ -6263,16 +6306,16 @@ GALGAS_stringlist function_allTemplatePaths (const GALGAS_string & constinArgume
                                              C_Compiler * inCompiler
                                              COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_stringlist result_paths ; // Returned variable
-  GALGAS_stringlist var_components_5703 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 184)) ;
-  GALGAS_string var_partialPath_5806 = function_templates_5F_directory (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 185)) ;
-  result_paths = GALGAS_stringlist::constructor_listWithValue (var_partialPath_5806  COMMA_SOURCE_FILE ("goil_routines.galgas", 187)) ;
-  cEnumerator_stringlist enumerator_5938 (var_components_5703, kENUMERATION_UP) ;
-  while (enumerator_5938.hasCurrentObject ()) {
-    var_partialPath_5806 = function_add_5F_path_5F_component (var_partialPath_5806, enumerator_5938.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 190)) ;
+  GALGAS_stringlist var_components_5809 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 186)) ;
+  GALGAS_string var_partialPath_5912 = function_templates_5F_directory (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 187)) ;
+  result_paths = GALGAS_stringlist::constructor_listWithValue (var_partialPath_5912  COMMA_SOURCE_FILE ("goil_routines.galgas", 189)) ;
+  cEnumerator_stringlist enumerator_6044 (var_components_5809, kENUMERATION_UP) ;
+  while (enumerator_6044.hasCurrentObject ()) {
+    var_partialPath_5912 = function_add_5F_path_5F_component (var_partialPath_5912, enumerator_6044.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 192)) ;
     {
-    result_paths.setter_insertAtIndex (var_partialPath_5806, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 191)) ;
+    result_paths.setter_insertAtIndex (var_partialPath_5912, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 193)) ;
     }
-    enumerator_5938.gotoNextObject () ;
+    enumerator_6044.gotoNextObject () ;
   }
 //---
   return result_paths ;
@@ -6318,29 +6361,29 @@ C_galgas_function_descriptor functionDescriptor_allTemplatePaths ("allTemplatePa
 
 void routine_checkTemplatesPath (C_Compiler * inCompiler
                                  COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_string var_configDir_6102 = function_rootTemplatesDirectory (inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 197)).add_operation (GALGAS_string ("/config"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 197)) ;
-  const enumGalgasBool test_0 = var_configDir_6102.getter_directoryExists (SOURCE_FILE ("goil_routines.galgas", 198)).operator_not (SOURCE_FILE ("goil_routines.galgas", 198)).boolEnum () ;
+  GALGAS_string var_configDir_6208 = function_rootTemplatesDirectory (inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 199)).add_operation (GALGAS_string ("/config"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 199)) ;
+  const enumGalgasBool test_0 = var_configDir_6208.getter_directoryExists (SOURCE_FILE ("goil_routines.galgas", 200)).operator_not (SOURCE_FILE ("goil_routines.galgas", 200)).boolEnum () ;
   if (kBoolTrue == test_0) {
     TC_Array <C_FixItDescription> fixItArray1 ;
-    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 199)), GALGAS_string ("The templates path '").add_operation (var_configDir_6102, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 199)).add_operation (GALGAS_string ("' is not set to the templates directory"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 199)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 199)) ;
+    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 201)), GALGAS_string ("The templates path '").add_operation (var_configDir_6208, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 201)).add_operation (GALGAS_string ("' is not set to the templates directory"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 201)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 201)) ;
   }else if (kBoolFalse == test_0) {
-    GALGAS_string var_partialPath_6319 = var_configDir_6102 ;
-    GALGAS_bool var_continueIt_6352 = GALGAS_bool (true) ;
-    GALGAS_stringlist var_components_6386 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 203)) ;
-    cEnumerator_stringlist enumerator_6504 (var_components_6386, kENUMERATION_UP) ;
-    while (enumerator_6504.hasCurrentObject ()) {
-      var_partialPath_6319 = var_partialPath_6319.add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 205)).add_operation (enumerator_6504.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 205)) ;
-      GALGAS_bool test_2 = var_continueIt_6352 ;
+    GALGAS_string var_partialPath_6425 = var_configDir_6208 ;
+    GALGAS_bool var_continueIt_6458 = GALGAS_bool (true) ;
+    GALGAS_stringlist var_components_6492 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 205)) ;
+    cEnumerator_stringlist enumerator_6610 (var_components_6492, kENUMERATION_UP) ;
+    while (enumerator_6610.hasCurrentObject ()) {
+      var_partialPath_6425 = var_partialPath_6425.add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 207)).add_operation (enumerator_6610.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 207)) ;
+      GALGAS_bool test_2 = var_continueIt_6458 ;
       if (kBoolTrue == test_2.boolEnum ()) {
-        test_2 = var_partialPath_6319.getter_directoryExists (SOURCE_FILE ("goil_routines.galgas", 206)).operator_not (SOURCE_FILE ("goil_routines.galgas", 206)) ;
+        test_2 = var_partialPath_6425.getter_directoryExists (SOURCE_FILE ("goil_routines.galgas", 208)).operator_not (SOURCE_FILE ("goil_routines.galgas", 208)) ;
       }
       const enumGalgasBool test_3 = test_2.boolEnum () ;
       if (kBoolTrue == test_3) {
         TC_Array <C_FixItDescription> fixItArray4 ;
-        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 207)), GALGAS_string ("The templates path '").add_operation (var_partialPath_6319, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 207)).add_operation (GALGAS_string ("' does not exist in the templates directory"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 207)), fixItArray4  COMMA_SOURCE_FILE ("goil_routines.galgas", 207)) ;
-        var_continueIt_6352 = GALGAS_bool (false) ;
+        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 209)), GALGAS_string ("The templates path '").add_operation (var_partialPath_6425, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 209)).add_operation (GALGAS_string ("' does not exist in the templates directory"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 209)), fixItArray4  COMMA_SOURCE_FILE ("goil_routines.galgas", 209)) ;
+        var_continueIt_6458 = GALGAS_bool (false) ;
       }
-      enumerator_6504.gotoNextObject () ;
+      enumerator_6610.gotoNextObject () ;
     }
   }
 }
@@ -6357,42 +6400,42 @@ GALGAS_stringlist function_allTemplateFilePaths (const GALGAS_string & constinAr
                                                  C_Compiler * inCompiler
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_stringlist result_paths ; // Returned variable
-  GALGAS_stringlist var_components_6901 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 220)) ;
-  GALGAS_string var_templateDir_7004 = function_templates_5F_directory (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 221)) ;
-  GALGAS_bool var_notOver_7051 = GALGAS_bool (true) ;
-  result_paths = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("goil_routines.galgas", 223)) ;
-  if (var_components_6901.getter_length (SOURCE_FILE ("goil_routines.galgas", 225)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 225)).isValid ()) {
-    uint32_t variant_7101 = var_components_6901.getter_length (SOURCE_FILE ("goil_routines.galgas", 225)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 225)).uintValue () ;
-    bool loop_7101 = true ;
-    while (loop_7101) {
-      loop_7101 = var_notOver_7051.isValid () ;
-      if (loop_7101) {
-        loop_7101 = var_notOver_7051.boolValue () ;
+  GALGAS_stringlist var_components_7007 = GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ()).getter_componentsSeparatedByString (GALGAS_string ("/") COMMA_SOURCE_FILE ("goil_routines.galgas", 222)) ;
+  GALGAS_string var_templateDir_7110 = function_templates_5F_directory (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 223)) ;
+  GALGAS_bool var_notOver_7157 = GALGAS_bool (true) ;
+  result_paths = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("goil_routines.galgas", 225)) ;
+  if (var_components_7007.getter_length (SOURCE_FILE ("goil_routines.galgas", 227)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 227)).isValid ()) {
+    uint32_t variant_7207 = var_components_7007.getter_length (SOURCE_FILE ("goil_routines.galgas", 227)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 227)).uintValue () ;
+    bool loop_7207 = true ;
+    while (loop_7207) {
+      loop_7207 = var_notOver_7157.isValid () ;
+      if (loop_7207) {
+        loop_7207 = var_notOver_7157.boolValue () ;
       }
-      if (loop_7101 && (0 == variant_7101)) {
-        loop_7101 = false ;
-        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 225)) ;
+      if (loop_7207 && (0 == variant_7207)) {
+        loop_7207 = false ;
+        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 227)) ;
       }
-      if (loop_7101) {
-        variant_7101 -- ;
-        GALGAS_string var_intermediatePath_7173 = GALGAS_string::constructor_componentsJoinedByString (var_components_6901, GALGAS_string ("/")  COMMA_SOURCE_FILE ("goil_routines.galgas", 227)) ;
-        const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, var_intermediatePath_7173.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+      if (loop_7207) {
+        variant_7207 -- ;
+        GALGAS_string var_intermediatePath_7279 = GALGAS_string::constructor_componentsJoinedByString (var_components_7007, GALGAS_string ("/")  COMMA_SOURCE_FILE ("goil_routines.galgas", 229)) ;
+        const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, var_intermediatePath_7279.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
         if (kBoolTrue == test_0) {
-          var_intermediatePath_7173.plusAssign_operation(GALGAS_string ("/"), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 228)) ;
+          var_intermediatePath_7279.plusAssign_operation(GALGAS_string ("/"), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 230)) ;
         }
-        GALGAS_string var_targetPath_7315 = var_templateDir_7004.add_operation (var_intermediatePath_7173, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 229)).add_operation (constinArgument_file, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 229)) ;
-        const enumGalgasBool test_1 = var_targetPath_7315.getter_fileExists (SOURCE_FILE ("goil_routines.galgas", 231)).boolEnum () ;
+        GALGAS_string var_targetPath_7421 = var_templateDir_7110.add_operation (var_intermediatePath_7279, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 231)).add_operation (constinArgument_file, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 231)) ;
+        const enumGalgasBool test_1 = var_targetPath_7421.getter_fileExists (SOURCE_FILE ("goil_routines.galgas", 233)).boolEnum () ;
         if (kBoolTrue == test_1) {
-          result_paths.addAssign_operation (var_targetPath_7315  COMMA_SOURCE_FILE ("goil_routines.galgas", 232)) ;
+          result_paths.addAssign_operation (var_targetPath_7421  COMMA_SOURCE_FILE ("goil_routines.galgas", 234)) ;
         }
-        const enumGalgasBool test_2 = GALGAS_bool (kIsStrictSup, var_components_6901.getter_length (SOURCE_FILE ("goil_routines.galgas", 234)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+        const enumGalgasBool test_2 = GALGAS_bool (kIsStrictSup, var_components_7007.getter_length (SOURCE_FILE ("goil_routines.galgas", 236)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
         if (kBoolTrue == test_2) {
           {
-          GALGAS_string joker_7530 ; // Joker input parameter
-          var_components_6901.setter_popLast (joker_7530, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 235)) ;
+          GALGAS_string joker_7636 ; // Joker input parameter
+          var_components_7007.setter_popLast (joker_7636, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 237)) ;
           }
         }else if (kBoolFalse == test_2) {
-          var_notOver_7051 = GALGAS_bool (false) ;
+          var_notOver_7157 = GALGAS_bool (false) ;
         }
       }
     }
@@ -6450,9 +6493,9 @@ void routine_prefix (GALGAS_prefix_5F_map inArgument_p,
                      C_Compiler * inCompiler
                      COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_val.drop () ; // Release 'out' argument
-  GALGAS_lstring var_lkey_7653 = GALGAS_lstring::constructor_new (inArgument_key, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 243))  COMMA_SOURCE_FILE ("goil_routines.galgas", 243)) ;
-  GALGAS_string joker_7720 ; // Joker input parameter
-  inArgument_p.method_prefix (var_lkey_7653, outArgument_val, joker_7720, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 244)) ;
+  GALGAS_lstring var_lkey_7759 = GALGAS_lstring::constructor_new (inArgument_key, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 245))  COMMA_SOURCE_FILE ("goil_routines.galgas", 245)) ;
+  GALGAS_string joker_7826 ; // Joker input parameter
+  inArgument_p.method_prefix (var_lkey_7759, outArgument_val, joker_7826, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 246)) ;
 }
 
 
@@ -6468,11 +6511,11 @@ void routine_performReplace (GALGAS_prefix_5F_map inArgument_p,
                              GALGAS_string & ioArgument_res,
                              C_Compiler * inCompiler
                              COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_lkey_7821 = GALGAS_lstring::constructor_new (inArgument_key, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 248))  COMMA_SOURCE_FILE ("goil_routines.galgas", 248)) ;
-  GALGAS_string var_prefix_7880 ;
-  GALGAS_string var_tag_5F_to_5F_rep_7903 ;
-  inArgument_p.method_prefix (var_lkey_7821, var_prefix_7880, var_tag_5F_to_5F_rep_7903, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 251)) ;
-  ioArgument_res = ioArgument_res.getter_stringByReplacingStringByString (var_tag_5F_to_5F_rep_7903, var_prefix_7880.add_operation (inArgument_name, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 252)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 252)) ;
+  GALGAS_lstring var_lkey_7927 = GALGAS_lstring::constructor_new (inArgument_key, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 250))  COMMA_SOURCE_FILE ("goil_routines.galgas", 250)) ;
+  GALGAS_string var_prefix_7986 ;
+  GALGAS_string var_tag_5F_to_5F_rep_8009 ;
+  inArgument_p.method_prefix (var_lkey_7927, var_prefix_7986, var_tag_5F_to_5F_rep_8009, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 253)) ;
+  ioArgument_res = ioArgument_res.getter_stringByReplacingStringByString (var_tag_5F_to_5F_rep_8009, var_prefix_7986.add_operation (inArgument_name, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 254)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 254)) ;
 }
 
 
@@ -6487,7 +6530,7 @@ void routine_doReplace (GALGAS_string & ioArgument_s,
                         GALGAS_string inArgument_n,
                         C_Compiler * inCompiler
                         COMMA_UNUSED_LOCATION_ARGS) {
-  ioArgument_s = ioArgument_s.getter_stringByReplacingStringByString (inArgument_o, inArgument_n, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 256)) ;
+  ioArgument_s = ioArgument_s.getter_stringByReplacingStringByString (inArgument_o, inArgument_n, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 258)) ;
 }
 
 
@@ -6505,9 +6548,9 @@ void routine_do_5F_replace_5F_default (GALGAS_string & ioArgument_s,
                                        COMMA_UNUSED_LOCATION_ARGS) {
   const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, inArgument_n.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
   if (kBoolTrue == test_0) {
-    ioArgument_s = ioArgument_s.getter_stringByReplacingStringByString (inArgument_o, inArgument_n, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 261)) ;
+    ioArgument_s = ioArgument_s.getter_stringByReplacingStringByString (inArgument_o, inArgument_n, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 263)) ;
   }else if (kBoolFalse == test_0) {
-    ioArgument_s = ioArgument_s.getter_stringByReplacingStringByString (inArgument_o, inArgument_d, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 263)) ;
+    ioArgument_s = ioArgument_s.getter_stringByReplacingStringByString (inArgument_o, inArgument_d, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 265)) ;
   }
 }
 
@@ -6524,11 +6567,11 @@ void routine_replace_5F_no_5F_prefix (GALGAS_prefix_5F_map inArgument_p,
                                       GALGAS_string & ioArgument_res,
                                       C_Compiler * inCompiler
                                       COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_lkey_8426 = GALGAS_lstring::constructor_new (inArgument_key, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 268))  COMMA_SOURCE_FILE ("goil_routines.galgas", 268)) ;
-  GALGAS_string var_tag_5F_to_5F_rep_8511 ;
-  GALGAS_string joker_8533 ; // Joker input parameter
-  inArgument_p.method_prefix (var_lkey_8426, joker_8533, var_tag_5F_to_5F_rep_8511, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 271)) ;
-  ioArgument_res = ioArgument_res.getter_stringByReplacingStringByString (var_tag_5F_to_5F_rep_8511, inArgument_name, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 272)) ;
+  GALGAS_lstring var_lkey_8532 = GALGAS_lstring::constructor_new (inArgument_key, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 270))  COMMA_SOURCE_FILE ("goil_routines.galgas", 270)) ;
+  GALGAS_string var_tag_5F_to_5F_rep_8617 ;
+  GALGAS_string joker_8639 ; // Joker input parameter
+  inArgument_p.method_prefix (var_lkey_8532, joker_8639, var_tag_5F_to_5F_rep_8617, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 273)) ;
+  ioArgument_res = ioArgument_res.getter_stringByReplacingStringByString (var_tag_5F_to_5F_rep_8617, inArgument_name, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 274)) ;
 }
 
 
@@ -6546,20 +6589,20 @@ void routine_table_5F_core (GALGAS_string inArgument_typename,
                             GALGAS_string & ioArgument_implementation,
                             C_Compiler * inCompiler
                             COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_uint var_n_8962 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_stringset enumerator_8999 (inArgument_names, kENUMERATION_UP) ;
-  while (enumerator_8999.hasCurrentObject ()) {
-    ioArgument_header = ioArgument_header.add_operation (GALGAS_string ("#define "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 291)).add_operation (inArgument_varname, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 291)).add_operation (GALGAS_string ("_id_of_"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 291)).add_operation (enumerator_8999.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 291)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 291)).add_operation (var_n_8962.getter_string (SOURCE_FILE ("goil_routines.galgas", 291)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 291)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 291)) ;
-    ioArgument_header = ioArgument_header.add_operation (GALGAS_string ("#define "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 299)).add_operation (enumerator_8999.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 299)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 299)).add_operation (inArgument_varname, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 299)).add_operation (GALGAS_string ("_id_of_"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 299)).add_operation (enumerator_8999.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 299)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 299)) ;
-    ioArgument_implementation = ioArgument_implementation.add_operation (GALGAS_string ("    (tpl_"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 300)).add_operation (inArgument_typename, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 300)).add_operation (GALGAS_string (" *)&"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 300)).add_operation (inArgument_obj_5F_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 300)).add_operation (enumerator_8999.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 300)) ;
-    var_n_8962.increment_operation (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 301)) ;
-    const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, var_n_8962.objectCompare (inArgument_names.getter_count (SOURCE_FILE ("goil_routines.galgas", 302)))).boolEnum () ;
+  GALGAS_uint var_n_9068 = GALGAS_uint ((uint32_t) 0U) ;
+  cEnumerator_stringset enumerator_9105 (inArgument_names, kENUMERATION_UP) ;
+  while (enumerator_9105.hasCurrentObject ()) {
+    ioArgument_header = ioArgument_header.add_operation (GALGAS_string ("#define "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 293)).add_operation (inArgument_varname, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 293)).add_operation (GALGAS_string ("_id_of_"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 293)).add_operation (enumerator_9105.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 293)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 293)).add_operation (var_n_9068.getter_string (SOURCE_FILE ("goil_routines.galgas", 293)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 293)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 293)) ;
+    ioArgument_header = ioArgument_header.add_operation (GALGAS_string ("#define "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 301)).add_operation (enumerator_9105.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 301)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 301)).add_operation (inArgument_varname, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 301)).add_operation (GALGAS_string ("_id_of_"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 301)).add_operation (enumerator_9105.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 301)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 301)) ;
+    ioArgument_implementation = ioArgument_implementation.add_operation (GALGAS_string ("    (tpl_"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 302)).add_operation (inArgument_typename, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 302)).add_operation (GALGAS_string (" *)&"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 302)).add_operation (inArgument_obj_5F_prefix, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 302)).add_operation (enumerator_9105.current_key (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 302)) ;
+    var_n_9068.increment_operation (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 303)) ;
+    const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, var_n_9068.objectCompare (inArgument_names.getter_count (SOURCE_FILE ("goil_routines.galgas", 304)))).boolEnum () ;
     if (kBoolTrue == test_0) {
-      ioArgument_implementation = ioArgument_implementation.add_operation (GALGAS_string (",\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 303)) ;
+      ioArgument_implementation = ioArgument_implementation.add_operation (GALGAS_string (",\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 305)) ;
     }else if (kBoolFalse == test_0) {
-      ioArgument_implementation = ioArgument_implementation.add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 304)) ;
+      ioArgument_implementation = ioArgument_implementation.add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 306)) ;
     }
-    enumerator_8999.gotoNextObject () ;
+    enumerator_9105.gotoNextObject () ;
   }
 }
 
@@ -6574,53 +6617,131 @@ void routine_add_5F_to_5F_stringset (GALGAS_stringset & ioArgument_ss,
                                      GALGAS_string inArgument_new,
                                      C_Compiler * inCompiler
                                      COMMA_UNUSED_LOCATION_ARGS) {
-  const enumGalgasBool test_0 = ioArgument_ss.getter_hasKey (inArgument_new COMMA_SOURCE_FILE ("goil_routines.galgas", 409)).boolEnum () ;
+  const enumGalgasBool test_0 = ioArgument_ss.getter_hasKey (inArgument_new COMMA_SOURCE_FILE ("goil_routines.galgas", 411)).boolEnum () ;
   if (kBoolTrue == test_0) {
     TC_Array <C_FixItDescription> fixItArray1 ;
-    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 410)), GALGAS_string ("'").add_operation (inArgument_new, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 410)).add_operation (GALGAS_string ("' is already declared before"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 410)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 410)) ;
+    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 412)), GALGAS_string ("'").add_operation (inArgument_new, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 412)).add_operation (GALGAS_string ("' is already declared before"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 412)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 412)) ;
   }else if (kBoolFalse == test_0) {
-    ioArgument_ss.addAssign_operation (inArgument_new  COMMA_SOURCE_FILE ("goil_routines.galgas", 412)) ;
+    ioArgument_ss.addAssign_operation (inArgument_new  COMMA_SOURCE_FILE ("goil_routines.galgas", 414)) ;
   }
 }
 
 
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
-//                                               Routine 'file_in_path'                                                *
+//                                           Once function 'includePathList'                                           *
 //                                                                                                                     *
 //---------------------------------------------------------------------------------------------------------------------*
 
-void routine_file_5F_in_5F_path (GALGAS_lstring & ioArgument_file_5F_name,
-                                 C_Compiler * inCompiler
-                                 COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_string var_include_5F_path_12819 = GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("GOIL_INCLUDE_PATH")  COMMA_SOURCE_FILE ("goil_routines.galgas", 418)) ;
-  GALGAS_stringlist var_systemPaths_13034 = function_allTemplatePaths (GALGAS_string ("config"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 422)) ;
-  GALGAS_stringlist var_includePathList_13096 ;
-  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, var_include_5F_path_12819.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+static GALGAS_stringlist onceFunction_includePathList (C_Compiler * inCompiler
+                                                       COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_stringlist result_path_5F_list ; // Returned variable
+  GALGAS_string var_include_5F_path_13117 = GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("GOIL_INCLUDE_PATH")  COMMA_SOURCE_FILE ("goil_routines.galgas", 424)) ;
+  GALGAS_stringlist var_systemPaths_13332 = function_allTemplatePaths (GALGAS_string ("config"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 428)) ;
+  GALGAS_stringlist var_includePaths_13391 ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, var_include_5F_path_13117.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
   if (kBoolTrue == test_0) {
-    var_includePathList_13096 = var_include_5F_path_12819.getter_componentsSeparatedByString (GALGAS_string (":") COMMA_SOURCE_FILE ("goil_routines.galgas", 425)) ;
+    var_includePaths_13391 = var_include_5F_path_13117.getter_componentsSeparatedByString (GALGAS_string (":") COMMA_SOURCE_FILE ("goil_routines.galgas", 431)) ;
   }else if (kBoolFalse == test_0) {
-    var_includePathList_13096 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("goil_routines.galgas", 427)) ;
-  }
-  GALGAS_stringlist var_path_5F_list_13290 = var_includePathList_13096.add_operation (var_systemPaths_13034, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 429)) ;
-  GALGAS_bool var_not_5F_found_13343 = GALGAS_bool (true) ;
-  cEnumerator_stringlist enumerator_13387 (var_path_5F_list_13290, kENUMERATION_UP) ;
-  while (enumerator_13387.hasCurrentObject ()) {
-    GALGAS_string var_full_5F_file_5F_path_13421 = enumerator_13387.current_mValue (HERE) ;
-    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_full_5F_file_5F_path_13421.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+    var_includePaths_13391 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("goil_routines.galgas", 433)) ;
+  }
+  result_path_5F_list = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("goil_routines.galgas", 436)) ;
+  cEnumerator_stringlist enumerator_13645 (var_includePaths_13391.add_operation (var_systemPaths_13332, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 437)), kENUMERATION_UP) ;
+  while (enumerator_13645.hasCurrentObject ()) {
+    GALGAS_string var_directory_13674 = enumerator_13645.current_mValue (HERE) ;
+    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_directory_13674.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
     if (kBoolTrue == test_1) {
-      const enumGalgasBool test_2 = GALGAS_bool (kIsNotEqual, var_full_5F_file_5F_path_13421.getter_characterAtIndex (var_full_5F_file_5F_path_13421.getter_length (SOURCE_FILE ("goil_routines.galgas", 435)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 435)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 435)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
+      const enumGalgasBool test_2 = GALGAS_bool (kIsNotEqual, var_directory_13674.getter_characterAtIndex (var_directory_13674.getter_length (SOURCE_FILE ("goil_routines.galgas", 440)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 440)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 440)).objectCompare (GALGAS_char (TO_UNICODE (47)))).boolEnum () ;
       if (kBoolTrue == test_2) {
-        var_full_5F_file_5F_path_13421.plusAssign_operation(GALGAS_string ("/"), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 436)) ;
+        var_directory_13674.plusAssign_operation(GALGAS_string ("/"), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 441)) ;
       }
     }
-    var_full_5F_file_5F_path_13421.plusAssign_operation(ioArgument_file_5F_name.getter_string (SOURCE_FILE ("goil_routines.galgas", 439)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 439)) ;
-    const enumGalgasBool test_3 = var_full_5F_file_5F_path_13421.getter_fileExists (SOURCE_FILE ("goil_routines.galgas", 440)).operator_and (var_not_5F_found_13343 COMMA_SOURCE_FILE ("goil_routines.galgas", 440)).boolEnum () ;
-    if (kBoolTrue == test_3) {
-      ioArgument_file_5F_name = GALGAS_lstring::constructor_new (var_full_5F_file_5F_path_13421, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 441))  COMMA_SOURCE_FILE ("goil_routines.galgas", 441)) ;
-      var_not_5F_found_13343 = GALGAS_bool (false) ;
+    result_path_5F_list.addAssign_operation (var_directory_13674  COMMA_SOURCE_FILE ("goil_routines.galgas", 444)) ;
+    enumerator_13645.gotoNextObject () ;
+  }
+//---
+  return result_path_5F_list ;
+}
+
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//  Function implementation                                                                                            *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static bool gOnceFunctionResultAvailable_includePathList = false ;
+static GALGAS_stringlist gOnceFunctionResult_includePathList ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_stringlist function_includePathList (class C_Compiler * inCompiler
+              COMMA_LOCATION_ARGS) {
+  if (! gOnceFunctionResultAvailable_includePathList) {
+    gOnceFunctionResult_includePathList = onceFunction_includePathList (inCompiler COMMA_THERE) ;
+    gOnceFunctionResultAvailable_includePathList = true ;
+  }
+  return gOnceFunctionResult_includePathList ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void releaseOnceFunctionResult_includePathList (void) {
+  gOnceFunctionResult_includePathList.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gEpilogueForOnceFunction_includePathList (NULL,
+                                                             releaseOnceFunctionResult_includePathList) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//  Function introspection                                                                                             *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static const C_galgas_type_descriptor * functionArgs_includePathList [1] = {
+  NULL
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_object functionWithGenericHeader_includePathList (C_Compiler * inCompiler,
+                                                                const cObjectArray & /* inEffectiveParameterArray */,
+                                                                const GALGAS_location & /* inErrorLocation */
+                                                                COMMA_LOCATION_ARGS) {
+  return function_includePathList (inCompiler COMMA_THERE).getter_object (THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_galgas_function_descriptor functionDescriptor_includePathList ("includePathList",
+                                                                 functionWithGenericHeader_includePathList,
+                                                                 & kTypeDescriptor_GALGAS_stringlist,
+                                                                 0,
+                                                                 functionArgs_includePathList) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                               Routine 'file_in_path'                                                *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+void routine_file_5F_in_5F_path (GALGAS_lstring & ioArgument_file_5F_name,
+                                 C_Compiler * inCompiler
+                                 COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool var_not_5F_found_13964 = GALGAS_bool (true) ;
+  cEnumerator_stringlist enumerator_14015 (function_includePathList (inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 451)), kENUMERATION_UP) ;
+  while (enumerator_14015.hasCurrentObject ()) {
+    const enumGalgasBool test_0 = var_not_5F_found_13964.boolEnum () ;
+    if (kBoolTrue == test_0) {
+      GALGAS_string var_full_5F_file_5F_path_14144 = enumerator_14015.current_mValue (HERE).add_operation (ioArgument_file_5F_name.getter_string (SOURCE_FILE ("goil_routines.galgas", 454)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 454)) ;
+      const enumGalgasBool test_1 = var_full_5F_file_5F_path_14144.getter_fileExists (SOURCE_FILE ("goil_routines.galgas", 455)).boolEnum () ;
+      if (kBoolTrue == test_1) {
+        ioArgument_file_5F_name = GALGAS_lstring::constructor_new (var_full_5F_file_5F_path_14144, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 456))  COMMA_SOURCE_FILE ("goil_routines.galgas", 456)) ;
+        var_not_5F_found_13964 = GALGAS_bool (false) ;
+      }
     }
-    enumerator_13387.gotoNextObject () ;
+    enumerator_14015.gotoNextObject () ;
   }
 }
 
@@ -6640,15 +6761,15 @@ void routine_is_5F_in_5F_lstringlist (GALGAS_lstringlist inArgument_l,
   outArgument_f.drop () ; // Release 'out' argument
   outArgument_p.drop () ; // Release 'out' argument
   outArgument_p = GALGAS_bool (false) ;
-  outArgument_f = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 453))  COMMA_SOURCE_FILE ("goil_routines.galgas", 453)) ;
-  cEnumerator_lstringlist enumerator_14030 (inArgument_l, kENUMERATION_UP) ;
-  while (enumerator_14030.hasCurrentObject ()) {
-    const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, enumerator_14030.current_mValue (HERE).getter_string (SOURCE_FILE ("goil_routines.galgas", 455)).objectCompare (inArgument_e.getter_string (SOURCE_FILE ("goil_routines.galgas", 455)))).boolEnum () ;
+  outArgument_f = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 469))  COMMA_SOURCE_FILE ("goil_routines.galgas", 469)) ;
+  cEnumerator_lstringlist enumerator_14548 (inArgument_l, kENUMERATION_UP) ;
+  while (enumerator_14548.hasCurrentObject ()) {
+    const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, enumerator_14548.current_mValue (HERE).getter_string (SOURCE_FILE ("goil_routines.galgas", 471)).objectCompare (inArgument_e.getter_string (SOURCE_FILE ("goil_routines.galgas", 471)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       outArgument_p = GALGAS_bool (true) ;
-      outArgument_f = enumerator_14030.current_mValue (HERE) ;
+      outArgument_f = enumerator_14548.current_mValue (HERE) ;
     }
-    enumerator_14030.gotoNextObject () ;
+    enumerator_14548.gotoNextObject () ;
   }
 }
 
@@ -6665,13 +6786,13 @@ GALGAS_bool function_isInLstringlist (GALGAS_lstringlist inArgument_l,
                                       COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bool result_p ; // Returned variable
   result_p = GALGAS_bool (false) ;
-  cEnumerator_lstringlist enumerator_14228 (inArgument_l, kENUMERATION_UP) ;
-  while (enumerator_14228.hasCurrentObject ()) {
-    const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, enumerator_14228.current_mValue (HERE).getter_string (SOURCE_FILE ("goil_routines.galgas", 468)).objectCompare (inArgument_e.getter_string (SOURCE_FILE ("goil_routines.galgas", 468)))).boolEnum () ;
+  cEnumerator_lstringlist enumerator_14746 (inArgument_l, kENUMERATION_UP) ;
+  while (enumerator_14746.hasCurrentObject ()) {
+    const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, enumerator_14746.current_mValue (HERE).getter_string (SOURCE_FILE ("goil_routines.galgas", 484)).objectCompare (inArgument_e.getter_string (SOURCE_FILE ("goil_routines.galgas", 484)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       result_p = GALGAS_bool (true) ;
     }
-    enumerator_14228.gotoNextObject () ;
+    enumerator_14746.gotoNextObject () ;
   }
 //---
   return result_p ;
@@ -6725,19 +6846,19 @@ void routine_add_5F_lstring_5F_unique (GALGAS_lstringlist & ioArgument_l,
                                        GALGAS_string inArgument_att,
                                        C_Compiler * inCompiler
                                        COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_bool var_found_14388 ;
-  GALGAS_lstring var_res_14403 ;
+  GALGAS_bool var_found_14906 ;
+  GALGAS_lstring var_res_14921 ;
   {
-  routine_is_5F_in_5F_lstringlist (ioArgument_l, inArgument_e, var_res_14403, var_found_14388, inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 480)) ;
+  routine_is_5F_in_5F_lstringlist (ioArgument_l, inArgument_e, var_res_14921, var_found_14906, inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 496)) ;
   }
-  const enumGalgasBool test_0 = var_found_14388.boolEnum () ;
+  const enumGalgasBool test_0 = var_found_14906.boolEnum () ;
   if (kBoolTrue == test_0) {
     TC_Array <C_FixItDescription> fixItArray1 ;
-    inCompiler->emitSemanticError (inArgument_e.getter_location (SOURCE_FILE ("goil_routines.galgas", 482)), inArgument_att.add_operation (GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 482)).add_operation (inArgument_e.getter_string (SOURCE_FILE ("goil_routines.galgas", 482)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 482)).add_operation (GALGAS_string (" has already be listed"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 482)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 482)) ;
+    inCompiler->emitSemanticError (inArgument_e.getter_location (SOURCE_FILE ("goil_routines.galgas", 498)), inArgument_att.add_operation (GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 498)).add_operation (inArgument_e.getter_string (SOURCE_FILE ("goil_routines.galgas", 498)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 498)).add_operation (GALGAS_string (" has already be listed"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 498)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 498)) ;
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (var_res_14403.getter_location (SOURCE_FILE ("goil_routines.galgas", 483)), GALGAS_string ("was listed here"), fixItArray2  COMMA_SOURCE_FILE ("goil_routines.galgas", 483)) ;
+    inCompiler->emitSemanticError (var_res_14921.getter_location (SOURCE_FILE ("goil_routines.galgas", 499)), GALGAS_string ("was listed here"), fixItArray2  COMMA_SOURCE_FILE ("goil_routines.galgas", 499)) ;
   }else if (kBoolFalse == test_0) {
-    ioArgument_l.addAssign_operation (inArgument_e  COMMA_SOURCE_FILE ("goil_routines.galgas", 485)) ;
+    ioArgument_l.addAssign_operation (inArgument_e  COMMA_SOURCE_FILE ("goil_routines.galgas", 501)) ;
   }
 }
 
@@ -6753,14 +6874,14 @@ void routine_set_5F_lstring_5F_if_5F_empty (GALGAS_lstring & ioArgument_s,
                                             GALGAS_string inArgument_att,
                                             C_Compiler * inCompiler
                                             COMMA_UNUSED_LOCATION_ARGS) {
-  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, ioArgument_s.getter_string (SOURCE_FILE ("goil_routines.galgas", 493)).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, ioArgument_s.getter_string (SOURCE_FILE ("goil_routines.galgas", 509)).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
   if (kBoolTrue == test_0) {
     ioArgument_s = inArgument_ns ;
   }else if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray1 ;
-    inCompiler->emitSemanticError (inArgument_ns.getter_location (SOURCE_FILE ("goil_routines.galgas", 496)), inArgument_att.add_operation (GALGAS_string (" Redefinition"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 496)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 496)) ;
+    inCompiler->emitSemanticError (inArgument_ns.getter_location (SOURCE_FILE ("goil_routines.galgas", 512)), inArgument_att.add_operation (GALGAS_string (" Redefinition"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 512)), fixItArray1  COMMA_SOURCE_FILE ("goil_routines.galgas", 512)) ;
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (ioArgument_s.getter_location (SOURCE_FILE ("goil_routines.galgas", 497)), GALGAS_string ("was defined here"), fixItArray2  COMMA_SOURCE_FILE ("goil_routines.galgas", 497)) ;
+    inCompiler->emitSemanticError (ioArgument_s.getter_location (SOURCE_FILE ("goil_routines.galgas", 513)), GALGAS_string ("was defined here"), fixItArray2  COMMA_SOURCE_FILE ("goil_routines.galgas", 513)) ;
   }
 }
 
@@ -6778,7 +6899,7 @@ void routine_add_5F_makefile_5F_flag_5F_if_5F_not_5F_empty (GALGAS_string & ioAr
                                                             COMMA_UNUSED_LOCATION_ARGS) {
   const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, inArgument_flag_5F_value.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
   if (kBoolTrue == test_0) {
-    ioArgument_receiver.plusAssign_operation(inArgument_flag_5F_name.add_operation (GALGAS_string ("="), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 506)).add_operation (inArgument_flag_5F_value, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 506)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 506)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 506)) ;
+    ioArgument_receiver.plusAssign_operation(inArgument_flag_5F_name.add_operation (GALGAS_string ("="), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 522)).add_operation (inArgument_flag_5F_value, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 522)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 522)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 522)) ;
   }
 }
 
@@ -6793,7 +6914,7 @@ GALGAS_lstring function_lstringWith (GALGAS_string inArgument_s,
                                      C_Compiler * inCompiler
                                      COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_lstring result_r ; // Returned variable
-  result_r = GALGAS_lstring::constructor_new (inArgument_s, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 511))  COMMA_SOURCE_FILE ("goil_routines.galgas", 511)) ;
+  result_r = GALGAS_lstring::constructor_new (inArgument_s, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 527))  COMMA_SOURCE_FILE ("goil_routines.galgas", 527)) ;
 //---
   return result_r ;
 }
@@ -6840,69 +6961,69 @@ GALGAS_string function_stripString (GALGAS_string inArgument_s,
                                     C_Compiler * inCompiler
                                     COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result_r ; // Returned variable
-  const enumGalgasBool test_0 = GALGAS_bool (kIsStrictSup, inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 515)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsStrictSup, inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 531)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
   if (kBoolTrue == test_0) {
-    GALGAS_uint var_first_15136 = GALGAS_uint ((uint32_t) 0U) ;
-    GALGAS_uint var_last_15155 = inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 517)) ;
-    GALGAS_bool var_finished_15243 = GALGAS_bool (false) ;
-    if (inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 520)).isValid ()) {
-      uint32_t variant_15260 = inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 520)).uintValue () ;
-      bool loop_15260 = true ;
-      while (loop_15260) {
-        loop_15260 = var_finished_15243.operator_not (SOURCE_FILE ("goil_routines.galgas", 521)).isValid () ;
-        if (loop_15260) {
-          loop_15260 = var_finished_15243.operator_not (SOURCE_FILE ("goil_routines.galgas", 521)).boolValue () ;
+    GALGAS_uint var_first_15654 = GALGAS_uint ((uint32_t) 0U) ;
+    GALGAS_uint var_last_15673 = inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 533)) ;
+    GALGAS_bool var_finished_15761 = GALGAS_bool (false) ;
+    if (inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 536)).isValid ()) {
+      uint32_t variant_15778 = inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 536)).uintValue () ;
+      bool loop_15778 = true ;
+      while (loop_15778) {
+        loop_15778 = var_finished_15761.operator_not (SOURCE_FILE ("goil_routines.galgas", 537)).isValid () ;
+        if (loop_15778) {
+          loop_15778 = var_finished_15761.operator_not (SOURCE_FILE ("goil_routines.galgas", 537)).boolValue () ;
         }
-        if (loop_15260 && (0 == variant_15260)) {
-          loop_15260 = false ;
-          inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 520)) ;
+        if (loop_15778 && (0 == variant_15778)) {
+          loop_15778 = false ;
+          inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 536)) ;
         }
-        if (loop_15260) {
-          variant_15260 -- ;
-          const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, inArgument_s.getter_characterAtIndex (var_first_15136, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 522)).objectCompare (GALGAS_char (TO_UNICODE (32)))).boolEnum () ;
+        if (loop_15778) {
+          variant_15778 -- ;
+          const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, inArgument_s.getter_characterAtIndex (var_first_15654, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 538)).objectCompare (GALGAS_char (TO_UNICODE (32)))).boolEnum () ;
           if (kBoolTrue == test_1) {
-            var_first_15136.increment_operation (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 523)) ;
-            const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, var_first_15136.objectCompare (inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 524)))).boolEnum () ;
+            var_first_15654.increment_operation (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 539)) ;
+            const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, var_first_15654.objectCompare (inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 540)))).boolEnum () ;
             if (kBoolTrue == test_2) {
-              var_finished_15243 = GALGAS_bool (true) ;
+              var_finished_15761 = GALGAS_bool (true) ;
             }
           }else if (kBoolFalse == test_1) {
-            var_finished_15243 = GALGAS_bool (true) ;
+            var_finished_15761 = GALGAS_bool (true) ;
           }
         }
       }
     }
-    var_finished_15243 = GALGAS_bool (false) ;
-    if (inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 529)).isValid ()) {
-      uint32_t variant_15545 = inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 529)).uintValue () ;
-      bool loop_15545 = true ;
-      while (loop_15545) {
-        loop_15545 = var_finished_15243.operator_not (SOURCE_FILE ("goil_routines.galgas", 530)).isValid () ;
-        if (loop_15545) {
-          loop_15545 = var_finished_15243.operator_not (SOURCE_FILE ("goil_routines.galgas", 530)).boolValue () ;
+    var_finished_15761 = GALGAS_bool (false) ;
+    if (inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 545)).isValid ()) {
+      uint32_t variant_16063 = inArgument_s.getter_length (SOURCE_FILE ("goil_routines.galgas", 545)).uintValue () ;
+      bool loop_16063 = true ;
+      while (loop_16063) {
+        loop_16063 = var_finished_15761.operator_not (SOURCE_FILE ("goil_routines.galgas", 546)).isValid () ;
+        if (loop_16063) {
+          loop_16063 = var_finished_15761.operator_not (SOURCE_FILE ("goil_routines.galgas", 546)).boolValue () ;
         }
-        if (loop_15545 && (0 == variant_15545)) {
-          loop_15545 = false ;
-          inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 529)) ;
+        if (loop_16063 && (0 == variant_16063)) {
+          loop_16063 = false ;
+          inCompiler->loopRunTimeVariantError (SOURCE_FILE ("goil_routines.galgas", 545)) ;
         }
-        if (loop_15545) {
-          variant_15545 -- ;
-          const enumGalgasBool test_3 = GALGAS_bool (kIsEqual, inArgument_s.getter_characterAtIndex (var_last_15155.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 531)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 531)).objectCompare (GALGAS_char (TO_UNICODE (32)))).boolEnum () ;
+        if (loop_16063) {
+          variant_16063 -- ;
+          const enumGalgasBool test_3 = GALGAS_bool (kIsEqual, inArgument_s.getter_characterAtIndex (var_last_15673.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 547)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 547)).objectCompare (GALGAS_char (TO_UNICODE (32)))).boolEnum () ;
           if (kBoolTrue == test_3) {
-            var_last_15155.decrement_operation (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 532)) ;
-            const enumGalgasBool test_4 = GALGAS_bool (kIsEqual, var_last_15155.objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+            var_last_15673.decrement_operation (inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 548)) ;
+            const enumGalgasBool test_4 = GALGAS_bool (kIsEqual, var_last_15673.objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
             if (kBoolTrue == test_4) {
-              var_finished_15243 = GALGAS_bool (true) ;
+              var_finished_15761 = GALGAS_bool (true) ;
             }
           }else if (kBoolFalse == test_3) {
-            var_finished_15243 = GALGAS_bool (true) ;
+            var_finished_15761 = GALGAS_bool (true) ;
           }
         }
       }
     }
-    const enumGalgasBool test_5 = GALGAS_bool (kIsStrictInf, var_first_15136.objectCompare (var_last_15155)).boolEnum () ;
+    const enumGalgasBool test_5 = GALGAS_bool (kIsStrictInf, var_first_15654.objectCompare (var_last_15673)).boolEnum () ;
     if (kBoolTrue == test_5) {
-      result_r = inArgument_s.getter_subString (var_first_15136, var_last_15155.substract_operation (var_first_15136, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 538)) COMMA_SOURCE_FILE ("goil_routines.galgas", 538)) ;
+      result_r = inArgument_s.getter_subString (var_first_15654, var_last_15673.substract_operation (var_first_15654, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 554)) COMMA_SOURCE_FILE ("goil_routines.galgas", 554)) ;
     }else if (kBoolFalse == test_5) {
       result_r = GALGAS_string::makeEmptyString () ;
     }
@@ -6956,15 +7077,15 @@ void routine_errorNoFileFound (const GALGAS_stringlist constinArgument_searchedP
                                const GALGAS_lstring constinArgument_file,
                                C_Compiler * inCompiler
                                COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_string var_m_16011 = GALGAS_string ("cannot find a valid path for the '").add_operation (constinArgument_file.getter_string (SOURCE_FILE ("goil_routines.galgas", 551)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 551)).add_operation (GALGAS_string ("' "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 551)).add_operation (constinArgument_kind, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 551)).add_operation (GALGAS_string (" file. I have tried:"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 551)) ;
-  cEnumerator_stringlist enumerator_16123 (constinArgument_searchedPaths, kENUMERATION_UP) ;
-  while (enumerator_16123.hasCurrentObject ()) {
-    var_m_16011.plusAssign_operation(GALGAS_string ("\n"
-      "  - '").add_operation (enumerator_16123.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 553)).add_operation (GALGAS_string ("'"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 553)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 553)) ;
-    enumerator_16123.gotoNextObject () ;
+  GALGAS_string var_m_16529 = GALGAS_string ("cannot find a valid path for the '").add_operation (constinArgument_file.getter_string (SOURCE_FILE ("goil_routines.galgas", 567)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 567)).add_operation (GALGAS_string ("' "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 567)).add_operation (constinArgument_kind, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 567)).add_operation (GALGAS_string (" file. I have tried:"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 567)) ;
+  cEnumerator_stringlist enumerator_16641 (constinArgument_searchedPaths, kENUMERATION_UP) ;
+  while (enumerator_16641.hasCurrentObject ()) {
+    var_m_16529.plusAssign_operation(GALGAS_string ("\n"
+      "  - '").add_operation (enumerator_16641.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 569)).add_operation (GALGAS_string ("'"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 569)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 569)) ;
+    enumerator_16641.gotoNextObject () ;
   }
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (constinArgument_file.getter_location (SOURCE_FILE ("goil_routines.galgas", 555)), var_m_16011, fixItArray0  COMMA_SOURCE_FILE ("goil_routines.galgas", 555)) ;
+  inCompiler->emitSemanticError (constinArgument_file.getter_location (SOURCE_FILE ("goil_routines.galgas", 571)), var_m_16529, fixItArray0  COMMA_SOURCE_FILE ("goil_routines.galgas", 571)) ;
 }
 
 
@@ -6978,7 +7099,7 @@ GALGAS_string function_stringLBool (const GALGAS_lbool & constinArgument_boolVal
                                     C_Compiler * /* inCompiler */
                                     COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result_result ; // Returned variable
-  const enumGalgasBool test_0 = constinArgument_boolValue.getter_bool (SOURCE_FILE ("goil_routines.galgas", 561)).boolEnum () ;
+  const enumGalgasBool test_0 = constinArgument_boolValue.getter_bool (SOURCE_FILE ("goil_routines.galgas", 577)).boolEnum () ;
   if (kBoolTrue == test_0) {
     result_result = GALGAS_string ("TRUE") ;
   }else if (kBoolFalse == test_0) {
@@ -7020,6 +7141,614 @@ C_galgas_function_descriptor functionDescriptor_stringLBool ("stringLBool",
                                                              1,
                                                              functionArgs_stringLBool) ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                     Class for element of '@phaseTimeList' list                                      *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cCollectionElement_phaseTimeList : public cCollectionElement {
+  public : GALGAS_phaseTimeList_2D_element mObject ;
+
+//--- Constructor
+  public : cCollectionElement_phaseTimeList (const GALGAS_string & in_phase,
+                                             const GALGAS_uint & in_endTime
+                                             COMMA_LOCATION_ARGS) ;
+
+//--- Virtual method for comparing elements
+  public : virtual typeComparisonResult compare (const cCollectionElement * inOperand) const ;
+
+//--- Virtual method that checks that all attributes are valid
+  public : virtual bool isValid (void) const ;
+
+//--- Virtual method that returns a copy of current object
+  public : virtual cCollectionElement * copy (void) ;
+
+//--- Description
+  public : virtual void description (C_String & ioString, const int32_t inIndentation) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cCollectionElement_phaseTimeList::cCollectionElement_phaseTimeList (const GALGAS_string & in_phase,
+                                                                    const GALGAS_uint & in_endTime
+                                                                    COMMA_LOCATION_ARGS) :
+cCollectionElement (THERE),
+mObject (in_phase, in_endTime) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool cCollectionElement_phaseTimeList::isValid (void) const {
+  return mObject.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cCollectionElement * cCollectionElement_phaseTimeList::copy (void) {
+  cCollectionElement * result = NULL ;
+  macroMyNew (result, cCollectionElement_phaseTimeList (mObject.mProperty_phase, mObject.mProperty_endTime COMMA_HERE)) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void cCollectionElement_phaseTimeList::description (C_String & ioString, const int32_t inIndentation) const {
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "phase" ":" ;
+  mObject.mProperty_phase.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "endTime" ":" ;
+  mObject.mProperty_endTime.description (ioString, inIndentation) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult cCollectionElement_phaseTimeList::compare (const cCollectionElement * inOperand) const {
+  cCollectionElement_phaseTimeList * operand = (cCollectionElement_phaseTimeList *) inOperand ;
+  macroValidSharedObject (operand, cCollectionElement_phaseTimeList) ;
+  return mObject.objectCompare (operand->mObject) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList::GALGAS_phaseTimeList (void) :
+AC_GALGAS_list () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList::GALGAS_phaseTimeList (const capCollectionElementArray & inSharedArray) :
+AC_GALGAS_list (inSharedArray) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList GALGAS_phaseTimeList::constructor_emptyList (UNUSED_LOCATION_ARGS) {
+  return GALGAS_phaseTimeList  (capCollectionElementArray ()) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList GALGAS_phaseTimeList::constructor_listWithValue (const GALGAS_string & inOperand0,
+                                                                      const GALGAS_uint & inOperand1
+                                                                      COMMA_LOCATION_ARGS) {
+  GALGAS_phaseTimeList result ;
+  if (inOperand0.isValid () && inOperand1.isValid ()) {
+    result = GALGAS_phaseTimeList (capCollectionElementArray ()) ;
+    capCollectionElement attributes ;
+    GALGAS_phaseTimeList::makeAttributesFromObjects (attributes, inOperand0, inOperand1 COMMA_THERE) ;
+    result.appendObject (attributes) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::makeAttributesFromObjects (capCollectionElement & outAttributes,
+                                                      const GALGAS_string & in_phase,
+                                                      const GALGAS_uint & in_endTime
+                                                      COMMA_LOCATION_ARGS) {
+  cCollectionElement_phaseTimeList * p = NULL ;
+  macroMyNew (p, cCollectionElement_phaseTimeList (in_phase,
+                                                   in_endTime COMMA_THERE)) ;
+  outAttributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::addAssign_operation (const GALGAS_string & inOperand0,
+                                                const GALGAS_uint & inOperand1
+                                                COMMA_LOCATION_ARGS) {
+  if (isValid () && inOperand0.isValid () && inOperand1.isValid ()) {
+    cCollectionElement * p = NULL ;
+    macroMyNew (p, cCollectionElement_phaseTimeList (inOperand0, inOperand1 COMMA_THERE)) ;
+    capCollectionElement attributes ;
+    attributes.setPointer (p) ;
+    macroDetachSharedObject (p) ;
+    appendObject (attributes) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::setter_insertAtIndex (const GALGAS_string inOperand0,
+                                                 const GALGAS_uint inOperand1,
+                                                 const GALGAS_uint inInsertionIndex,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) {
+  if (isValid () && inInsertionIndex.isValid () && inOperand0.isValid () && inOperand1.isValid ()) {
+    cCollectionElement * p = NULL ;
+    macroMyNew (p, cCollectionElement_phaseTimeList (inOperand0, inOperand1 COMMA_THERE)) ;
+    capCollectionElement attributes ;
+    attributes.setPointer (p) ;
+    macroDetachSharedObject (p) ;
+    insertObjectAtIndex (attributes, inInsertionIndex.uintValue (), inCompiler COMMA_THERE) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::setter_removeAtIndex (GALGAS_string & outOperand0,
+                                                 GALGAS_uint & outOperand1,
+                                                 const GALGAS_uint inRemoveIndex,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) {
+  if (isValid () && inRemoveIndex.isValid ()) {
+    capCollectionElement attributes ;
+    removeObjectAtIndex (attributes, inRemoveIndex.uintValue (), inCompiler COMMA_THERE) ;
+    cCollectionElement_phaseTimeList * p = (cCollectionElement_phaseTimeList *) attributes.ptr () ;
+    if (NULL == p) {
+      outOperand0.drop () ;
+      outOperand1.drop () ;
+    }else{
+      macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+      outOperand0 = p->mObject.mProperty_phase ;
+      outOperand1 = p->mObject.mProperty_endTime ;
+    }
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::setter_popFirst (GALGAS_string & outOperand0,
+                                            GALGAS_uint & outOperand1,
+                                            C_Compiler * inCompiler
+                                            COMMA_LOCATION_ARGS) {
+  capCollectionElement attributes ;
+  removeFirstObject (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_phaseTimeList * p = (cCollectionElement_phaseTimeList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+    outOperand0 = p->mObject.mProperty_phase ;
+    outOperand1 = p->mObject.mProperty_endTime ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::setter_popLast (GALGAS_string & outOperand0,
+                                           GALGAS_uint & outOperand1,
+                                           C_Compiler * inCompiler
+                                           COMMA_LOCATION_ARGS) {
+  capCollectionElement attributes ;
+  removeLastObject (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_phaseTimeList * p = (cCollectionElement_phaseTimeList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+    outOperand0 = p->mObject.mProperty_phase ;
+    outOperand1 = p->mObject.mProperty_endTime ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::method_first (GALGAS_string & outOperand0,
+                                         GALGAS_uint & outOperand1,
+                                         C_Compiler * inCompiler
+                                         COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes ;
+  readFirst (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_phaseTimeList * p = (cCollectionElement_phaseTimeList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+    outOperand0 = p->mObject.mProperty_phase ;
+    outOperand1 = p->mObject.mProperty_endTime ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::method_last (GALGAS_string & outOperand0,
+                                        GALGAS_uint & outOperand1,
+                                        C_Compiler * inCompiler
+                                        COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes ;
+  readLast (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_phaseTimeList * p = (cCollectionElement_phaseTimeList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+    outOperand0 = p->mObject.mProperty_phase ;
+    outOperand1 = p->mObject.mProperty_endTime ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList GALGAS_phaseTimeList::add_operation (const GALGAS_phaseTimeList & inOperand,
+                                                          C_Compiler * /* inCompiler */
+                                                          COMMA_UNUSED_LOCATION_ARGS) const {
+  GALGAS_phaseTimeList result ;
+  if (isValid () && inOperand.isValid ()) {
+    result = *this ;
+    result.appendList (inOperand) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList GALGAS_phaseTimeList::getter_subListWithRange (const GALGAS_range & inRange,
+                                                                    C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) const {
+  GALGAS_phaseTimeList result = GALGAS_phaseTimeList::constructor_emptyList (THERE) ;
+  subListWithRange (result, inRange, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList GALGAS_phaseTimeList::getter_subListFromIndex (const GALGAS_uint & inIndex,
+                                                                    C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) const {
+  GALGAS_phaseTimeList result = GALGAS_phaseTimeList::constructor_emptyList (THERE) ;
+  subListFromIndex (result, inIndex, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList GALGAS_phaseTimeList::getter_subListToIndex (const GALGAS_uint & inIndex,
+                                                                  C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) const {
+  GALGAS_phaseTimeList result = GALGAS_phaseTimeList::constructor_emptyList (THERE) ;
+  subListToIndex (result, inIndex, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList::plusAssign_operation (const GALGAS_phaseTimeList inOperand,
+                                                 C_Compiler * /* inCompiler */
+                                                 COMMA_UNUSED_LOCATION_ARGS) {
+  appendList (inOperand) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string GALGAS_phaseTimeList::getter_phaseAtIndex (const GALGAS_uint & inIndex,
+                                                         C_Compiler * inCompiler
+                                                         COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes = readObjectAtIndex (inIndex, inCompiler COMMA_THERE) ;
+  cCollectionElement_phaseTimeList * p = (cCollectionElement_phaseTimeList *) attributes.ptr () ;
+  GALGAS_string result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+    result = p->mObject.mProperty_phase ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_phaseTimeList::getter_endTimeAtIndex (const GALGAS_uint & inIndex,
+                                                         C_Compiler * inCompiler
+                                                         COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes = readObjectAtIndex (inIndex, inCompiler COMMA_THERE) ;
+  cCollectionElement_phaseTimeList * p = (cCollectionElement_phaseTimeList *) attributes.ptr () ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+    result = p->mObject.mProperty_endTime ;
+  }
+  return result ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cEnumerator_phaseTimeList::cEnumerator_phaseTimeList (const GALGAS_phaseTimeList & inEnumeratedObject,
+                                                      const typeEnumerationOrder inOrder) :
+cGenericAbstractEnumerator (inOrder) {
+  inEnumeratedObject.populateEnumerationArray (mEnumerationArray) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList_2D_element cEnumerator_phaseTimeList::current (LOCATION_ARGS) const {
+  const cCollectionElement_phaseTimeList * p = (const cCollectionElement_phaseTimeList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+  return p->mObject ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string cEnumerator_phaseTimeList::current_phase (LOCATION_ARGS) const {
+  const cCollectionElement_phaseTimeList * p = (const cCollectionElement_phaseTimeList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+  return p->mObject.mProperty_phase ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_phaseTimeList::current_endTime (LOCATION_ARGS) const {
+  const cCollectionElement_phaseTimeList * p = (const cCollectionElement_phaseTimeList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_phaseTimeList) ;
+  return p->mObject.mProperty_endTime ;
+}
+
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                                 @phaseTimeList type                                                 *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_phaseTimeList ("phaseTimeList",
+                                      NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_phaseTimeList::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_phaseTimeList ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_phaseTimeList::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_phaseTimeList (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList GALGAS_phaseTimeList::extractObject (const GALGAS_object & inObject,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_LOCATION_ARGS) {
+  GALGAS_phaseTimeList result ;
+  const GALGAS_phaseTimeList * p = (const GALGAS_phaseTimeList *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_phaseTimeList *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("phaseTimeList", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList_2D_element::GALGAS_phaseTimeList_2D_element (void) :
+mProperty_phase (),
+mProperty_endTime () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList_2D_element::~ GALGAS_phaseTimeList_2D_element (void) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList_2D_element::GALGAS_phaseTimeList_2D_element (const GALGAS_string & inOperand0,
+                                                                  const GALGAS_uint & inOperand1) :
+mProperty_phase (inOperand0),
+mProperty_endTime (inOperand1) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList_2D_element GALGAS_phaseTimeList_2D_element::constructor_default (UNUSED_LOCATION_ARGS) {
+  return GALGAS_phaseTimeList_2D_element (GALGAS_string::constructor_default (HERE),
+                                          GALGAS_uint::constructor_default (HERE)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList_2D_element GALGAS_phaseTimeList_2D_element::constructor_new (const GALGAS_string & inOperand0,
+                                                                                  const GALGAS_uint & inOperand1 
+                                                                                  COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_phaseTimeList_2D_element result ;
+  if (inOperand0.isValid () && inOperand1.isValid ()) {
+    result = GALGAS_phaseTimeList_2D_element (inOperand0, inOperand1) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult GALGAS_phaseTimeList_2D_element::objectCompare (const GALGAS_phaseTimeList_2D_element & inOperand) const {
+   typeComparisonResult result = kOperandEqual ;
+  if (result == kOperandEqual) {
+    result = mProperty_phase.objectCompare (inOperand.mProperty_phase) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_endTime.objectCompare (inOperand.mProperty_endTime) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool GALGAS_phaseTimeList_2D_element::isValid (void) const {
+  return mProperty_phase.isValid () && mProperty_endTime.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList_2D_element::drop (void) {
+  mProperty_phase.drop () ;
+  mProperty_endTime.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_phaseTimeList_2D_element::description (C_String & ioString,
+                                                   const int32_t inIndentation) const {
+  ioString << "<struct @phaseTimeList-element:" ;
+  if (! isValid ()) {
+    ioString << " not built" ;
+  }else{
+    mProperty_phase.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_endTime.description (ioString, inIndentation+1) ;
+  }
+  ioString << ">" ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string GALGAS_phaseTimeList_2D_element::getter_phase (UNUSED_LOCATION_ARGS) const {
+  return mProperty_phase ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_phaseTimeList_2D_element::getter_endTime (UNUSED_LOCATION_ARGS) const {
+  return mProperty_endTime ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                             @phaseTimeList-element type                                             *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_phaseTimeList_2D_element ("phaseTimeList-element",
+                                                 NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_phaseTimeList_2D_element::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_phaseTimeList_2D_element ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_phaseTimeList_2D_element::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_phaseTimeList_2D_element (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_phaseTimeList_2D_element GALGAS_phaseTimeList_2D_element::extractObject (const GALGAS_object & inObject,
+                                                                                C_Compiler * inCompiler
+                                                                                COMMA_LOCATION_ARGS) {
+  GALGAS_phaseTimeList_2D_element result ;
+  const GALGAS_phaseTimeList_2D_element * p = (const GALGAS_phaseTimeList_2D_element *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_phaseTimeList_2D_element *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("phaseTimeList-element", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                                 Routine 'endPhase'                                                  *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+void routine_endPhase (GALGAS_phaseTimeList & ioArgument_phases,
+                       const GALGAS_timer constinArgument_runTimer,
+                       const GALGAS_string constinArgument_phase,
+                       C_Compiler * /* inCompiler */
+                       COMMA_UNUSED_LOCATION_ARGS) {
+  const enumGalgasBool test_0 = GALGAS_bool (gOption_goil_5F_options_stats.getter_value ()).operator_or (GALGAS_bool (kIsNotEqual, GALGAS_string (gOption_goil_5F_options_stats_5F_file.getter_value ()).objectCompare (GALGAS_string::makeEmptyString ())) COMMA_SOURCE_FILE ("goil_routines.galgas", 598)).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    ioArgument_phases.addAssign_operation (constinArgument_phase, constinArgument_runTimer.getter_msFromStart (SOURCE_FILE ("goil_routines.galgas", 599))  COMMA_SOURCE_FILE ("goil_routines.galgas", 599)) ;
+  }
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                             Routine 'reportPhaseTimes'                                              *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+void routine_reportPhaseTimes (const GALGAS_phaseTimeList constinArgument_phases,
+                               C_Compiler * inCompiler
+                               COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_string var_text_17420 = GALGAS_string::makeEmptyString () ;
+  GALGAS_string var_json_17440 = GALGAS_string ("{\n"
+    "  \"phases\": [\n") ;
+  GALGAS_uint var_startTime_17483 = GALGAS_uint ((uint32_t) 0U) ;
+  cEnumerator_phaseTimeList enumerator_17506 (constinArgument_phases, kENUMERATION_UP) ;
+  while (enumerator_17506.hasCurrentObject ()) {
+    GALGAS_uint var_time_17524 = GALGAS_uint ((uint32_t) 0U) ;
+    const enumGalgasBool test_0 = GALGAS_bool (kIsStrictSup, enumerator_17506.current_endTime (HERE).objectCompare (var_startTime_17483)).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      var_time_17524 = enumerator_17506.current_endTime (HERE).substract_operation (var_startTime_17483, inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 611)) ;
+    }
+    var_text_17420.plusAssign_operation(enumerator_17506.current_phase (HERE).getter_stringByRightPadding (GALGAS_uint ((uint32_t) 24U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("goil_routines.galgas", 613)).add_operation (var_time_17524.getter_string (SOURCE_FILE ("goil_routines.galgas", 614)).getter_stringByLeftPadding (GALGAS_uint ((uint32_t) 8U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("goil_routines.galgas", 614)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 613)).add_operation (GALGAS_string (" ms\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 614)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 613)) ;
+    var_json_17440.plusAssign_operation(GALGAS_string ("    { \"phase\": \"").add_operation (enumerator_17506.current_phase (HERE), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 615)).add_operation (GALGAS_string ("\", \"time_ms\": "), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 615)).add_operation (var_time_17524.getter_string (SOURCE_FILE ("goil_routines.galgas", 615)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 615)).add_operation (GALGAS_string (" }"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 615)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 615)) ;
+    var_startTime_17483 = enumerator_17506.current_endTime (HERE) ;
+    if (enumerator_17506.hasNextObject ()) {
+      var_json_17440.plusAssign_operation(GALGAS_string (",\n"), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 618)) ;
+    }
+    enumerator_17506.gotoNextObject () ;
+  }
+  var_text_17420.plusAssign_operation(GALGAS_string ("total").getter_stringByRightPadding (GALGAS_uint ((uint32_t) 24U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("goil_routines.galgas", 620)).add_operation (var_startTime_17483.getter_string (SOURCE_FILE ("goil_routines.galgas", 621)).getter_stringByLeftPadding (GALGAS_uint ((uint32_t) 8U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("goil_routines.galgas", 621)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 620)).add_operation (GALGAS_string (" ms\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 621)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 620)) ;
+  var_json_17440.plusAssign_operation(GALGAS_string ("\n"
+    "  ],\n"
+    "  \"total_ms\": ").add_operation (var_startTime_17483.getter_string (SOURCE_FILE ("goil_routines.galgas", 622)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 622)).add_operation (GALGAS_string ("\n"
+    "}\n"), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 622)), inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 622)) ;
+  const enumGalgasBool test_1 = GALGAS_bool (gOption_goil_5F_options_stats.getter_value ()).boolEnum () ;
+  if (kBoolTrue == test_1) {
+    inCompiler->printMessage (var_text_17420  COMMA_SOURCE_FILE ("goil_routines.galgas", 624)) ;
+  }
+  const enumGalgasBool test_2 = GALGAS_bool (kIsNotEqual, GALGAS_string (gOption_goil_5F_options_stats_5F_file.getter_value ()).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+  if (kBoolTrue == test_2) {
+    var_json_17440.method_writeToFile (GALGAS_string (gOption_goil_5F_options_stats_5F_file.getter_value ()), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 627)) ;
+  }
+}
+
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                 Overriding extension method '@structAttribute set'                                  *
@@ -354,6 +354,15 @@ class GALGAS_string function_add_5F_path_5F_component (class GALGAS_string inArg
 class GALGAS_string function_rootTemplatesDirectory (class C_Compiler * inCompiler
                                                      COMMA_LOCATION_ARGS) ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                             Function 'includePathList'                                              *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_stringlist function_includePathList (class C_Compiler * inCompiler
+                                                  COMMA_LOCATION_ARGS) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                             Function 'templateFilePath'                                             *
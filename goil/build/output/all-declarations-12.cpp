@@ -1430,10 +1430,8 @@ static void routine_programRule_5F__33_ (const GALGAS_lstring constinArgument_in
   {
   routine_checkTemplatesPath (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 48)) ;
   }
-  GALGAS_arxmlNode var_root_1353 ;
-  var_root_1353.drop () ;
-  cGrammar_arxml_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile, var_root_1353, GALGAS_bool (true), GALGAS_bool (true)  COMMA_SOURCE_FILE ("goil_program.galgas", 49)) ;
-  callExtensionMethod_print ((const cPtr_arxmlNode *) var_root_1353.ptr (), GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("goil_program.galgas", 53)) ;
+  GALGAS_arxmlNode joker_1338 ; // Joker input parameter
+  cGrammar_arxml_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile, joker_1338, GALGAS_bool (false), GALGAS_bool (true)  COMMA_SOURCE_FILE ("goil_program.galgas", 49)) ;
 }
 
 
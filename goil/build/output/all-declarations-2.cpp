@@ -6952,55 +6952,87 @@ GALGAS_objectKindMap GALGAS_objectKindMap::extractObject (const GALGAS_object &
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_start_i0_ (C_Lexique_goil_5F_lexique * inCompiler) {
-  GALGAS_implementation var_imp_955 = GALGAS_implementation::constructor_new (GALGAS_implementationMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 39))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 39)) ;
-  GALGAS_applicationDefinition var_application_1049 = function_emptyApplicationDefinition (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 40)) ;
-  GALGAS_string var_fileIncludeList_1107 = GALGAS_string::makeEmptyString () ;
-  GALGAS_lstring var_version_1178 ;
-  GALGAS_lstring var_desc_1194 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 46)) ;
-  nt_OIL_5F_version_ (var_version_1178, var_desc_1194, inCompiler) ;
+  GALGAS_timer var_runTimer_955 = GALGAS_timer::constructor_start (SOURCE_FILE ("goil_syntax.galgas", 39)) ;
+  GALGAS_phaseTimeList var_phases_994 = GALGAS_phaseTimeList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 40)) ;
+  GALGAS_implementation var_imp_1029 = GALGAS_implementation::constructor_new (GALGAS_implementationMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 41))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 41)) ;
+  GALGAS_applicationDefinition var_application_1123 = function_emptyApplicationDefinition (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 42)) ;
+  GALGAS_string var_fileIncludeList_1181 = GALGAS_string::makeEmptyString () ;
+  GALGAS_lstring var_version_1252 ;
+  GALGAS_lstring var_desc_1268 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 48)) ;
+  nt_OIL_5F_version_ (var_version_1252, var_desc_1268, inCompiler) ;
   {
-  var_application_1049.setter_setVersion (var_version_1178 COMMA_SOURCE_FILE ("goil_syntax.galgas", 48)) ;
+  var_application_1123.setter_setVersion (var_version_1252 COMMA_SOURCE_FILE ("goil_syntax.galgas", 50)) ;
   }
   {
-  var_application_1049.setter_setVersionDescription (var_desc_1194 COMMA_SOURCE_FILE ("goil_syntax.galgas", 49)) ;
-  }
-  GALGAS_string var_config_5F_file_5F_name_1358 = GALGAS_string (gOption_goil_5F_options_config.getter_value ()) ;
-  GALGAS_stringlist var_configFiles_1452 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_1358.add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 54)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 54)) ;
-  cEnumerator_stringlist enumerator_1663 (var_configFiles_1452, kENUMERATION_DOWN) ;
-  while (enumerator_1663.hasCurrentObject ()) {
-    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_1663.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 58)), var_imp_955, var_application_1049, var_fileIncludeList_1107, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 58)) ;
-    enumerator_1663.gotoNextObject () ;
-  }
-  GALGAS_stringlist var_configVersionFiles_1868 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_1358.add_operation (var_version_1178.getter_string (SOURCE_FILE ("goil_syntax.galgas", 62)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 62)).add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 62)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 62)) ;
-  cEnumerator_stringlist enumerator_1981 (var_configVersionFiles_1868, kENUMERATION_DOWN) ;
-  while (enumerator_1981.hasCurrentObject ()) {
-    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_1981.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 65)), var_imp_955, var_application_1049, var_fileIncludeList_1107, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 65)) ;
-    enumerator_1981.gotoNextObject () ;
-  }
-  nt_file_ (var_imp_955, var_application_1049, var_fileIncludeList_1107, GALGAS_bool (true), inCompiler) ;
-  callExtensionMethod_checkObjectReferences ((const cPtr_implementation *) var_imp_955.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 83)) ;
-  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 85)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+  var_application_1123.setter_setVersionDescription (var_desc_1268 COMMA_SOURCE_FILE ("goil_syntax.galgas", 51)) ;
+  }
+  GALGAS_string var_config_5F_file_5F_name_1432 = GALGAS_string (gOption_goil_5F_options_config.getter_value ()) ;
+  GALGAS_stringlist var_configFiles_1526 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_1432.add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 56)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 56)) ;
+  cEnumerator_stringlist enumerator_1737 (var_configFiles_1526, kENUMERATION_DOWN) ;
+  while (enumerator_1737.hasCurrentObject ()) {
+    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_1737.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 60)), var_imp_1029, var_application_1123, var_fileIncludeList_1181, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 60)) ;
+    enumerator_1737.gotoNextObject () ;
+  }
+  GALGAS_stringlist var_configVersionFiles_1942 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_1432.add_operation (var_version_1252.getter_string (SOURCE_FILE ("goil_syntax.galgas", 64)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 64)).add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 64)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 64)) ;
+  cEnumerator_stringlist enumerator_2055 (var_configVersionFiles_1942, kENUMERATION_DOWN) ;
+  while (enumerator_2055.hasCurrentObject ()) {
+    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_2055.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 67)), var_imp_1029, var_application_1123, var_fileIncludeList_1181, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 67)) ;
+    enumerator_2055.gotoNextObject () ;
+  }
+  {
+  routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("config files"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 69)) ;
+  }
+  nt_file_ (var_imp_1029, var_application_1123, var_fileIncludeList_1181, GALGAS_bool (true), inCompiler) ;
+  {
+  routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("application file"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 79)) ;
+  }
+  callExtensionMethod_checkObjectReferences ((const cPtr_implementation *) var_imp_1029.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 87)) ;
+  {
+  routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("object references"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 88)) ;
+  }
+  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 90)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
   if (kBoolTrue == test_0) {
     {
-    routine_setDefaults (var_imp_955, var_application_1049, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 86)) ;
+    routine_setDefaults (var_imp_1029, var_application_1123, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 91)) ;
+    }
+    {
+    routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("default values"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 92)) ;
     }
   }
-  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 93)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 99)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
   if (kBoolTrue == test_1) {
     {
-    routine_verifyAll (var_imp_955, var_application_1049, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 94)) ;
+    routine_verifyAll (var_imp_1029, var_application_1123, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 100)) ;
+    }
+    {
+    routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("verification"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 101)) ;
     }
   }
-  const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 96)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+  const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 103)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
   if (kBoolTrue == test_2) {
-    GALGAS_gtlData var_templateData_2847 = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_1049.ptr (), var_imp_955, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 97)) ;
+    GALGAS_gtlData var_templateData_3171 = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_1123.ptr (), var_imp_1029, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 104)) ;
     {
-    routine_generate_5F_all (var_templateData_2847, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 100)) ;
+    routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("template data"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 105)) ;
+    }
+    {
+    routine_generate_5F_all (var_templateData_3171, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 108)) ;
+    }
+    {
+    routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("code generation"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 109)) ;
+    }
+  }
+  var_fileIncludeList_1181 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 112)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 112)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 112)).add_operation (var_fileIncludeList_1181, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 112)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 112)) ;
+  GALGAS_string var_oilDepFileName_3576 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 113)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 113)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 113)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 114)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 114)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 114)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 114)) ;
+  var_fileIncludeList_1181.method_writeToFile (var_oilDepFileName_3576, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 116)) ;
+  {
+  routine_endPhase (var_phases_994, var_runTimer_955, GALGAS_string ("dependency file"), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 117)) ;
+  }
+  const enumGalgasBool test_3 = GALGAS_bool (gOption_goil_5F_options_stats.getter_value ()).operator_or (GALGAS_bool (kIsNotEqual, GALGAS_string (gOption_goil_5F_options_stats_5F_file.getter_value ()).objectCompare (GALGAS_string::makeEmptyString ())) COMMA_SOURCE_FILE ("goil_syntax.galgas", 119)).boolEnum () ;
+  if (kBoolTrue == test_3) {
+    {
+    routine_reportPhaseTimes (var_phases_994, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 120)) ;
     }
   }
-  var_fileIncludeList_1107 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 103)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)).add_operation (var_fileIncludeList_1107, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)) ;
-  GALGAS_string var_oilDepFileName_3150 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 104)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 104)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 104)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 105)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 105)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 105)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 105)) ;
-  var_fileIncludeList_1107.method_writeToFile (var_oilDepFileName_3150, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 107)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -7018,10 +7050,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_file_i1_ (GALGAS_implementation
                                                            GALGAS_string & ioArgument_fileIncludeList,
                                                            const GALGAS_bool constinArgument_rootFile,
                                                            C_Lexique_goil_5F_lexique * inCompiler) {
-  const enumGalgasBool test_0 = constinArgument_rootFile.operator_not (SOURCE_FILE ("goil_syntax.galgas", 116)).boolEnum () ;
+  const enumGalgasBool test_0 = constinArgument_rootFile.operator_not (SOURCE_FILE ("goil_syntax.galgas", 130)).boolEnum () ;
   if (kBoolTrue == test_0) {
     ioArgument_fileIncludeList.plusAssign_operation(GALGAS_string (" \\\n"
-      " ").add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 117)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 117)), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 117)) ;
+      " ").add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 131)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 131)), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 131)) ;
   }
   bool repeatFlag_1 = true ;
   while (repeatFlag_1) {
@@ -7072,11 +7104,11 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_sign_i2_ (GALGAS_bool & outArgu
   outArgument_signed.drop () ; // Release 'out' argument
   switch (select_goil_5F_syntax_1 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 128)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 142)) ;
     outArgument_signed = GALGAS_bool (true) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 130)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 144)) ;
     outArgument_signed = GALGAS_bool (false) ;
   } break ;
   case 3: {
@@ -7092,10 +7124,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_sign_i2_ (GALGAS_bool & outArgu
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_sign_i2_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_1 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 128)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 142)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 130)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__2B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 144)) ;
   } break ;
   case 3: {
   } break ;
@@ -7112,33 +7144,33 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_description_i3_ (GALGAS_lstring
   outArgument_desc.drop () ; // Release 'out' argument
   switch (select_goil_5F_syntax_2 (inCompiler)) {
   case 1: {
-    outArgument_desc = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 141)) ;
+    outArgument_desc = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 155)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3A_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 143)) ;
-    GALGAS_lstring var_partialString_4132 ;
-    var_partialString_4132 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 145)) ;
-    GALGAS_string var_result_4179 = var_partialString_4132.getter_string (SOURCE_FILE ("goil_syntax.galgas", 146)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3A_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 157)) ;
+    GALGAS_lstring var_partialString_4738 ;
+    var_partialString_4738 = inCompiler->synthetizedAttribute_a_5F_string () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 159)) ;
+    GALGAS_string var_result_4785 = var_partialString_4738.getter_string (SOURCE_FILE ("goil_syntax.galgas", 160)) ;
     bool repeatFlag_0 = true ;
     while (repeatFlag_0) {
       switch (select_goil_5F_syntax_3 (inCompiler)) {
       case 2: {
-        var_partialString_4132 = inCompiler->synthetizedAttribute_a_5F_string () ;
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 149)) ;
-        GALGAS_string var_toappend_4278 = var_partialString_4132.getter_string (SOURCE_FILE ("goil_syntax.galgas", 150)) ;
-        const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_result_4179.getter_rightSubString (GALGAS_uint ((uint32_t) 2U) COMMA_SOURCE_FILE ("goil_syntax.galgas", 151)).objectCompare (GALGAS_string ("\\n"))).boolEnum () ;
+        var_partialString_4738 = inCompiler->synthetizedAttribute_a_5F_string () ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 163)) ;
+        GALGAS_string var_toappend_4884 = var_partialString_4738.getter_string (SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+        const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_result_4785.getter_rightSubString (GALGAS_uint ((uint32_t) 2U) COMMA_SOURCE_FILE ("goil_syntax.galgas", 165)).objectCompare (GALGAS_string ("\\n"))).boolEnum () ;
         if (kBoolTrue == test_1) {
-          var_toappend_4278 = GALGAS_string (" ").add_operation (var_toappend_4278, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 152)) ;
+          var_toappend_4884 = GALGAS_string (" ").add_operation (var_toappend_4884, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 166)) ;
         }
-        var_result_4179.plusAssign_operation(var_toappend_4278, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 154)) ;
+        var_result_4785.plusAssign_operation(var_toappend_4884, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 168)) ;
       } break ;
       default:
         repeatFlag_0 = false ;
         break ;
       }
     }
-    outArgument_desc = GALGAS_lstring::constructor_new (var_result_4179.getter_stringByReplacingStringByString (GALGAS_string ("\\n"), GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 156)), var_partialString_4132.getter_location (SOURCE_FILE ("goil_syntax.galgas", 156))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 156)) ;
+    outArgument_desc = GALGAS_lstring::constructor_new (var_result_4785.getter_stringByReplacingStringByString (GALGAS_string ("\\n"), GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 170)), var_partialString_4738.getter_location (SOURCE_FILE ("goil_syntax.galgas", 170))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 170)) ;
   } break ;
   default:
     break ;
@@ -7152,13 +7184,13 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_description_i3_parse (C_Lexique
   case 1: {
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3A_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 143)) ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 145)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3A_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 157)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 159)) ;
     bool repeatFlag_0 = true ;
     while (repeatFlag_0) {
       switch (select_goil_5F_syntax_3 (inCompiler)) {
       case 2: {
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 149)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 163)) ;
       } break ;
       default:
         repeatFlag_0 = false ;
@@ -7179,22 +7211,22 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_OIL_5F_version_i4_ (GALGAS_lstr
                                                                      C_Lexique_goil_5F_lexique * inCompiler) {
   outArgument_version.drop () ; // Release 'out' argument
   outArgument_desc.drop () ; // Release 'out' argument
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
   outArgument_version = inCompiler->synthetizedAttribute_a_5F_string () ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
   nt_description_ (outArgument_desc, inCompiler) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_OIL_5F_version_i4_parse (C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
   nt_description_parse (inCompiler) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 178)) ;
   inCompiler->resetTemplateString () ;
 }
 
@@ -7205,35 +7237,35 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_application_5F_definition_i5_ (
                                                                                 GALGAS_string & ioArgument_fileIncludeList,
                                                                                 const GALGAS_bool constinArgument_rootFile,
                                                                                 C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_CPU) COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  GALGAS_lstring var_cpuName_5078 = inCompiler->synthetizedAttribute_att_5F_token () ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  GALGAS_objectsMap var_objects_5104 = ioArgument_application.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 177)) ;
-  nt_object_5F_definition_5F_list_ (constinArgument_imp, var_objects_5104, ioArgument_fileIncludeList, constinArgument_rootFile, inCompiler) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
-  GALGAS_lstring joker_5220 ; // Joker input parameter
-  nt_description_ (joker_5220, inCompiler) ;
-  joker_5220.drop () ; // Release temporary input variables (joker in source)
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_CPU) COMMA_SOURCE_FILE ("goil_syntax.galgas", 190)) ;
+  GALGAS_lstring var_cpuName_5684 = inCompiler->synthetizedAttribute_att_5F_token () ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 190)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 190)) ;
+  GALGAS_objectsMap var_objects_5710 = ioArgument_application.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 191)) ;
+  nt_object_5F_definition_5F_list_ (constinArgument_imp, var_objects_5710, ioArgument_fileIncludeList, constinArgument_rootFile, inCompiler) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 193)) ;
+  GALGAS_lstring joker_5826 ; // Joker input parameter
+  nt_description_ (joker_5826, inCompiler) ;
+  joker_5826.drop () ; // Release temporary input variables (joker in source)
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 193)) ;
   {
-  ioArgument_application.setter_setName (var_cpuName_5078 COMMA_SOURCE_FILE ("goil_syntax.galgas", 180)) ;
+  ioArgument_application.setter_setName (var_cpuName_5684 COMMA_SOURCE_FILE ("goil_syntax.galgas", 194)) ;
   }
   {
-  ioArgument_application.setter_setObjects (var_objects_5104 COMMA_SOURCE_FILE ("goil_syntax.galgas", 181)) ;
+  ioArgument_application.setter_setObjects (var_objects_5710 COMMA_SOURCE_FILE ("goil_syntax.galgas", 195)) ;
   }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_application_5F_definition_i5_parse (C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_CPU) COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_CPU) COMMA_SOURCE_FILE ("goil_syntax.galgas", 190)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 190)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 190)) ;
   nt_object_5F_definition_5F_list_parse (inCompiler) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 193)) ;
   nt_description_parse (inCompiler) ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 193)) ;
   inCompiler->resetTemplateString () ;
 }
 
@@ -7248,54 +7280,54 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_object_5F_definition_5F_list_i6
   while (repeatFlag_0) {
     switch (select_goil_5F_syntax_4 (inCompiler)) {
     case 2: {
-      GALGAS_lstring var_objectKind_5486 = inCompiler->synthetizedAttribute_att_5F_token () ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 192)) ;
-      GALGAS_implementationObject var_impObjOfKind_5525 = callExtensionGetter_impObject ((const cPtr_implementation *) constinArgument_imp.ptr (), var_objectKind_5486.getter_string (SOURCE_FILE ("goil_syntax.galgas", 193)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 193)) ;
-      GALGAS_objectKind var_objectsForKind_5598 = GALGAS_objectKind::constructor_new (GALGAS_objectKindMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 194))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 194)) ;
-      const enumGalgasBool test_1 = ioArgument_objects.getter_hasKey (var_objectKind_5486.getter_string (SOURCE_FILE ("goil_syntax.galgas", 195)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 195)).boolEnum () ;
+      GALGAS_lstring var_objectKind_6092 = inCompiler->synthetizedAttribute_att_5F_token () ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 206)) ;
+      GALGAS_implementationObject var_impObjOfKind_6131 = callExtensionGetter_impObject ((const cPtr_implementation *) constinArgument_imp.ptr (), var_objectKind_6092.getter_string (SOURCE_FILE ("goil_syntax.galgas", 207)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 207)) ;
+      GALGAS_objectKind var_objectsForKind_6204 = GALGAS_objectKind::constructor_new (GALGAS_objectKindMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 208))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 208)) ;
+      const enumGalgasBool test_1 = ioArgument_objects.getter_hasKey (var_objectKind_6092.getter_string (SOURCE_FILE ("goil_syntax.galgas", 209)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 209)).boolEnum () ;
       if (kBoolTrue == test_1) {
         {
-        ioArgument_objects.setter_del (var_objectKind_5486, var_objectsForKind_5598, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 196)) ;
+        ioArgument_objects.setter_del (var_objectKind_6092, var_objectsForKind_6204, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 210)) ;
         }
       }
-      GALGAS_lstring var_objectName_5789 = inCompiler->synthetizedAttribute_att_5F_token () ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 198)) ;
-      GALGAS_objectAttributes var_object_5818 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 199)) ;
-      GALGAS_objectKindMap var_objectsKind_5865 = var_objectsForKind_5598.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 200)) ;
-      const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, var_impObjOfKind_5525.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 201)).getter_bool (SOURCE_FILE ("goil_syntax.galgas", 201)).objectCompare (GALGAS_bool (false))).boolEnum () ;
+      GALGAS_lstring var_objectName_6395 = inCompiler->synthetizedAttribute_att_5F_token () ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 212)) ;
+      GALGAS_objectAttributes var_object_6424 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 213)) ;
+      GALGAS_objectKindMap var_objectsKind_6471 = var_objectsForKind_6204.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 214)) ;
+      const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, var_impObjOfKind_6131.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 215)).getter_bool (SOURCE_FILE ("goil_syntax.galgas", 215)).objectCompare (GALGAS_bool (false))).boolEnum () ;
       if (kBoolTrue == test_2) {
-        var_objectName_5789 = var_objectKind_5486 ;
+        var_objectName_6395 = var_objectKind_6092 ;
       }
-      const enumGalgasBool test_3 = var_objectsKind_5865.getter_hasKey (var_objectName_5789.getter_string (SOURCE_FILE ("goil_syntax.galgas", 207)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 207)).boolEnum () ;
+      const enumGalgasBool test_3 = var_objectsKind_6471.getter_hasKey (var_objectName_6395.getter_string (SOURCE_FILE ("goil_syntax.galgas", 221)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 221)).boolEnum () ;
       if (kBoolTrue == test_3) {
         {
-        var_objectsKind_5865.setter_del (var_objectName_5789, var_object_5818, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 208)) ;
+        var_objectsKind_6471.setter_del (var_objectName_6395, var_object_6424, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 222)) ;
         }
       }
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 210)) ;
-      nt_oil_5F_declaration_5F_list_ (var_impObjOfKind_5525.getter_attributes (SOURCE_FILE ("goil_syntax.galgas", 211)), var_object_5818, inCompiler) ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 212)) ;
-      GALGAS_lstring var_oil_5F_desc_6424 ;
-      nt_description_ (var_oil_5F_desc_6424, inCompiler) ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 214)) ;
-      GALGAS_identifierMap var_attributes_6462 = var_object_5818.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 215)) ;
-      const enumGalgasBool test_4 = var_attributes_6462.getter_hasKey (GALGAS_string ("NAME") COMMA_SOURCE_FILE ("goil_syntax.galgas", 216)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 216)).boolEnum () ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 224)) ;
+      nt_oil_5F_declaration_5F_list_ (var_impObjOfKind_6131.getter_attributes (SOURCE_FILE ("goil_syntax.galgas", 225)), var_object_6424, inCompiler) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 226)) ;
+      GALGAS_lstring var_oil_5F_desc_7030 ;
+      nt_description_ (var_oil_5F_desc_7030, inCompiler) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 228)) ;
+      GALGAS_identifierMap var_attributes_7068 = var_object_6424.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 229)) ;
+      const enumGalgasBool test_4 = var_attributes_7068.getter_hasKey (GALGAS_string ("NAME") COMMA_SOURCE_FILE ("goil_syntax.galgas", 230)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 230)).boolEnum () ;
       if (kBoolTrue == test_4) {
         {
-        var_attributes_6462.setter_put (GALGAS_lstring::constructor_new (GALGAS_string ("NAME"), var_objectName_5789.getter_location (SOURCE_FILE ("goil_syntax.galgas", 218))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 217)), GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_6424, var_objectName_5789.getter_location (SOURCE_FILE ("goil_syntax.galgas", 220)), var_objectName_5789.getter_string (SOURCE_FILE ("goil_syntax.galgas", 221))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 219)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 217)) ;
+        var_attributes_7068.setter_put (GALGAS_lstring::constructor_new (GALGAS_string ("NAME"), var_objectName_6395.getter_location (SOURCE_FILE ("goil_syntax.galgas", 232))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 231)), GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_7030, var_objectName_6395.getter_location (SOURCE_FILE ("goil_syntax.galgas", 234)), var_objectName_6395.getter_string (SOURCE_FILE ("goil_syntax.galgas", 235))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 233)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 231)) ;
         }
         {
-        var_object_5818.setter_setObjectParams (var_attributes_6462 COMMA_SOURCE_FILE ("goil_syntax.galgas", 222)) ;
+        var_object_6424.setter_setObjectParams (var_attributes_7068 COMMA_SOURCE_FILE ("goil_syntax.galgas", 236)) ;
         }
       }
       {
-      var_objectsKind_5865.setter_put (var_objectName_5789, var_object_5818, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 224)) ;
+      var_objectsKind_6471.setter_put (var_objectName_6395, var_object_6424, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 238)) ;
       }
       {
-      var_objectsForKind_5598.setter_setObjects (var_objectsKind_5865 COMMA_SOURCE_FILE ("goil_syntax.galgas", 225)) ;
+      var_objectsForKind_6204.setter_setObjects (var_objectsKind_6471 COMMA_SOURCE_FILE ("goil_syntax.galgas", 239)) ;
       }
       {
-      ioArgument_objects.setter_put (var_objectKind_5486, var_objectsForKind_5598, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 226)) ;
+      ioArgument_objects.setter_put (var_objectKind_6092, var_objectsForKind_6204, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 240)) ;
       }
     } break ;
     case 3: {
@@ -7315,13 +7347,13 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_object_5F_definition_5F_list_i6
   while (repeatFlag_0) {
     switch (select_goil_5F_syntax_4 (inCompiler)) {
     case 2: {
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 192)) ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 198)) ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 210)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 206)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 212)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 224)) ;
       nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 212)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 226)) ;
       nt_description_parse (inCompiler) ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 214)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 228)) ;
     } break ;
     case 3: {
       nt_include_5F_cpu_5F_level_parse (inCompiler) ;
@@ -7341,12 +7373,12 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_boolean_i7_ (GALGAS_lbool & out
   outArgument_val.drop () ; // Release 'out' argument
   switch (select_goil_5F_syntax_5 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_TRUE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 236)) ;
-    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (true), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 237))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 237)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_TRUE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 250)) ;
+    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (true), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 251))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 251)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_FALSE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 239)) ;
-    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (false), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 240))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 240)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_FALSE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 253)) ;
+    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (false), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 254))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 254)) ;
   } break ;
   default:
     break ;
@@ -7358,10 +7390,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_boolean_i7_ (GALGAS_lbool & out
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_boolean_i7_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_5 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_TRUE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 236)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_TRUE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 250)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_FALSE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 239)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_FALSE) COMMA_SOURCE_FILE ("goil_syntax.galgas", 253)) ;
   } break ;
   default:
     break ;
@@ -7415,46 +7447,46 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_5F_list_i8_p
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const GALGAS_implementationObjectMap constinArgument_types,
                                                                          GALGAS_objectAttributes & ioArgument_identifiers,
                                                                          C_Lexique_goil_5F_lexique * inCompiler) {
-  GALGAS_lstring var_idf_7783 ;
-  GALGAS_object_5F_t var_val_7799 ;
-  var_idf_7783 = inCompiler->synthetizedAttribute_att_5F_token () ;
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 261)) ;
-  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 265)) ;
-  temp_0.addAssign_operation (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 265))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 265)) ;
-  GALGAS_impType var_type_7871 = GALGAS_impVoid::constructor_new (temp_0, GALGAS_dataType::constructor_void (SOURCE_FILE ("goil_syntax.galgas", 265)), function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 265)), GALGAS_bool (false), GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 265))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 265)) ;
-  GALGAS_bool var_typeOk_7970 = GALGAS_bool (false) ;
-  const enumGalgasBool test_1 = constinArgument_types.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 267)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 267)).boolEnum () ;
+  GALGAS_lstring var_idf_8389 ;
+  GALGAS_object_5F_t var_val_8405 ;
+  var_idf_8389 = inCompiler->synthetizedAttribute_att_5F_token () ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 275)) ;
+  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 279)) ;
+  temp_0.addAssign_operation (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 279))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 279)) ;
+  GALGAS_impType var_type_8477 = GALGAS_impVoid::constructor_new (temp_0, GALGAS_dataType::constructor_void (SOURCE_FILE ("goil_syntax.galgas", 279)), function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 279)), GALGAS_bool (false), GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 279))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 279)) ;
+  GALGAS_bool var_typeOk_8576 = GALGAS_bool (false) ;
+  const enumGalgasBool test_1 = constinArgument_types.getter_hasKey (var_idf_8389.getter_string (SOURCE_FILE ("goil_syntax.galgas", 281)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 281)).boolEnum () ;
   if (kBoolTrue == test_1) {
-    constinArgument_types.method_get (var_idf_7783, var_type_7871, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 268)) ;
-    var_typeOk_7970 = GALGAS_bool (true) ;
+    constinArgument_types.method_get (var_idf_8389, var_type_8477, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 282)) ;
+    var_typeOk_8576 = GALGAS_bool (true) ;
   }else if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 271)), var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 271)).add_operation (GALGAS_string (" is not declared in the IMPLEMENTATION"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 271)), fixItArray2  COMMA_SOURCE_FILE ("goil_syntax.galgas", 271)) ;
+    inCompiler->emitSemanticError (var_idf_8389.getter_location (SOURCE_FILE ("goil_syntax.galgas", 285)), var_idf_8389.getter_string (SOURCE_FILE ("goil_syntax.galgas", 285)).add_operation (GALGAS_string (" is not declared in the IMPLEMENTATION"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 285)), fixItArray2  COMMA_SOURCE_FILE ("goil_syntax.galgas", 285)) ;
   }
   switch (select_goil_5F_syntax_7 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 274)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)) ;
     switch (select_goil_5F_syntax_8 (inCompiler)) {
     case 1: {
-      GALGAS_lstring var_value_8254 ;
-      var_value_8254 = inCompiler->synthetizedAttribute_att_5F_token () ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 278)) ;
-      GALGAS_implementationObjectMap var_subTypes_8292 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 279)) ;
-      GALGAS_objectAttributes var_subAttributes_8369 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 280)) ;
-      switch (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 281)).enumValue ()) {
+      GALGAS_lstring var_value_8860 ;
+      var_value_8860 = inCompiler->synthetizedAttribute_att_5F_token () ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 292)) ;
+      GALGAS_implementationObjectMap var_subTypes_8898 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 293)) ;
+      GALGAS_objectAttributes var_subAttributes_8975 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 294)) ;
+      switch (var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 295)).enumValue ()) {
       case GALGAS_dataType::kNotBuilt:
         break ;
       case GALGAS_dataType::kEnum_enumeration:
         {
-          if (var_type_7871.isValid ()) {
-            if (var_type_7871.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impEnumType) {
-              GALGAS_impEnumType cast_8494_enumType ((cPtr_impEnumType *) var_type_7871.ptr ()) ;
-              const enumGalgasBool test_3 = cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 285)).getter_hasKey (var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 285)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 285)).boolEnum () ;
+          if (var_type_8477.isValid ()) {
+            if (var_type_8477.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impEnumType) {
+              GALGAS_impEnumType cast_9100_enumType ((cPtr_impEnumType *) var_type_8477.ptr ()) ;
+              const enumGalgasBool test_3 = cast_9100_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 299)).getter_hasKey (var_value_8860.getter_string (SOURCE_FILE ("goil_syntax.galgas", 299)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 299)).boolEnum () ;
               if (kBoolTrue == test_3) {
-                cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 286)).method_get (var_value_8254, var_subTypes_8292, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 286)) ;
+                cast_9100_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 300)).method_get (var_value_8860, var_subTypes_8898, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 300)) ;
               }else if (kBoolFalse == test_3) {
                 TC_Array <C_FixItDescription> fixItArray4 ;
-                inCompiler->emitSemanticError (var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 288)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 288)).add_operation (GALGAS_string (" ENUM value undeclared. One of the following values are expected: "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)).add_operation (function_valueList (cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 288)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)), fixItArray4  COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)) ;
+                inCompiler->emitSemanticError (var_value_8860.getter_location (SOURCE_FILE ("goil_syntax.galgas", 302)), var_value_8860.getter_string (SOURCE_FILE ("goil_syntax.galgas", 302)).add_operation (GALGAS_string (" ENUM value undeclared. One of the following values are expected: "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 302)).add_operation (function_valueList (cast_9100_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 302)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 302)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 302)), fixItArray4  COMMA_SOURCE_FILE ("goil_syntax.galgas", 302)) ;
               }
             }
           }
@@ -7479,120 +7511,120 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
       case GALGAS_dataType::kEnum_boolean:
         {
           TC_Array <C_FixItDescription> fixItArray5 ;
-          inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 294)), var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 294)).add_operation (GALGAS_string (" is not an ENUM nor and IDENTIFIER nor an object reference"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 294)), fixItArray5  COMMA_SOURCE_FILE ("goil_syntax.galgas", 294)) ;
+          inCompiler->emitSemanticError (var_idf_8389.getter_location (SOURCE_FILE ("goil_syntax.galgas", 308)), var_idf_8389.getter_string (SOURCE_FILE ("goil_syntax.galgas", 308)).add_operation (GALGAS_string (" is not an ENUM nor and IDENTIFIER nor an object reference"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 308)), fixItArray5  COMMA_SOURCE_FILE ("goil_syntax.galgas", 308)) ;
         }
         break ;
       }
       switch (select_goil_5F_syntax_9 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 297)) ;
-        nt_oil_5F_declaration_5F_list_ (var_subTypes_8292, var_subAttributes_8369, inCompiler) ;
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 299)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 311)) ;
+        nt_oil_5F_declaration_5F_list_ (var_subTypes_8898, var_subAttributes_8975, inCompiler) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 313)) ;
       } break ;
       case 2: {
       } break ;
       default:
         break ;
       }
-      GALGAS_lstring var_oil_5F_desc_9218 ;
-      nt_description_ (var_oil_5F_desc_9218, inCompiler) ;
-      const enumGalgasBool test_6 = GALGAS_bool (kIsEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 302)).objectCompare (GALGAS_dataType::constructor_enumeration (SOURCE_FILE ("goil_syntax.galgas", 302)))).boolEnum () ;
+      GALGAS_lstring var_oil_5F_desc_9824 ;
+      nt_description_ (var_oil_5F_desc_9824, inCompiler) ;
+      const enumGalgasBool test_6 = GALGAS_bool (kIsEqual, var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 316)).objectCompare (GALGAS_dataType::constructor_enumeration (SOURCE_FILE ("goil_syntax.galgas", 316)))).boolEnum () ;
       if (kBoolTrue == test_6) {
-        var_val_7799 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 303)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 303)), var_subAttributes_8369  COMMA_SOURCE_FILE ("goil_syntax.galgas", 303)) ;
+        var_val_8405 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_9824, var_value_8860.getter_location (SOURCE_FILE ("goil_syntax.galgas", 317)), var_value_8860.getter_string (SOURCE_FILE ("goil_syntax.galgas", 317)), var_subAttributes_8975  COMMA_SOURCE_FILE ("goil_syntax.galgas", 317)) ;
       }else if (kBoolFalse == test_6) {
-        const enumGalgasBool test_7 = GALGAS_bool (kIsEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 304)).objectCompare (GALGAS_dataType::constructor_objectType (SOURCE_FILE ("goil_syntax.galgas", 304)))).boolEnum () ;
+        const enumGalgasBool test_7 = GALGAS_bool (kIsEqual, var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 318)).objectCompare (GALGAS_dataType::constructor_objectType (SOURCE_FILE ("goil_syntax.galgas", 318)))).boolEnum () ;
         if (kBoolTrue == test_7) {
-          var_val_7799 = GALGAS_objectRefAttribute::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 305)), var_value_8254  COMMA_SOURCE_FILE ("goil_syntax.galgas", 305)) ;
+          var_val_8405 = GALGAS_objectRefAttribute::constructor_new (var_oil_5F_desc_9824, var_value_8860.getter_location (SOURCE_FILE ("goil_syntax.galgas", 319)), var_value_8860  COMMA_SOURCE_FILE ("goil_syntax.galgas", 319)) ;
         }else if (kBoolFalse == test_7) {
-          var_val_7799 = GALGAS_string_5F_class::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 307)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 307))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 307)) ;
+          var_val_8405 = GALGAS_string_5F_class::constructor_new (var_oil_5F_desc_9824, var_value_8860.getter_location (SOURCE_FILE ("goil_syntax.galgas", 321)), var_value_8860.getter_string (SOURCE_FILE ("goil_syntax.galgas", 321))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 321)) ;
         }
       }
     } break ;
     case 2: {
-      GALGAS_bool var_sign_9646 ;
-      nt_sign_ (var_sign_9646, inCompiler) ;
+      GALGAS_bool var_sign_10252 ;
+      nt_sign_ (var_sign_10252, inCompiler) ;
       switch (select_goil_5F_syntax_10 (inCompiler)) {
       case 1: {
-        GALGAS_luint_36__34_ var_value_9724 ;
-        var_value_9724 = inCompiler->synthetizedAttribute_integerNumber () ;
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_uint_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 316)) ;
-        GALGAS_lstring var_oil_5F_desc_9798 ;
-        nt_description_ (var_oil_5F_desc_9798, inCompiler) ;
-        var_val_7799 = function_checkAndGetIntegerNumber (var_oil_5F_desc_9798, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 318)), var_value_9724, var_sign_9646, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 318)) ;
+        GALGAS_luint_36__34_ var_value_10330 ;
+        var_value_10330 = inCompiler->synthetizedAttribute_integerNumber () ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_uint_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 330)) ;
+        GALGAS_lstring var_oil_5F_desc_10404 ;
+        nt_description_ (var_oil_5F_desc_10404, inCompiler) ;
+        var_val_8405 = function_checkAndGetIntegerNumber (var_oil_5F_desc_10404, var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 332)), var_value_10330, var_sign_10252, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 332)) ;
       } break ;
       case 2: {
-        GALGAS_ldouble var_value_9930 ;
-        var_value_9930 = inCompiler->synthetizedAttribute_floatNumber () ;
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_float_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 322)) ;
-        GALGAS_lstring var_oil_5F_desc_10005 ;
-        nt_description_ (var_oil_5F_desc_10005, inCompiler) ;
-        var_val_7799 = function_checkAndGetFloatNumber (var_oil_5F_desc_10005, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 324)), var_value_9930, var_sign_9646, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 324)) ;
+        GALGAS_ldouble var_value_10536 ;
+        var_value_10536 = inCompiler->synthetizedAttribute_floatNumber () ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_float_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 336)) ;
+        GALGAS_lstring var_oil_5F_desc_10611 ;
+        nt_description_ (var_oil_5F_desc_10611, inCompiler) ;
+        var_val_8405 = function_checkAndGetFloatNumber (var_oil_5F_desc_10611, var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 338)), var_value_10536, var_sign_10252, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 338)) ;
       } break ;
       default:
         break ;
       }
     } break ;
     case 3: {
-      GALGAS_lbool var_value_10136 ;
-      nt_boolean_ (var_value_10136, inCompiler) ;
-      GALGAS_implementationObjectMap var_subTypes_10178 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 330)) ;
-      GALGAS_objectAttributes var_subAttributes_10253 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 331)) ;
-      const enumGalgasBool test_8 = GALGAS_bool (kIsNotEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 332)).objectCompare (GALGAS_dataType::constructor_boolean (SOURCE_FILE ("goil_syntax.galgas", 332)))).boolEnum () ;
+      GALGAS_lbool var_value_10742 ;
+      nt_boolean_ (var_value_10742, inCompiler) ;
+      GALGAS_implementationObjectMap var_subTypes_10784 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 344)) ;
+      GALGAS_objectAttributes var_subAttributes_10859 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 345)) ;
+      const enumGalgasBool test_8 = GALGAS_bool (kIsNotEqual, var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 346)).objectCompare (GALGAS_dataType::constructor_boolean (SOURCE_FILE ("goil_syntax.galgas", 346)))).boolEnum () ;
       if (kBoolTrue == test_8) {
         TC_Array <C_FixItDescription> fixItArray9 ;
-        inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 333)), extensionGetter_oilType (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 333)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 333)).add_operation (GALGAS_string (" expected, got a BOOLEAN"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 333)), fixItArray9  COMMA_SOURCE_FILE ("goil_syntax.galgas", 333)) ;
+        inCompiler->emitSemanticError (var_idf_8389.getter_location (SOURCE_FILE ("goil_syntax.galgas", 347)), extensionGetter_oilType (var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 347)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)).add_operation (GALGAS_string (" expected, got a BOOLEAN"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)), fixItArray9  COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)) ;
       }else if (kBoolFalse == test_8) {
-        if (var_type_7871.isValid ()) {
-          if (var_type_7871.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impBoolType) {
-            GALGAS_impBoolType cast_10456_boolType ((cPtr_impBoolType *) var_type_7871.ptr ()) ;
-            const enumGalgasBool test_10 = var_value_10136.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 337)).boolEnum () ;
+        if (var_type_8477.isValid ()) {
+          if (var_type_8477.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impBoolType) {
+            GALGAS_impBoolType cast_11062_boolType ((cPtr_impBoolType *) var_type_8477.ptr ()) ;
+            const enumGalgasBool test_10 = var_value_10742.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 351)).boolEnum () ;
             if (kBoolTrue == test_10) {
-              var_subTypes_10178 = cast_10456_boolType.getter_trueSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 338)) ;
+              var_subTypes_10784 = cast_11062_boolType.getter_trueSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 352)) ;
             }else if (kBoolFalse == test_10) {
-              var_subTypes_10178 = cast_10456_boolType.getter_falseSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 340)) ;
+              var_subTypes_10784 = cast_11062_boolType.getter_falseSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 354)) ;
             }
           }
         }
       }
       switch (select_goil_5F_syntax_11 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 345)) ;
-        const enumGalgasBool test_11 = GALGAS_bool (kIsEqual, var_subTypes_10178.getter_count (SOURCE_FILE ("goil_syntax.galgas", 346)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)) ;
+        const enumGalgasBool test_11 = GALGAS_bool (kIsEqual, var_subTypes_10784.getter_count (SOURCE_FILE ("goil_syntax.galgas", 360)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
         if (kBoolTrue == test_11) {
           TC_Array <C_FixItDescription> fixItArray12 ;
-          inCompiler->emitSemanticError (var_value_10136.getter_location (SOURCE_FILE ("goil_syntax.galgas", 347)), function_stringLBool (var_value_10136, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)).add_operation (GALGAS_string (" value of "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)).add_operation (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 347)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)).add_operation (GALGAS_string (" has no sub-attribute"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)), fixItArray12  COMMA_SOURCE_FILE ("goil_syntax.galgas", 347)) ;
+          inCompiler->emitSemanticError (var_value_10742.getter_location (SOURCE_FILE ("goil_syntax.galgas", 361)), function_stringLBool (var_value_10742, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 361)).add_operation (GALGAS_string (" value of "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 361)).add_operation (var_idf_8389.getter_string (SOURCE_FILE ("goil_syntax.galgas", 361)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 361)).add_operation (GALGAS_string (" has no sub-attribute"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 361)), fixItArray12  COMMA_SOURCE_FILE ("goil_syntax.galgas", 361)) ;
         }
-        nt_oil_5F_declaration_5F_list_ (var_subTypes_10178, var_subAttributes_10253, inCompiler) ;
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 350)) ;
+        nt_oil_5F_declaration_5F_list_ (var_subTypes_10784, var_subAttributes_10859, inCompiler) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 364)) ;
       } break ;
       case 2: {
       } break ;
       default:
         break ;
       }
-      GALGAS_lstring var_oil_5F_desc_10954 ;
-      nt_description_ (var_oil_5F_desc_10954, inCompiler) ;
-      var_val_7799 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_10954, var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 353)), var_value_10136.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 353)), var_subAttributes_10253  COMMA_SOURCE_FILE ("goil_syntax.galgas", 353)) ;
+      GALGAS_lstring var_oil_5F_desc_11560 ;
+      nt_description_ (var_oil_5F_desc_11560, inCompiler) ;
+      var_val_8405 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_11560, var_idf_8389.getter_location (SOURCE_FILE ("goil_syntax.galgas", 367)), var_value_10742.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 367)), var_subAttributes_10859  COMMA_SOURCE_FILE ("goil_syntax.galgas", 367)) ;
     } break ;
     case 4: {
-      GALGAS_lstring var_literalString_11103 ;
-      var_literalString_11103 = inCompiler->synthetizedAttribute_a_5F_string () ;
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 357)) ;
-      GALGAS_lstring var_oil_5F_desc_11176 ;
-      nt_description_ (var_oil_5F_desc_11176, inCompiler) ;
-      var_val_7799 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_11176, var_literalString_11103.getter_location (SOURCE_FILE ("goil_syntax.galgas", 359)), var_literalString_11103.getter_string (SOURCE_FILE ("goil_syntax.galgas", 359))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)) ;
+      GALGAS_lstring var_literalString_11709 ;
+      var_literalString_11709 = inCompiler->synthetizedAttribute_a_5F_string () ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 371)) ;
+      GALGAS_lstring var_oil_5F_desc_11782 ;
+      nt_description_ (var_oil_5F_desc_11782, inCompiler) ;
+      var_val_8405 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_11782, var_literalString_11709.getter_location (SOURCE_FILE ("goil_syntax.galgas", 373)), var_literalString_11709.getter_string (SOURCE_FILE ("goil_syntax.galgas", 373))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 373)) ;
     } break ;
     case 5: {
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_AUTO) COMMA_SOURCE_FILE ("goil_syntax.galgas", 362)) ;
-      GALGAS_lstring var_oil_5F_desc_11349 ;
-      nt_description_ (var_oil_5F_desc_11349, inCompiler) ;
-      const enumGalgasBool test_13 = callExtensionGetter_autoAllowed ((const cPtr_impType *) var_type_7871.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 365)).boolEnum () ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_AUTO) COMMA_SOURCE_FILE ("goil_syntax.galgas", 376)) ;
+      GALGAS_lstring var_oil_5F_desc_11955 ;
+      nt_description_ (var_oil_5F_desc_11955, inCompiler) ;
+      const enumGalgasBool test_13 = callExtensionGetter_autoAllowed ((const cPtr_impType *) var_type_8477.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 379)).boolEnum () ;
       if (kBoolTrue == test_13) {
-        var_val_7799 = GALGAS_auto::constructor_new (var_oil_5F_desc_11349, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 366))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 366)) ;
+        var_val_8405 = GALGAS_auto::constructor_new (var_oil_5F_desc_11955, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 380))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 380)) ;
       }else if (kBoolFalse == test_13) {
         TC_Array <C_FixItDescription> fixItArray14 ;
-        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 381)), GALGAS_string ("AUTO is not allowed"), fixItArray14  COMMA_SOURCE_FILE ("goil_syntax.galgas", 381)) ;
-        var_val_7799.drop () ; // Release error dropped variable
+        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 395)), GALGAS_string ("AUTO is not allowed"), fixItArray14  COMMA_SOURCE_FILE ("goil_syntax.galgas", 395)) ;
+        var_val_8405.drop () ; // Release error dropped variable
       }
     } break ;
     default:
@@ -7600,102 +7632,102 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
     }
   } break ;
   case 2: {
-    GALGAS_lstring var_name_12180 = inCompiler->synthetizedAttribute_att_5F_token () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 385)) ;
-    GALGAS_implementationObjectMap var_subTypes_12197 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 386)) ;
-    GALGAS_objectAttributes var_subAttributes_12270 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 387)) ;
-    const enumGalgasBool test_15 = GALGAS_bool (kIsNotEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 389)).objectCompare (GALGAS_dataType::constructor_structType (SOURCE_FILE ("goil_syntax.galgas", 389)))).boolEnum () ;
+    GALGAS_lstring var_name_12786 = inCompiler->synthetizedAttribute_att_5F_token () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)) ;
+    GALGAS_implementationObjectMap var_subTypes_12803 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 400)) ;
+    GALGAS_objectAttributes var_subAttributes_12876 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 401)) ;
+    const enumGalgasBool test_15 = GALGAS_bool (kIsNotEqual, var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 403)).objectCompare (GALGAS_dataType::constructor_structType (SOURCE_FILE ("goil_syntax.galgas", 403)))).boolEnum () ;
     if (kBoolTrue == test_15) {
       TC_Array <C_FixItDescription> fixItArray16 ;
-      inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 390)), extensionGetter_oilType (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 390)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 390)).add_operation (GALGAS_string (" expected, got a STRUCT"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 390)), fixItArray16  COMMA_SOURCE_FILE ("goil_syntax.galgas", 390)) ;
+      inCompiler->emitSemanticError (var_idf_8389.getter_location (SOURCE_FILE ("goil_syntax.galgas", 404)), extensionGetter_oilType (var_type_8477.getter_type (SOURCE_FILE ("goil_syntax.galgas", 404)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 404)).add_operation (GALGAS_string (" expected, got a STRUCT"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 404)), fixItArray16  COMMA_SOURCE_FILE ("goil_syntax.galgas", 404)) ;
     }else if (kBoolFalse == test_15) {
-      if (var_type_7871.isValid ()) {
-        if (var_type_7871.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impStructType) {
-          GALGAS_impStructType cast_12482_structType ((cPtr_impStructType *) var_type_7871.ptr ()) ;
-          var_subTypes_12197 = cast_12482_structType.getter_structAttributes (SOURCE_FILE ("goil_syntax.galgas", 394)) ;
+      if (var_type_8477.isValid ()) {
+        if (var_type_8477.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impStructType) {
+          GALGAS_impStructType cast_13088_structType ((cPtr_impStructType *) var_type_8477.ptr ()) ;
+          var_subTypes_12803 = cast_13088_structType.getter_structAttributes (SOURCE_FILE ("goil_syntax.galgas", 408)) ;
         }
       }
     }
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 397)) ;
-    nt_oil_5F_declaration_5F_list_ (var_subTypes_12197, var_subAttributes_12270, inCompiler) ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)) ;
-    GALGAS_lstring var_oil_5F_desc_12674 ;
-    nt_description_ (var_oil_5F_desc_12674, inCompiler) ;
-    var_val_7799 = GALGAS_structAttribute::constructor_new (var_oil_5F_desc_12674, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 401)), var_name_12180, var_subAttributes_12270  COMMA_SOURCE_FILE ("goil_syntax.galgas", 401)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 411)) ;
+    nt_oil_5F_declaration_5F_list_ (var_subTypes_12803, var_subAttributes_12876, inCompiler) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)) ;
+    GALGAS_lstring var_oil_5F_desc_13280 ;
+    nt_description_ (var_oil_5F_desc_13280, inCompiler) ;
+    var_val_8405 = GALGAS_structAttribute::constructor_new (var_oil_5F_desc_13280, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 415)), var_name_12786, var_subAttributes_12876  COMMA_SOURCE_FILE ("goil_syntax.galgas", 415)) ;
   } break ;
   default:
     break ;
   }
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 403)) ;
-  GALGAS_identifierMap var_idfs_12818 = ioArgument_identifiers.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 406)) ;
-  const enumGalgasBool test_17 = var_type_7871.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 407)).boolEnum () ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 417)) ;
+  GALGAS_identifierMap var_idfs_13424 = ioArgument_identifiers.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 420)) ;
+  const enumGalgasBool test_17 = var_type_8477.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 421)).boolEnum () ;
   if (kBoolTrue == test_17) {
-    const enumGalgasBool test_18 = var_idfs_12818.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 408)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 408)).boolEnum () ;
+    const enumGalgasBool test_18 = var_idfs_13424.getter_hasKey (var_idf_8389.getter_string (SOURCE_FILE ("goil_syntax.galgas", 422)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 422)).boolEnum () ;
     if (kBoolTrue == test_18) {
-      GALGAS_object_5F_t var_attributeList_12942 ;
+      GALGAS_object_5F_t var_attributeList_13548 ;
       {
-      var_idfs_12818.setter_del (var_idf_7783, var_attributeList_12942, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 412)) ;
+      var_idfs_13424.setter_del (var_idf_8389, var_attributeList_13548, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 426)) ;
       }
-      if (var_attributeList_12942.isValid ()) {
-        if (var_attributeList_12942.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
-          GALGAS_multipleAttribute cast_13136_multiAttribute ((cPtr_multipleAttribute *) var_attributeList_12942.ptr ()) ;
-          GALGAS_identifierList var_aList_13168 = cast_13136_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 415)) ;
-          var_aList_13168.addAssign_operation (var_val_7799  COMMA_SOURCE_FILE ("goil_syntax.galgas", 416)) ;
-          var_val_7799 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 417)), cast_13136_multiAttribute.getter_location (SOURCE_FILE ("goil_syntax.galgas", 417)), var_aList_13168  COMMA_SOURCE_FILE ("goil_syntax.galgas", 417)) ;
+      if (var_attributeList_13548.isValid ()) {
+        if (var_attributeList_13548.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
+          GALGAS_multipleAttribute cast_13742_multiAttribute ((cPtr_multipleAttribute *) var_attributeList_13548.ptr ()) ;
+          GALGAS_identifierList var_aList_13774 = cast_13742_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 429)) ;
+          var_aList_13774.addAssign_operation (var_val_8405  COMMA_SOURCE_FILE ("goil_syntax.galgas", 430)) ;
+          var_val_8405 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 431)), cast_13742_multiAttribute.getter_location (SOURCE_FILE ("goil_syntax.galgas", 431)), var_aList_13774  COMMA_SOURCE_FILE ("goil_syntax.galgas", 431)) ;
         }
       }
     }else if (kBoolFalse == test_18) {
-      GALGAS_identifierList var_aList_13358 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 420)) ;
-      GALGAS_object_5F_t var_defaultValue_13437 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_type_7871.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 422)) ;
-      if (var_defaultValue_13437.isValid ()) {
-        if (var_defaultValue_13437.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
-          GALGAS_multipleAttribute cast_13566_multiAttribute ((cPtr_multipleAttribute *) var_defaultValue_13437.ptr ()) ;
-          var_aList_13358 = cast_13566_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 427)) ;
+      GALGAS_identifierList var_aList_13964 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 434)) ;
+      GALGAS_object_5F_t var_defaultValue_14043 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_type_8477.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 436)) ;
+      if (var_defaultValue_14043.isValid ()) {
+        if (var_defaultValue_14043.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
+          GALGAS_multipleAttribute cast_14172_multiAttribute ((cPtr_multipleAttribute *) var_defaultValue_14043.ptr ()) ;
+          var_aList_13964 = cast_14172_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 441)) ;
         }
       }
-      var_aList_13358.addAssign_operation (var_val_7799  COMMA_SOURCE_FILE ("goil_syntax.galgas", 432)) ;
-      var_val_7799 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 434)), var_val_7799.getter_location (SOURCE_FILE ("goil_syntax.galgas", 434)), var_aList_13358  COMMA_SOURCE_FILE ("goil_syntax.galgas", 434)) ;
+      var_aList_13964.addAssign_operation (var_val_8405  COMMA_SOURCE_FILE ("goil_syntax.galgas", 446)) ;
+      var_val_8405 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 448)), var_val_8405.getter_location (SOURCE_FILE ("goil_syntax.galgas", 448)), var_aList_13964  COMMA_SOURCE_FILE ("goil_syntax.galgas", 448)) ;
     }
   }else if (kBoolFalse == test_17) {
-    const enumGalgasBool test_19 = var_idfs_12818.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 437)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 437)).boolEnum () ;
+    const enumGalgasBool test_19 = var_idfs_13424.getter_hasKey (var_idf_8389.getter_string (SOURCE_FILE ("goil_syntax.galgas", 451)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 451)).boolEnum () ;
     if (kBoolTrue == test_19) {
-      GALGAS_object_5F_t var_existingObject_14042 ;
+      GALGAS_object_5F_t var_existingObject_14648 ;
       {
-      var_idfs_12818.setter_del (var_idf_7783, var_existingObject_14042, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 441)) ;
+      var_idfs_13424.setter_del (var_idf_8389, var_existingObject_14648, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 455)) ;
       }
       {
-      var_val_7799.insulate (HERE) ;
-      cPtr_object_5F_t * ptr_14095 = (cPtr_object_5F_t *) var_val_7799.ptr () ;
-      callExtensionSetter_mergeSubAttributes ((cPtr_object_5F_t *) ptr_14095, var_existingObject_14042, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 442)) ;
+      var_val_8405.insulate (HERE) ;
+      cPtr_object_5F_t * ptr_14701 = (cPtr_object_5F_t *) var_val_8405.ptr () ;
+      callExtensionSetter_mergeSubAttributes ((cPtr_object_5F_t *) ptr_14701, var_existingObject_14648, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 456)) ;
       }
     }
   }
-  const enumGalgasBool test_20 = var_typeOk_7970.boolEnum () ;
+  const enumGalgasBool test_20 = var_typeOk_8576.boolEnum () ;
   if (kBoolTrue == test_20) {
     {
-    var_idfs_12818.setter_put (var_idf_7783, var_val_7799, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 446)) ;
+    var_idfs_13424.setter_put (var_idf_8389, var_val_8405, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 460)) ;
     }
   }
   {
-  ioArgument_identifiers.setter_setObjectParams (var_idfs_12818 COMMA_SOURCE_FILE ("goil_syntax.galgas", 448)) ;
+  ioArgument_identifiers.setter_setObjectParams (var_idfs_13424 COMMA_SOURCE_FILE ("goil_syntax.galgas", 462)) ;
   }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 261)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 275)) ;
   switch (select_goil_5F_syntax_7 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 274)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)) ;
     switch (select_goil_5F_syntax_8 (inCompiler)) {
     case 1: {
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 278)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 292)) ;
       switch (select_goil_5F_syntax_9 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 297)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 311)) ;
         nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 299)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 313)) ;
       } break ;
       case 2: {
       } break ;
@@ -7708,11 +7740,11 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
       nt_sign_parse (inCompiler) ;
       switch (select_goil_5F_syntax_10 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_uint_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 316)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_uint_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 330)) ;
         nt_description_parse (inCompiler) ;
       } break ;
       case 2: {
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_float_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 322)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_float_5F_number) COMMA_SOURCE_FILE ("goil_syntax.galgas", 336)) ;
         nt_description_parse (inCompiler) ;
       } break ;
       default:
@@ -7723,9 +7755,9 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
       nt_boolean_parse (inCompiler) ;
       switch (select_goil_5F_syntax_11 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 345)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)) ;
         nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 350)) ;
+        inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 364)) ;
       } break ;
       case 2: {
       } break ;
@@ -7735,11 +7767,11 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
       nt_description_parse (inCompiler) ;
     } break ;
     case 4: {
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 357)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 371)) ;
       nt_description_parse (inCompiler) ;
     } break ;
     case 5: {
-      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_AUTO) COMMA_SOURCE_FILE ("goil_syntax.galgas", 362)) ;
+      inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_AUTO) COMMA_SOURCE_FILE ("goil_syntax.galgas", 376)) ;
       nt_description_parse (inCompiler) ;
     } break ;
     default:
@@ -7747,16 +7779,16 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
     }
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 385)) ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 397)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_idf) COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 411)) ;
     nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__7D_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)) ;
     nt_description_parse (inCompiler) ;
   } break ;
   default:
     break ;
   }
-  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 403)) ;
+  inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken__3B_) COMMA_SOURCE_FILE ("goil_syntax.galgas", 417)) ;
   inCompiler->resetTemplateString () ;
 }
 
@@ -7767,45 +7799,45 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_file_5F_level_i10_ (
                                                                                 GALGAS_string & ioArgument_fileIncludeList,
                                                                                 const GALGAS_bool constinArgument_rootFile,
                                                                                 C_Lexique_goil_5F_lexique * inCompiler) {
-  GALGAS_bool var_includeIfExists_14410 = GALGAS_bool (false) ;
+  GALGAS_bool var_includeIfExists_15016 = GALGAS_bool (false) ;
   switch (select_goil_5F_syntax_12 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 459)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 473)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 461)) ;
-    var_includeIfExists_14410 = GALGAS_bool (true) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 475)) ;
+    var_includeIfExists_15016 = GALGAS_bool (true) ;
   } break ;
   default:
     break ;
   }
-  GALGAS_lstring var_file_5F_name_14518 ;
+  GALGAS_lstring var_file_5F_name_15124 ;
   switch (select_goil_5F_syntax_13 (inCompiler)) {
   case 1: {
-    var_file_5F_name_14518 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 465)) ;
+    var_file_5F_name_15124 = inCompiler->synthetizedAttribute_a_5F_string () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 479)) ;
     {
-    routine_file_5F_in_5F_path (var_file_5F_name_14518, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 466)) ;
+    routine_file_5F_in_5F_path (var_file_5F_name_15124, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 480)) ;
     }
   } break ;
   case 2: {
-    var_file_5F_name_14518 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 468)) ;
+    var_file_5F_name_15124 = inCompiler->synthetizedAttribute_a_5F_string () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 482)) ;
   } break ;
   default:
     break ;
   }
-  GALGAS_bool test_0 = var_includeIfExists_14410.operator_not (SOURCE_FILE ("goil_syntax.galgas", 470)) ;
+  GALGAS_bool test_0 = var_includeIfExists_15016.operator_not (SOURCE_FILE ("goil_syntax.galgas", 484)) ;
   if (kBoolTrue != test_0.boolEnum ()) {
-    GALGAS_bool test_1 = var_includeIfExists_14410 ;
+    GALGAS_bool test_1 = var_includeIfExists_15016 ;
     if (kBoolTrue == test_1.boolEnum ()) {
-      test_1 = var_file_5F_name_14518.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 470)) ;
+      test_1 = var_file_5F_name_15124.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 484)) ;
     }
     test_0 = test_1 ;
   }
   const enumGalgasBool test_2 = test_0.boolEnum () ;
   if (kBoolTrue == test_2) {
-    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_14518, ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 471)) ;
+    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15124, ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 485)) ;
   }
 }
 
@@ -7814,20 +7846,20 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_file_5F_level_i10_ (
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_file_5F_level_i10_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_12 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 459)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 473)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 461)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 475)) ;
   } break ;
   default:
     break ;
   }
   switch (select_goil_5F_syntax_13 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 465)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 479)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 468)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 482)) ;
   } break ;
   default:
     break ;
@@ -7842,45 +7874,45 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_ (c
                                                                                GALGAS_string & ioArgument_fileIncludeList,
                                                                                const GALGAS_bool constinArgument_rootFile,
                                                                                C_Lexique_goil_5F_lexique * inCompiler) {
-  GALGAS_bool var_includeIfExists_14957 = GALGAS_bool (false) ;
+  GALGAS_bool var_includeIfExists_15563 = GALGAS_bool (false) ;
   switch (select_goil_5F_syntax_14 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 483)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 497)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 485)) ;
-    var_includeIfExists_14957 = GALGAS_bool (true) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 499)) ;
+    var_includeIfExists_15563 = GALGAS_bool (true) ;
   } break ;
   default:
     break ;
   }
-  GALGAS_lstring var_file_5F_name_15065 ;
+  GALGAS_lstring var_file_5F_name_15671 ;
   switch (select_goil_5F_syntax_15 (inCompiler)) {
   case 1: {
-    var_file_5F_name_15065 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 489)) ;
+    var_file_5F_name_15671 = inCompiler->synthetizedAttribute_a_5F_string () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 503)) ;
     {
-    routine_file_5F_in_5F_path (var_file_5F_name_15065, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 490)) ;
+    routine_file_5F_in_5F_path (var_file_5F_name_15671, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 504)) ;
     }
   } break ;
   case 2: {
-    var_file_5F_name_15065 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 492)) ;
+    var_file_5F_name_15671 = inCompiler->synthetizedAttribute_a_5F_string () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 506)) ;
   } break ;
   default:
     break ;
   }
-  GALGAS_bool test_0 = var_includeIfExists_14957.operator_not (SOURCE_FILE ("goil_syntax.galgas", 494)) ;
+  GALGAS_bool test_0 = var_includeIfExists_15563.operator_not (SOURCE_FILE ("goil_syntax.galgas", 508)) ;
   if (kBoolTrue != test_0.boolEnum ()) {
-    GALGAS_bool test_1 = var_includeIfExists_14957 ;
+    GALGAS_bool test_1 = var_includeIfExists_15563 ;
     if (kBoolTrue == test_1.boolEnum ()) {
-      test_1 = var_file_5F_name_15065.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 494)) ;
+      test_1 = var_file_5F_name_15671.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 508)) ;
     }
     test_0 = test_1 ;
   }
   const enumGalgasBool test_2 = test_0.boolEnum () ;
   if (kBoolTrue == test_2) {
-    cGrammar_goil_5F_cpu_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15065, constinArgument_imp, ioArgument_objects, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 495)) ;
+    cGrammar_goil_5F_cpu_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15671, constinArgument_imp, ioArgument_objects, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 509)) ;
   }
 }
 
@@ -7889,20 +7921,20 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_ (c
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_14 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 483)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 497)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 485)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 499)) ;
   } break ;
   default:
     break ;
   }
   switch (select_goil_5F_syntax_15 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 489)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 503)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 492)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 506)) ;
   } break ;
   default:
     break ;
@@ -7915,45 +7947,45 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_par
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_object_5F_level_i12_ (const GALGAS_implementationObjectMap constinArgument_types,
                                                                                   GALGAS_objectAttributes & ioArgument_identifiers,
                                                                                   C_Lexique_goil_5F_lexique * inCompiler) {
-  GALGAS_bool var_includeIfExists_15472 = GALGAS_bool (false) ;
+  GALGAS_bool var_includeIfExists_16078 = GALGAS_bool (false) ;
   switch (select_goil_5F_syntax_16 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 505)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 519)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 507)) ;
-    var_includeIfExists_15472 = GALGAS_bool (true) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 521)) ;
+    var_includeIfExists_16078 = GALGAS_bool (true) ;
   } break ;
   default:
     break ;
   }
-  GALGAS_lstring var_file_5F_name_15580 ;
+  GALGAS_lstring var_file_5F_name_16186 ;
   switch (select_goil_5F_syntax_17 (inCompiler)) {
   case 1: {
-    var_file_5F_name_15580 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 511)) ;
+    var_file_5F_name_16186 = inCompiler->synthetizedAttribute_a_5F_string () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 525)) ;
     {
-    routine_file_5F_in_5F_path (var_file_5F_name_15580, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 512)) ;
+    routine_file_5F_in_5F_path (var_file_5F_name_16186, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 526)) ;
     }
   } break ;
   case 2: {
-    var_file_5F_name_15580 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 514)) ;
+    var_file_5F_name_16186 = inCompiler->synthetizedAttribute_a_5F_string () ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 528)) ;
   } break ;
   default:
     break ;
   }
-  GALGAS_bool test_0 = var_includeIfExists_15472.operator_not (SOURCE_FILE ("goil_syntax.galgas", 516)) ;
+  GALGAS_bool test_0 = var_includeIfExists_16078.operator_not (SOURCE_FILE ("goil_syntax.galgas", 530)) ;
   if (kBoolTrue != test_0.boolEnum ()) {
-    GALGAS_bool test_1 = var_includeIfExists_15472 ;
+    GALGAS_bool test_1 = var_includeIfExists_16078 ;
     if (kBoolTrue == test_1.boolEnum ()) {
-      test_1 = var_file_5F_name_15580.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 516)) ;
+      test_1 = var_file_5F_name_16186.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 530)) ;
     }
     test_0 = test_1 ;
   }
   const enumGalgasBool test_2 = test_0.boolEnum () ;
   if (kBoolTrue == test_2) {
-    cGrammar_goil_5F_object_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15580, constinArgument_types, ioArgument_identifiers  COMMA_SOURCE_FILE ("goil_syntax.galgas", 517)) ;
+    cGrammar_goil_5F_object_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_16186, constinArgument_types, ioArgument_identifiers  COMMA_SOURCE_FILE ("goil_syntax.galgas", 531)) ;
   }
 }
 
@@ -7962,20 +7994,20 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_object_5F_level_i12_
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_object_5F_level_i12_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_16 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 505)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_include) COMMA_SOURCE_FILE ("goil_syntax.galgas", 519)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 507)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_includeifexists) COMMA_SOURCE_FILE ("goil_syntax.galgas", 521)) ;
   } break ;
   default:
     break ;
   }
   switch (select_goil_5F_syntax_17 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 511)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_g_5F_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 525)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 514)) ;
+    inCompiler->acceptTerminal (ACCEPT_TERMINAL (C_Lexique_goil_5F_lexique::kToken_string) COMMA_SOURCE_FILE ("goil_syntax.galgas", 528)) ;
   } break ;
   default:
     break ;
@@ -10948,7 +10980,11 @@ void C_Lexique_arxml_5F_scanner::enterToken (cTokenFor_arxml_5F_scanner & ioToke
   ptr->mEndLocation = mTokenEndLocation ;
   ptr->mTemplateStringBeforeToken = ioToken.mTemplateStringBeforeToken ;
   ioToken.mTemplateStringBeforeToken = "" ;
-  ptr->mLexicalAttribute_tokenString = ioToken.mLexicalAttribute_tokenString ;
+  if (ioToken.mTokenCode == kToken_name) {
+    ptr->mLexicalAttribute_tokenString = internedString (ioToken.mLexicalAttribute_tokenString) ;
+  }else{
+    ptr->mLexicalAttribute_tokenString = ioToken.mLexicalAttribute_tokenString ;
+  }
   enterTokenFromPointer (ptr) ;
 }
 
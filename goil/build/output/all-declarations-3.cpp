@@ -4893,25 +4893,1532 @@ static void extensionMethod_gtlTemplate_execute (const cPtr_gtlTemplate * inObje
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlTemplate * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlTemplate) ;
-  extensionMethod_execute (object->mProperty_program, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 269)) ;
+  const enumGalgasBool test_0 = GALGAS_bool (gOption_gtl_5F_options_profileTemplates.getter_value ()).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    GALGAS_uint var_startLength_7259 = ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_types.galgas", 270)) ;
+    GALGAS_uint var_startTime_7356 ;
+    GALGAS_uint var_savedChildTime_7390 ;
+    GALGAS_string var_savedStack_7420 ;
+    {
+    ioArgument_lib.insulate (HERE) ;
+    cPtr_library * ptr_7294 = (cPtr_library *) ioArgument_lib.ptr () ;
+    callExtensionSetter_enterTemplateProfile ((cPtr_library *) ptr_7294, object->mProperty_path, var_startTime_7356, var_savedChildTime_7390, var_savedStack_7420, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 271)) ;
+    }
+    extensionMethod_execute (object->mProperty_program, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 277)) ;
+    GALGAS_uint var_emittedCharacters_7514 = GALGAS_uint ((uint32_t) 0U) ;
+    const enumGalgasBool test_1 = GALGAS_bool (kIsStrictSup, ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_types.galgas", 279)).objectCompare (var_startLength_7259)).boolEnum () ;
+    if (kBoolTrue == test_1) {
+      var_emittedCharacters_7514 = ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_types.galgas", 280)).substract_operation (var_startLength_7259, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 280)) ;
+    }
+    {
+    ioArgument_lib.insulate (HERE) ;
+    cPtr_library * ptr_7647 = (cPtr_library *) ioArgument_lib.ptr () ;
+    callExtensionSetter_exitTemplateProfile ((cPtr_library *) ptr_7647, object->mProperty_path, var_startTime_7356, var_savedChildTime_7390, var_savedStack_7420, var_emittedCharacters_7514, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 282)) ;
+    }
+  }else if (kBoolFalse == test_0) {
+    extensionMethod_execute (object->mProperty_program, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 290)) ;
+  }
+}
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionMethod_gtlTemplate_execute (void) {
+  enterExtensionMethod_execute (kTypeDescriptor_GALGAS_gtlTemplate.mSlotID,
+                                extensionMethod_gtlTemplate_execute) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionMethod_gtlTemplate_execute (void) {
+  gExtensionMethodTable_gtlTemplate_execute.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gMethod_gtlTemplate_execute (defineExtensionMethod_gtlTemplate_execute,
+                                                freeExtensionMethod_gtlTemplate_execute) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement_gtlTemplateProfileMap::cMapElement_gtlTemplateProfileMap (const GALGAS_lstring & inKey,
+                                                                      const GALGAS_uint & in_calls,
+                                                                      const GALGAS_uint & in_inclusiveTime,
+                                                                      const GALGAS_uint & in_exclusiveTime,
+                                                                      const GALGAS_uint & in_emittedCharacters
+                                                                      COMMA_LOCATION_ARGS) :
+cMapElement (inKey COMMA_THERE),
+mProperty_calls (in_calls),
+mProperty_inclusiveTime (in_inclusiveTime),
+mProperty_exclusiveTime (in_exclusiveTime),
+mProperty_emittedCharacters (in_emittedCharacters) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool cMapElement_gtlTemplateProfileMap::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_calls.isValid () && mProperty_inclusiveTime.isValid () && mProperty_exclusiveTime.isValid () && mProperty_emittedCharacters.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement * cMapElement_gtlTemplateProfileMap::copy (void) {
+  cMapElement * result = NULL ;
+  macroMyNew (result, cMapElement_gtlTemplateProfileMap (mProperty_lkey, mProperty_calls, mProperty_inclusiveTime, mProperty_exclusiveTime, mProperty_emittedCharacters COMMA_HERE)) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void cMapElement_gtlTemplateProfileMap::description (C_String & ioString, const int32_t inIndentation) const {
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "calls" ":" ;
+  mProperty_calls.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "inclusiveTime" ":" ;
+  mProperty_inclusiveTime.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "exclusiveTime" ":" ;
+  mProperty_exclusiveTime.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "emittedCharacters" ":" ;
+  mProperty_emittedCharacters.description (ioString, inIndentation) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult cMapElement_gtlTemplateProfileMap::compare (const cCollectionElement * inOperand) const {
+  cMapElement_gtlTemplateProfileMap * operand = (cMapElement_gtlTemplateProfileMap *) inOperand ;
+  typeComparisonResult result = mProperty_lkey.objectCompare (operand->mProperty_lkey) ;
+  if (kOperandEqual == result) {
+    result = mProperty_calls.objectCompare (operand->mProperty_calls) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_inclusiveTime.objectCompare (operand->mProperty_inclusiveTime) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_exclusiveTime.objectCompare (operand->mProperty_exclusiveTime) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_emittedCharacters.objectCompare (operand->mProperty_emittedCharacters) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap::GALGAS_gtlTemplateProfileMap (void) :
+AC_GALGAS_map () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap::GALGAS_gtlTemplateProfileMap (const GALGAS_gtlTemplateProfileMap & inSource) :
+AC_GALGAS_map (inSource) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap & GALGAS_gtlTemplateProfileMap::operator = (const GALGAS_gtlTemplateProfileMap & inSource) {
+  * ((AC_GALGAS_map *) this) = inSource ;
+  return * this ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap GALGAS_gtlTemplateProfileMap::constructor_emptyMap (LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileMap result ;
+  result.makeNewEmptyMap (THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap GALGAS_gtlTemplateProfileMap::constructor_mapWithMapToOverride (const GALGAS_gtlTemplateProfileMap & inMapToOverride
+                                                                                             COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileMap result ;
+  result.makeNewEmptyMapWithMapToOverride (inMapToOverride COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap GALGAS_gtlTemplateProfileMap::getter_overriddenMap (C_Compiler * inCompiler
+                                                                                 COMMA_LOCATION_ARGS) const {
+  GALGAS_gtlTemplateProfileMap result ;
+  getOverridenMap (result, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap::addAssign_operation (const GALGAS_lstring & inKey,
+                                                        const GALGAS_uint & inArgument0,
+                                                        const GALGAS_uint & inArgument1,
+                                                        const GALGAS_uint & inArgument2,
+                                                        const GALGAS_uint & inArgument3,
+                                                        C_Compiler * inCompiler
+                                                        COMMA_LOCATION_ARGS) {
+  cMapElement_gtlTemplateProfileMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlTemplateProfileMap (inKey, inArgument0, inArgument1, inArgument2, inArgument3 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "@gtlTemplateProfileMap insert error: '%K' already in map" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap::setter_put (GALGAS_lstring inKey,
+                                               GALGAS_uint inArgument0,
+                                               GALGAS_uint inArgument1,
+                                               GALGAS_uint inArgument2,
+                                               GALGAS_uint inArgument3,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) {
+  cMapElement_gtlTemplateProfileMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlTemplateProfileMap (inKey, inArgument0, inArgument1, inArgument2, inArgument3 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "the template '%K' is already profiled" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const char * kSearchErrorMessage_gtlTemplateProfileMap_get = "the template '%K' is not profiled" ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap::method_get (GALGAS_lstring inKey,
+                                               GALGAS_uint & outArgument0,
+                                               GALGAS_uint & outArgument1,
+                                               GALGAS_uint & outArgument2,
+                                               GALGAS_uint & outArgument3,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) const {
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) performSearch (inKey,
+                                                                                                           inCompiler,
+                                                                                                           kSearchErrorMessage_gtlTemplateProfileMap_get
+                                                                                                           COMMA_THERE) ;
+  if (NULL == p) {
+    outArgument0.drop () ;
+    outArgument1.drop () ;
+    outArgument2.drop () ;
+    outArgument3.drop () ;
+  }else{
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    outArgument0 = p->mProperty_calls ;
+    outArgument1 = p->mProperty_inclusiveTime ;
+    outArgument2 = p->mProperty_exclusiveTime ;
+    outArgument3 = p->mProperty_emittedCharacters ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap::getter_callsForKey (const GALGAS_string & inKey,
+                                                              C_Compiler * inCompiler
+                                                              COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    result = p->mProperty_calls ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap::getter_inclusiveTimeForKey (const GALGAS_string & inKey,
+                                                                      C_Compiler * inCompiler
+                                                                      COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    result = p->mProperty_inclusiveTime ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap::getter_exclusiveTimeForKey (const GALGAS_string & inKey,
+                                                                      C_Compiler * inCompiler
+                                                                      COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    result = p->mProperty_exclusiveTime ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap::getter_emittedCharactersForKey (const GALGAS_string & inKey,
+                                                                          C_Compiler * inCompiler
+                                                                          COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    result = p->mProperty_emittedCharacters ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap::setter_setCallsForKey (GALGAS_uint inAttributeValue,
+                                                          GALGAS_string inKey,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlTemplateProfileMap * p = (cMapElement_gtlTemplateProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    p->mProperty_calls = inAttributeValue ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap::setter_setInclusiveTimeForKey (GALGAS_uint inAttributeValue,
+                                                                  GALGAS_string inKey,
+                                                                  C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlTemplateProfileMap * p = (cMapElement_gtlTemplateProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    p->mProperty_inclusiveTime = inAttributeValue ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap::setter_setExclusiveTimeForKey (GALGAS_uint inAttributeValue,
+                                                                  GALGAS_string inKey,
+                                                                  C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlTemplateProfileMap * p = (cMapElement_gtlTemplateProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    p->mProperty_exclusiveTime = inAttributeValue ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap::setter_setEmittedCharactersForKey (GALGAS_uint inAttributeValue,
+                                                                      GALGAS_string inKey,
+                                                                      C_Compiler * inCompiler
+                                                                      COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlTemplateProfileMap * p = (cMapElement_gtlTemplateProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+    p->mProperty_emittedCharacters = inAttributeValue ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement_gtlTemplateProfileMap * GALGAS_gtlTemplateProfileMap::readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                                     const GALGAS_string & inKey
+                                                                                                     COMMA_LOCATION_ARGS) {
+  cMapElement_gtlTemplateProfileMap * result = (cMapElement_gtlTemplateProfileMap *) searchForReadWriteAttribute (inKey, false, inCompiler COMMA_THERE) ;
+  macroNullOrValidSharedObject (result, cMapElement_gtlTemplateProfileMap) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cEnumerator_gtlTemplateProfileMap::cEnumerator_gtlTemplateProfileMap (const GALGAS_gtlTemplateProfileMap & inEnumeratedObject,
+                                                                      const typeEnumerationOrder inOrder) :
+cGenericAbstractEnumerator (inOrder) {
+  inEnumeratedObject.populateEnumerationArray (mEnumerationArray) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap_2D_element cEnumerator_gtlTemplateProfileMap::current (LOCATION_ARGS) const {
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+  return GALGAS_gtlTemplateProfileMap_2D_element (p->mProperty_lkey, p->mProperty_calls, p->mProperty_inclusiveTime, p->mProperty_exclusiveTime, p->mProperty_emittedCharacters) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_lstring cEnumerator_gtlTemplateProfileMap::current_lkey (LOCATION_ARGS) const {
+  const cMapElement * p = (const cMapElement *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement) ;
+  return p->mProperty_lkey ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileMap::current_calls (LOCATION_ARGS) const {
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+  return p->mProperty_calls ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileMap::current_inclusiveTime (LOCATION_ARGS) const {
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+  return p->mProperty_inclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileMap::current_exclusiveTime (LOCATION_ARGS) const {
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+  return p->mProperty_exclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileMap::current_emittedCharacters (LOCATION_ARGS) const {
+  const cMapElement_gtlTemplateProfileMap * p = (const cMapElement_gtlTemplateProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlTemplateProfileMap) ;
+  return p->mProperty_emittedCharacters ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                             @gtlTemplateProfileMap type                                             *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlTemplateProfileMap ("gtlTemplateProfileMap",
+                                              NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlTemplateProfileMap::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlTemplateProfileMap ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlTemplateProfileMap::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlTemplateProfileMap (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap GALGAS_gtlTemplateProfileMap::extractObject (const GALGAS_object & inObject,
+                                                                          C_Compiler * inCompiler
+                                                                          COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileMap result ;
+  const GALGAS_gtlTemplateProfileMap * p = (const GALGAS_gtlTemplateProfileMap *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlTemplateProfileMap *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlTemplateProfileMap", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement_gtlFoldedStackMap::cMapElement_gtlFoldedStackMap (const GALGAS_lstring & inKey,
+                                                              const GALGAS_uint & in_time
+                                                              COMMA_LOCATION_ARGS) :
+cMapElement (inKey COMMA_THERE),
+mProperty_time (in_time) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool cMapElement_gtlFoldedStackMap::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_time.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement * cMapElement_gtlFoldedStackMap::copy (void) {
+  cMapElement * result = NULL ;
+  macroMyNew (result, cMapElement_gtlFoldedStackMap (mProperty_lkey, mProperty_time COMMA_HERE)) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void cMapElement_gtlFoldedStackMap::description (C_String & ioString, const int32_t inIndentation) const {
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "time" ":" ;
+  mProperty_time.description (ioString, inIndentation) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult cMapElement_gtlFoldedStackMap::compare (const cCollectionElement * inOperand) const {
+  cMapElement_gtlFoldedStackMap * operand = (cMapElement_gtlFoldedStackMap *) inOperand ;
+  typeComparisonResult result = mProperty_lkey.objectCompare (operand->mProperty_lkey) ;
+  if (kOperandEqual == result) {
+    result = mProperty_time.objectCompare (operand->mProperty_time) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap::GALGAS_gtlFoldedStackMap (void) :
+AC_GALGAS_map () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap::GALGAS_gtlFoldedStackMap (const GALGAS_gtlFoldedStackMap & inSource) :
+AC_GALGAS_map (inSource) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap & GALGAS_gtlFoldedStackMap::operator = (const GALGAS_gtlFoldedStackMap & inSource) {
+  * ((AC_GALGAS_map *) this) = inSource ;
+  return * this ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap GALGAS_gtlFoldedStackMap::constructor_emptyMap (LOCATION_ARGS) {
+  GALGAS_gtlFoldedStackMap result ;
+  result.makeNewEmptyMap (THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap GALGAS_gtlFoldedStackMap::constructor_mapWithMapToOverride (const GALGAS_gtlFoldedStackMap & inMapToOverride
+                                                                                     COMMA_LOCATION_ARGS) {
+  GALGAS_gtlFoldedStackMap result ;
+  result.makeNewEmptyMapWithMapToOverride (inMapToOverride COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap GALGAS_gtlFoldedStackMap::getter_overriddenMap (C_Compiler * inCompiler
+                                                                         COMMA_LOCATION_ARGS) const {
+  GALGAS_gtlFoldedStackMap result ;
+  getOverridenMap (result, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlFoldedStackMap::addAssign_operation (const GALGAS_lstring & inKey,
+                                                    const GALGAS_uint & inArgument0,
+                                                    C_Compiler * inCompiler
+                                                    COMMA_LOCATION_ARGS) {
+  cMapElement_gtlFoldedStackMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlFoldedStackMap (inKey, inArgument0 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "@gtlFoldedStackMap insert error: '%K' already in map" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlFoldedStackMap::setter_put (GALGAS_lstring inKey,
+                                           GALGAS_uint inArgument0,
+                                           C_Compiler * inCompiler
+                                           COMMA_LOCATION_ARGS) {
+  cMapElement_gtlFoldedStackMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlFoldedStackMap (inKey, inArgument0 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "the stack '%K' is already profiled" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const char * kSearchErrorMessage_gtlFoldedStackMap_get = "the stack '%K' is not profiled" ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlFoldedStackMap::method_get (GALGAS_lstring inKey,
+                                           GALGAS_uint & outArgument0,
+                                           C_Compiler * inCompiler
+                                           COMMA_LOCATION_ARGS) const {
+  const cMapElement_gtlFoldedStackMap * p = (const cMapElement_gtlFoldedStackMap *) performSearch (inKey,
+                                                                                                   inCompiler,
+                                                                                                   kSearchErrorMessage_gtlFoldedStackMap_get
+                                                                                                   COMMA_THERE) ;
+  if (NULL == p) {
+    outArgument0.drop () ;
+  }else{
+    macroValidSharedObject (p, cMapElement_gtlFoldedStackMap) ;
+    outArgument0 = p->mProperty_time ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlFoldedStackMap::getter_timeForKey (const GALGAS_string & inKey,
+                                                         C_Compiler * inCompiler
+                                                         COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlFoldedStackMap * p = (const cMapElement_gtlFoldedStackMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlFoldedStackMap) ;
+    result = p->mProperty_time ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlFoldedStackMap::setter_setTimeForKey (GALGAS_uint inAttributeValue,
+                                                     GALGAS_string inKey,
+                                                     C_Compiler * inCompiler
+                                                     COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlFoldedStackMap * p = (cMapElement_gtlFoldedStackMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlFoldedStackMap) ;
+    p->mProperty_time = inAttributeValue ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement_gtlFoldedStackMap * GALGAS_gtlFoldedStackMap::readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                             const GALGAS_string & inKey
+                                                                                             COMMA_LOCATION_ARGS) {
+  cMapElement_gtlFoldedStackMap * result = (cMapElement_gtlFoldedStackMap *) searchForReadWriteAttribute (inKey, false, inCompiler COMMA_THERE) ;
+  macroNullOrValidSharedObject (result, cMapElement_gtlFoldedStackMap) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cEnumerator_gtlFoldedStackMap::cEnumerator_gtlFoldedStackMap (const GALGAS_gtlFoldedStackMap & inEnumeratedObject,
+                                                              const typeEnumerationOrder inOrder) :
+cGenericAbstractEnumerator (inOrder) {
+  inEnumeratedObject.populateEnumerationArray (mEnumerationArray) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap_2D_element cEnumerator_gtlFoldedStackMap::current (LOCATION_ARGS) const {
+  const cMapElement_gtlFoldedStackMap * p = (const cMapElement_gtlFoldedStackMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlFoldedStackMap) ;
+  return GALGAS_gtlFoldedStackMap_2D_element (p->mProperty_lkey, p->mProperty_time) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_lstring cEnumerator_gtlFoldedStackMap::current_lkey (LOCATION_ARGS) const {
+  const cMapElement * p = (const cMapElement *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement) ;
+  return p->mProperty_lkey ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlFoldedStackMap::current_time (LOCATION_ARGS) const {
+  const cMapElement_gtlFoldedStackMap * p = (const cMapElement_gtlFoldedStackMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlFoldedStackMap) ;
+  return p->mProperty_time ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                               @gtlFoldedStackMap type                                               *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlFoldedStackMap ("gtlFoldedStackMap",
+                                          NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlFoldedStackMap::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlFoldedStackMap ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlFoldedStackMap::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlFoldedStackMap (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap GALGAS_gtlFoldedStackMap::extractObject (const GALGAS_object & inObject,
+                                                                  C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) {
+  GALGAS_gtlFoldedStackMap result ;
+  const GALGAS_gtlFoldedStackMap * p = (const GALGAS_gtlFoldedStackMap *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlFoldedStackMap *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlFoldedStackMap", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                 Class for element of '@gtlTemplateProfileList' list                                 *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class cCollectionElement_gtlTemplateProfileList : public cCollectionElement {
+  public : GALGAS_gtlTemplateProfileList_2D_element mObject ;
+
+//--- Constructor
+  public : cCollectionElement_gtlTemplateProfileList (const GALGAS_string & in_path,
+                                                      const GALGAS_uint & in_calls,
+                                                      const GALGAS_uint & in_inclusiveTime,
+                                                      const GALGAS_uint & in_exclusiveTime,
+                                                      const GALGAS_uint & in_emittedCharacters
+                                                      COMMA_LOCATION_ARGS) ;
+
+//--- Virtual method for comparing elements
+  public : virtual typeComparisonResult compare (const cCollectionElement * inOperand) const ;
+
+//--- Virtual method that checks that all attributes are valid
+  public : virtual bool isValid (void) const ;
+
+//--- Virtual method that returns a copy of current object
+  public : virtual cCollectionElement * copy (void) ;
+
+//--- Description
+  public : virtual void description (C_String & ioString, const int32_t inIndentation) const ;
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cCollectionElement_gtlTemplateProfileList::cCollectionElement_gtlTemplateProfileList (const GALGAS_string & in_path,
+                                                                                      const GALGAS_uint & in_calls,
+                                                                                      const GALGAS_uint & in_inclusiveTime,
+                                                                                      const GALGAS_uint & in_exclusiveTime,
+                                                                                      const GALGAS_uint & in_emittedCharacters
+                                                                                      COMMA_LOCATION_ARGS) :
+cCollectionElement (THERE),
+mObject (in_path, in_calls, in_inclusiveTime, in_exclusiveTime, in_emittedCharacters) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool cCollectionElement_gtlTemplateProfileList::isValid (void) const {
+  return mObject.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cCollectionElement * cCollectionElement_gtlTemplateProfileList::copy (void) {
+  cCollectionElement * result = NULL ;
+  macroMyNew (result, cCollectionElement_gtlTemplateProfileList (mObject.mProperty_path, mObject.mProperty_calls, mObject.mProperty_inclusiveTime, mObject.mProperty_exclusiveTime, mObject.mProperty_emittedCharacters COMMA_HERE)) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void cCollectionElement_gtlTemplateProfileList::description (C_String & ioString, const int32_t inIndentation) const {
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "path" ":" ;
+  mObject.mProperty_path.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "calls" ":" ;
+  mObject.mProperty_calls.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "inclusiveTime" ":" ;
+  mObject.mProperty_inclusiveTime.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "exclusiveTime" ":" ;
+  mObject.mProperty_exclusiveTime.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "emittedCharacters" ":" ;
+  mObject.mProperty_emittedCharacters.description (ioString, inIndentation) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult cCollectionElement_gtlTemplateProfileList::compare (const cCollectionElement * inOperand) const {
+  cCollectionElement_gtlTemplateProfileList * operand = (cCollectionElement_gtlTemplateProfileList *) inOperand ;
+  macroValidSharedObject (operand, cCollectionElement_gtlTemplateProfileList) ;
+  return mObject.objectCompare (operand->mObject) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList::GALGAS_gtlTemplateProfileList (void) :
+AC_GALGAS_list () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList::GALGAS_gtlTemplateProfileList (const capCollectionElementArray & inSharedArray) :
+AC_GALGAS_list (inSharedArray) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList GALGAS_gtlTemplateProfileList::constructor_emptyList (UNUSED_LOCATION_ARGS) {
+  return GALGAS_gtlTemplateProfileList  (capCollectionElementArray ()) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList GALGAS_gtlTemplateProfileList::constructor_listWithValue (const GALGAS_string & inOperand0,
+                                                                                        const GALGAS_uint & inOperand1,
+                                                                                        const GALGAS_uint & inOperand2,
+                                                                                        const GALGAS_uint & inOperand3,
+                                                                                        const GALGAS_uint & inOperand4
+                                                                                        COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileList result ;
+  if (inOperand0.isValid () && inOperand1.isValid () && inOperand2.isValid () && inOperand3.isValid () && inOperand4.isValid ()) {
+    result = GALGAS_gtlTemplateProfileList (capCollectionElementArray ()) ;
+    capCollectionElement attributes ;
+    GALGAS_gtlTemplateProfileList::makeAttributesFromObjects (attributes, inOperand0, inOperand1, inOperand2, inOperand3, inOperand4 COMMA_THERE) ;
+    result.appendObject (attributes) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::makeAttributesFromObjects (capCollectionElement & outAttributes,
+                                                               const GALGAS_string & in_path,
+                                                               const GALGAS_uint & in_calls,
+                                                               const GALGAS_uint & in_inclusiveTime,
+                                                               const GALGAS_uint & in_exclusiveTime,
+                                                               const GALGAS_uint & in_emittedCharacters
+                                                               COMMA_LOCATION_ARGS) {
+  cCollectionElement_gtlTemplateProfileList * p = NULL ;
+  macroMyNew (p, cCollectionElement_gtlTemplateProfileList (in_path,
+                                                            in_calls,
+                                                            in_inclusiveTime,
+                                                            in_exclusiveTime,
+                                                            in_emittedCharacters COMMA_THERE)) ;
+  outAttributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::addAssign_operation (const GALGAS_string & inOperand0,
+                                                         const GALGAS_uint & inOperand1,
+                                                         const GALGAS_uint & inOperand2,
+                                                         const GALGAS_uint & inOperand3,
+                                                         const GALGAS_uint & inOperand4
+                                                         COMMA_LOCATION_ARGS) {
+  if (isValid () && inOperand0.isValid () && inOperand1.isValid () && inOperand2.isValid () && inOperand3.isValid () && inOperand4.isValid ()) {
+    cCollectionElement * p = NULL ;
+    macroMyNew (p, cCollectionElement_gtlTemplateProfileList (inOperand0, inOperand1, inOperand2, inOperand3, inOperand4 COMMA_THERE)) ;
+    capCollectionElement attributes ;
+    attributes.setPointer (p) ;
+    macroDetachSharedObject (p) ;
+    appendObject (attributes) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::setter_insertAtIndex (const GALGAS_string inOperand0,
+                                                          const GALGAS_uint inOperand1,
+                                                          const GALGAS_uint inOperand2,
+                                                          const GALGAS_uint inOperand3,
+                                                          const GALGAS_uint inOperand4,
+                                                          const GALGAS_uint inInsertionIndex,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_LOCATION_ARGS) {
+  if (isValid () && inInsertionIndex.isValid () && inOperand0.isValid () && inOperand1.isValid () && inOperand2.isValid () && inOperand3.isValid () && inOperand4.isValid ()) {
+    cCollectionElement * p = NULL ;
+    macroMyNew (p, cCollectionElement_gtlTemplateProfileList (inOperand0, inOperand1, inOperand2, inOperand3, inOperand4 COMMA_THERE)) ;
+    capCollectionElement attributes ;
+    attributes.setPointer (p) ;
+    macroDetachSharedObject (p) ;
+    insertObjectAtIndex (attributes, inInsertionIndex.uintValue (), inCompiler COMMA_THERE) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::setter_removeAtIndex (GALGAS_string & outOperand0,
+                                                          GALGAS_uint & outOperand1,
+                                                          GALGAS_uint & outOperand2,
+                                                          GALGAS_uint & outOperand3,
+                                                          GALGAS_uint & outOperand4,
+                                                          const GALGAS_uint inRemoveIndex,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_LOCATION_ARGS) {
+  if (isValid () && inRemoveIndex.isValid ()) {
+    capCollectionElement attributes ;
+    removeObjectAtIndex (attributes, inRemoveIndex.uintValue (), inCompiler COMMA_THERE) ;
+    cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+    if (NULL == p) {
+      outOperand0.drop () ;
+      outOperand1.drop () ;
+      outOperand2.drop () ;
+      outOperand3.drop () ;
+      outOperand4.drop () ;
+    }else{
+      macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+      outOperand0 = p->mObject.mProperty_path ;
+      outOperand1 = p->mObject.mProperty_calls ;
+      outOperand2 = p->mObject.mProperty_inclusiveTime ;
+      outOperand3 = p->mObject.mProperty_exclusiveTime ;
+      outOperand4 = p->mObject.mProperty_emittedCharacters ;
+    }
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::setter_popFirst (GALGAS_string & outOperand0,
+                                                     GALGAS_uint & outOperand1,
+                                                     GALGAS_uint & outOperand2,
+                                                     GALGAS_uint & outOperand3,
+                                                     GALGAS_uint & outOperand4,
+                                                     C_Compiler * inCompiler
+                                                     COMMA_LOCATION_ARGS) {
+  capCollectionElement attributes ;
+  removeFirstObject (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+    outOperand2.drop () ;
+    outOperand3.drop () ;
+    outOperand4.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    outOperand0 = p->mObject.mProperty_path ;
+    outOperand1 = p->mObject.mProperty_calls ;
+    outOperand2 = p->mObject.mProperty_inclusiveTime ;
+    outOperand3 = p->mObject.mProperty_exclusiveTime ;
+    outOperand4 = p->mObject.mProperty_emittedCharacters ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::setter_popLast (GALGAS_string & outOperand0,
+                                                    GALGAS_uint & outOperand1,
+                                                    GALGAS_uint & outOperand2,
+                                                    GALGAS_uint & outOperand3,
+                                                    GALGAS_uint & outOperand4,
+                                                    C_Compiler * inCompiler
+                                                    COMMA_LOCATION_ARGS) {
+  capCollectionElement attributes ;
+  removeLastObject (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+    outOperand2.drop () ;
+    outOperand3.drop () ;
+    outOperand4.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    outOperand0 = p->mObject.mProperty_path ;
+    outOperand1 = p->mObject.mProperty_calls ;
+    outOperand2 = p->mObject.mProperty_inclusiveTime ;
+    outOperand3 = p->mObject.mProperty_exclusiveTime ;
+    outOperand4 = p->mObject.mProperty_emittedCharacters ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::method_first (GALGAS_string & outOperand0,
+                                                  GALGAS_uint & outOperand1,
+                                                  GALGAS_uint & outOperand2,
+                                                  GALGAS_uint & outOperand3,
+                                                  GALGAS_uint & outOperand4,
+                                                  C_Compiler * inCompiler
+                                                  COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes ;
+  readFirst (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+    outOperand2.drop () ;
+    outOperand3.drop () ;
+    outOperand4.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    outOperand0 = p->mObject.mProperty_path ;
+    outOperand1 = p->mObject.mProperty_calls ;
+    outOperand2 = p->mObject.mProperty_inclusiveTime ;
+    outOperand3 = p->mObject.mProperty_exclusiveTime ;
+    outOperand4 = p->mObject.mProperty_emittedCharacters ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::method_last (GALGAS_string & outOperand0,
+                                                 GALGAS_uint & outOperand1,
+                                                 GALGAS_uint & outOperand2,
+                                                 GALGAS_uint & outOperand3,
+                                                 GALGAS_uint & outOperand4,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes ;
+  readLast (attributes, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  if (NULL == p) {
+    outOperand0.drop () ;
+    outOperand1.drop () ;
+    outOperand2.drop () ;
+    outOperand3.drop () ;
+    outOperand4.drop () ;
+  }else{
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    outOperand0 = p->mObject.mProperty_path ;
+    outOperand1 = p->mObject.mProperty_calls ;
+    outOperand2 = p->mObject.mProperty_inclusiveTime ;
+    outOperand3 = p->mObject.mProperty_exclusiveTime ;
+    outOperand4 = p->mObject.mProperty_emittedCharacters ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList GALGAS_gtlTemplateProfileList::add_operation (const GALGAS_gtlTemplateProfileList & inOperand,
+                                                                            C_Compiler * /* inCompiler */
+                                                                            COMMA_UNUSED_LOCATION_ARGS) const {
+  GALGAS_gtlTemplateProfileList result ;
+  if (isValid () && inOperand.isValid ()) {
+    result = *this ;
+    result.appendList (inOperand) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList GALGAS_gtlTemplateProfileList::getter_subListWithRange (const GALGAS_range & inRange,
+                                                                                      C_Compiler * inCompiler
+                                                                                      COMMA_LOCATION_ARGS) const {
+  GALGAS_gtlTemplateProfileList result = GALGAS_gtlTemplateProfileList::constructor_emptyList (THERE) ;
+  subListWithRange (result, inRange, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList GALGAS_gtlTemplateProfileList::getter_subListFromIndex (const GALGAS_uint & inIndex,
+                                                                                      C_Compiler * inCompiler
+                                                                                      COMMA_LOCATION_ARGS) const {
+  GALGAS_gtlTemplateProfileList result = GALGAS_gtlTemplateProfileList::constructor_emptyList (THERE) ;
+  subListFromIndex (result, inIndex, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList GALGAS_gtlTemplateProfileList::getter_subListToIndex (const GALGAS_uint & inIndex,
+                                                                                    C_Compiler * inCompiler
+                                                                                    COMMA_LOCATION_ARGS) const {
+  GALGAS_gtlTemplateProfileList result = GALGAS_gtlTemplateProfileList::constructor_emptyList (THERE) ;
+  subListToIndex (result, inIndex, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList::plusAssign_operation (const GALGAS_gtlTemplateProfileList inOperand,
+                                                          C_Compiler * /* inCompiler */
+                                                          COMMA_UNUSED_LOCATION_ARGS) {
+  appendList (inOperand) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string GALGAS_gtlTemplateProfileList::getter_pathAtIndex (const GALGAS_uint & inIndex,
+                                                                 C_Compiler * inCompiler
+                                                                 COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes = readObjectAtIndex (inIndex, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  GALGAS_string result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    result = p->mObject.mProperty_path ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList::getter_callsAtIndex (const GALGAS_uint & inIndex,
+                                                                C_Compiler * inCompiler
+                                                                COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes = readObjectAtIndex (inIndex, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    result = p->mObject.mProperty_calls ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList::getter_inclusiveTimeAtIndex (const GALGAS_uint & inIndex,
+                                                                        C_Compiler * inCompiler
+                                                                        COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes = readObjectAtIndex (inIndex, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    result = p->mObject.mProperty_inclusiveTime ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList::getter_exclusiveTimeAtIndex (const GALGAS_uint & inIndex,
+                                                                        C_Compiler * inCompiler
+                                                                        COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes = readObjectAtIndex (inIndex, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    result = p->mObject.mProperty_exclusiveTime ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList::getter_emittedCharactersAtIndex (const GALGAS_uint & inIndex,
+                                                                            C_Compiler * inCompiler
+                                                                            COMMA_LOCATION_ARGS) const {
+  capCollectionElement attributes = readObjectAtIndex (inIndex, inCompiler COMMA_THERE) ;
+  cCollectionElement_gtlTemplateProfileList * p = (cCollectionElement_gtlTemplateProfileList *) attributes.ptr () ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+    result = p->mObject.mProperty_emittedCharacters ;
+  }
+  return result ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cEnumerator_gtlTemplateProfileList::cEnumerator_gtlTemplateProfileList (const GALGAS_gtlTemplateProfileList & inEnumeratedObject,
+                                                                        const typeEnumerationOrder inOrder) :
+cGenericAbstractEnumerator (inOrder) {
+  inEnumeratedObject.populateEnumerationArray (mEnumerationArray) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList_2D_element cEnumerator_gtlTemplateProfileList::current (LOCATION_ARGS) const {
+  const cCollectionElement_gtlTemplateProfileList * p = (const cCollectionElement_gtlTemplateProfileList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+  return p->mObject ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string cEnumerator_gtlTemplateProfileList::current_path (LOCATION_ARGS) const {
+  const cCollectionElement_gtlTemplateProfileList * p = (const cCollectionElement_gtlTemplateProfileList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+  return p->mObject.mProperty_path ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileList::current_calls (LOCATION_ARGS) const {
+  const cCollectionElement_gtlTemplateProfileList * p = (const cCollectionElement_gtlTemplateProfileList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+  return p->mObject.mProperty_calls ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileList::current_inclusiveTime (LOCATION_ARGS) const {
+  const cCollectionElement_gtlTemplateProfileList * p = (const cCollectionElement_gtlTemplateProfileList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+  return p->mObject.mProperty_inclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileList::current_exclusiveTime (LOCATION_ARGS) const {
+  const cCollectionElement_gtlTemplateProfileList * p = (const cCollectionElement_gtlTemplateProfileList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+  return p->mObject.mProperty_exclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint cEnumerator_gtlTemplateProfileList::current_emittedCharacters (LOCATION_ARGS) const {
+  const cCollectionElement_gtlTemplateProfileList * p = (const cCollectionElement_gtlTemplateProfileList *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cCollectionElement_gtlTemplateProfileList) ;
+  return p->mObject.mProperty_emittedCharacters ;
+}
+
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                            @gtlTemplateProfileList type                                             *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlTemplateProfileList ("gtlTemplateProfileList",
+                                               NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlTemplateProfileList::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlTemplateProfileList ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlTemplateProfileList::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlTemplateProfileList (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList GALGAS_gtlTemplateProfileList::extractObject (const GALGAS_object & inObject,
+                                                                            C_Compiler * inCompiler
+                                                                            COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileList result ;
+  const GALGAS_gtlTemplateProfileList * p = (const GALGAS_gtlTemplateProfileList *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlTemplateProfileList *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlTemplateProfileList", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement_gtlTemplatePathMap::cMapElement_gtlTemplatePathMap (const GALGAS_lstring & inKey,
+                                                                const GALGAS_string & in_fullPath
+                                                                COMMA_LOCATION_ARGS) :
+cMapElement (inKey COMMA_THERE),
+mProperty_fullPath (in_fullPath) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool cMapElement_gtlTemplatePathMap::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_fullPath.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement * cMapElement_gtlTemplatePathMap::copy (void) {
+  cMapElement * result = NULL ;
+  macroMyNew (result, cMapElement_gtlTemplatePathMap (mProperty_lkey, mProperty_fullPath COMMA_HERE)) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void cMapElement_gtlTemplatePathMap::description (C_String & ioString, const int32_t inIndentation) const {
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "fullPath" ":" ;
+  mProperty_fullPath.description (ioString, inIndentation) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult cMapElement_gtlTemplatePathMap::compare (const cCollectionElement * inOperand) const {
+  cMapElement_gtlTemplatePathMap * operand = (cMapElement_gtlTemplatePathMap *) inOperand ;
+  typeComparisonResult result = mProperty_lkey.objectCompare (operand->mProperty_lkey) ;
+  if (kOperandEqual == result) {
+    result = mProperty_fullPath.objectCompare (operand->mProperty_fullPath) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap::GALGAS_gtlTemplatePathMap (void) :
+AC_GALGAS_map () {
 }
+
 //---------------------------------------------------------------------------------------------------------------------*
 
-static void defineExtensionMethod_gtlTemplate_execute (void) {
-  enterExtensionMethod_execute (kTypeDescriptor_GALGAS_gtlTemplate.mSlotID,
-                                extensionMethod_gtlTemplate_execute) ;
+GALGAS_gtlTemplatePathMap::GALGAS_gtlTemplatePathMap (const GALGAS_gtlTemplatePathMap & inSource) :
+AC_GALGAS_map (inSource) {
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-static void freeExtensionMethod_gtlTemplate_execute (void) {
-  gExtensionMethodTable_gtlTemplate_execute.free () ;
+GALGAS_gtlTemplatePathMap & GALGAS_gtlTemplatePathMap::operator = (const GALGAS_gtlTemplatePathMap & inSource) {
+  * ((AC_GALGAS_map *) this) = inSource ;
+  return * this ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-C_PrologueEpilogue gMethod_gtlTemplate_execute (defineExtensionMethod_gtlTemplate_execute,
-                                                freeExtensionMethod_gtlTemplate_execute) ;
+GALGAS_gtlTemplatePathMap GALGAS_gtlTemplatePathMap::constructor_emptyMap (LOCATION_ARGS) {
+  GALGAS_gtlTemplatePathMap result ;
+  result.makeNewEmptyMap (THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap GALGAS_gtlTemplatePathMap::constructor_mapWithMapToOverride (const GALGAS_gtlTemplatePathMap & inMapToOverride
+                                                                                       COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplatePathMap result ;
+  result.makeNewEmptyMapWithMapToOverride (inMapToOverride COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap GALGAS_gtlTemplatePathMap::getter_overriddenMap (C_Compiler * inCompiler
+                                                                           COMMA_LOCATION_ARGS) const {
+  GALGAS_gtlTemplatePathMap result ;
+  getOverridenMap (result, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplatePathMap::addAssign_operation (const GALGAS_lstring & inKey,
+                                                     const GALGAS_string & inArgument0,
+                                                     C_Compiler * inCompiler
+                                                     COMMA_LOCATION_ARGS) {
+  cMapElement_gtlTemplatePathMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlTemplatePathMap (inKey, inArgument0 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "@gtlTemplatePathMap insert error: '%K' already in map" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplatePathMap::setter_put (GALGAS_lstring inKey,
+                                            GALGAS_string inArgument0,
+                                            C_Compiler * inCompiler
+                                            COMMA_LOCATION_ARGS) {
+  cMapElement_gtlTemplatePathMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlTemplatePathMap (inKey, inArgument0 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "the template '%K' is already searched" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const char * kSearchErrorMessage_gtlTemplatePathMap_get = "the template '%K' has not been searched" ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplatePathMap::method_get (GALGAS_lstring inKey,
+                                            GALGAS_string & outArgument0,
+                                            C_Compiler * inCompiler
+                                            COMMA_LOCATION_ARGS) const {
+  const cMapElement_gtlTemplatePathMap * p = (const cMapElement_gtlTemplatePathMap *) performSearch (inKey,
+                                                                                                     inCompiler,
+                                                                                                     kSearchErrorMessage_gtlTemplatePathMap_get
+                                                                                                     COMMA_THERE) ;
+  if (NULL == p) {
+    outArgument0.drop () ;
+  }else{
+    macroValidSharedObject (p, cMapElement_gtlTemplatePathMap) ;
+    outArgument0 = p->mProperty_fullPath ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string GALGAS_gtlTemplatePathMap::getter_fullPathForKey (const GALGAS_string & inKey,
+                                                                C_Compiler * inCompiler
+                                                                COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlTemplatePathMap * p = (const cMapElement_gtlTemplatePathMap *) attributes ;
+  GALGAS_string result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplatePathMap) ;
+    result = p->mProperty_fullPath ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplatePathMap::setter_setFullPathForKey (GALGAS_string inAttributeValue,
+                                                          GALGAS_string inKey,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlTemplatePathMap * p = (cMapElement_gtlTemplatePathMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlTemplatePathMap) ;
+    p->mProperty_fullPath = inAttributeValue ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cMapElement_gtlTemplatePathMap * GALGAS_gtlTemplatePathMap::readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                               const GALGAS_string & inKey
+                                                                                               COMMA_LOCATION_ARGS) {
+  cMapElement_gtlTemplatePathMap * result = (cMapElement_gtlTemplatePathMap *) searchForReadWriteAttribute (inKey, false, inCompiler COMMA_THERE) ;
+  macroNullOrValidSharedObject (result, cMapElement_gtlTemplatePathMap) ;
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+cEnumerator_gtlTemplatePathMap::cEnumerator_gtlTemplatePathMap (const GALGAS_gtlTemplatePathMap & inEnumeratedObject,
+                                                                const typeEnumerationOrder inOrder) :
+cGenericAbstractEnumerator (inOrder) {
+  inEnumeratedObject.populateEnumerationArray (mEnumerationArray) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap_2D_element cEnumerator_gtlTemplatePathMap::current (LOCATION_ARGS) const {
+  const cMapElement_gtlTemplatePathMap * p = (const cMapElement_gtlTemplatePathMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlTemplatePathMap) ;
+  return GALGAS_gtlTemplatePathMap_2D_element (p->mProperty_lkey, p->mProperty_fullPath) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_lstring cEnumerator_gtlTemplatePathMap::current_lkey (LOCATION_ARGS) const {
+  const cMapElement * p = (const cMapElement *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement) ;
+  return p->mProperty_lkey ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string cEnumerator_gtlTemplatePathMap::current_fullPath (LOCATION_ARGS) const {
+  const cMapElement_gtlTemplatePathMap * p = (const cMapElement_gtlTemplatePathMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlTemplatePathMap) ;
+  return p->mProperty_fullPath ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                              @gtlTemplatePathMap type                                               *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlTemplatePathMap ("gtlTemplatePathMap",
+                                           NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlTemplatePathMap::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlTemplatePathMap ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlTemplatePathMap::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlTemplatePathMap (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap GALGAS_gtlTemplatePathMap::extractObject (const GALGAS_object & inObject,
+                                                                    C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplatePathMap result ;
+  const GALGAS_gtlTemplatePathMap * p = (const GALGAS_gtlTemplatePathMap *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlTemplatePathMap *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlTemplatePathMap", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
 
 //---------------------------------------------------------------------------------------------------------------------*
 //   Object comparison                                                                                                 *
@@ -4936,6 +6443,27 @@ typeComparisonResult cPtr_library::dynamicObjectCompare (const acPtr_class * inO
   if (kOperandEqual == result) {
     result = mProperty_doneImports.objectCompare (p->mProperty_doneImports) ;
   }
+  if (kOperandEqual == result) {
+    result = mProperty_templatePaths.objectCompare (p->mProperty_templatePaths) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_missingTemplates.objectCompare (p->mProperty_missingTemplates) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_profileTimer.objectCompare (p->mProperty_profileTimer) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_profileChildTime.objectCompare (p->mProperty_profileChildTime) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_profileStack.objectCompare (p->mProperty_profileStack) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_templateProfiles.objectCompare (p->mProperty_templateProfiles) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_foldedStacks.objectCompare (p->mProperty_foldedStacks) ;
+  }
   return result ;
 }
 
@@ -4966,17 +6494,6 @@ AC_GALGAS_class (false) {
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-GALGAS_library GALGAS_library::constructor_default (LOCATION_ARGS) {
-  return GALGAS_library::constructor_new (GALGAS_gtlFuncMap::constructor_emptyMap (HERE),
-                                          GALGAS_gtlGetterMap::constructor_emptyMap (HERE),
-                                          GALGAS_gtlSetterMap::constructor_emptyMap (HERE),
-                                          GALGAS_gtlTemplateMap::constructor_emptyMap (HERE),
-                                          GALGAS_stringset::constructor_emptySet (HERE)
-                                          COMMA_THERE) ;
-}
-
-//---------------------------------------------------------------------------------------------------------------------*
-
 GALGAS_library::GALGAS_library (const cPtr_library * inSourcePtr) :
 AC_GALGAS_class (inSourcePtr, false) {
   macroNullOrValidSharedObject (inSourcePtr, cPtr_library) ;
@@ -4988,11 +6505,18 @@ GALGAS_library GALGAS_library::constructor_new (const GALGAS_gtlFuncMap & inAttr
                                                 const GALGAS_gtlGetterMap & inAttribute_getterMap,
                                                 const GALGAS_gtlSetterMap & inAttribute_setterMap,
                                                 const GALGAS_gtlTemplateMap & inAttribute_templateMap,
-                                                const GALGAS_stringset & inAttribute_doneImports
+                                                const GALGAS_stringset & inAttribute_doneImports,
+                                                const GALGAS_gtlTemplatePathMap & inAttribute_templatePaths,
+                                                const GALGAS_stringset & inAttribute_missingTemplates,
+                                                const GALGAS_timer & inAttribute_profileTimer,
+                                                const GALGAS_uint & inAttribute_profileChildTime,
+                                                const GALGAS_string & inAttribute_profileStack,
+                                                const GALGAS_gtlTemplateProfileMap & inAttribute_templateProfiles,
+                                                const GALGAS_gtlFoldedStackMap & inAttribute_foldedStacks
                                                 COMMA_LOCATION_ARGS) {
   GALGAS_library result ;
-  if (inAttribute_funcMap.isValid () && inAttribute_getterMap.isValid () && inAttribute_setterMap.isValid () && inAttribute_templateMap.isValid () && inAttribute_doneImports.isValid ()) {
-    macroMyNew (result.mObjectPtr, cPtr_library (inAttribute_funcMap, inAttribute_getterMap, inAttribute_setterMap, inAttribute_templateMap, inAttribute_doneImports COMMA_THERE)) ;
+  if (inAttribute_funcMap.isValid () && inAttribute_getterMap.isValid () && inAttribute_setterMap.isValid () && inAttribute_templateMap.isValid () && inAttribute_doneImports.isValid () && inAttribute_templatePaths.isValid () && inAttribute_missingTemplates.isValid () && inAttribute_profileTimer.isValid () && inAttribute_profileChildTime.isValid () && inAttribute_profileStack.isValid () && inAttribute_templateProfiles.isValid () && inAttribute_foldedStacks.isValid ()) {
+    macroMyNew (result.mObjectPtr, cPtr_library (inAttribute_funcMap, inAttribute_getterMap, inAttribute_setterMap, inAttribute_templateMap, inAttribute_doneImports, inAttribute_templatePaths, inAttribute_missingTemplates, inAttribute_profileTimer, inAttribute_profileChildTime, inAttribute_profileStack, inAttribute_templateProfiles, inAttribute_foldedStacks COMMA_THERE)) ;
   }
   return result ;
 }
@@ -5040,51 +6564,163 @@ GALGAS_gtlSetterMap GALGAS_library::getter_setterMap (UNUSED_LOCATION_ARGS) cons
   if (NULL != mObjectPtr) {
     const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
     macroValidSharedObject (p, cPtr_library) ;
-    result = p->mProperty_setterMap ;
+    result = p->mProperty_setterMap ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlSetterMap cPtr_library::getter_setterMap (UNUSED_LOCATION_ARGS) const {
+  return mProperty_setterMap ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateMap GALGAS_library::getter_templateMap (UNUSED_LOCATION_ARGS) const {
+  GALGAS_gtlTemplateMap result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_templateMap ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateMap cPtr_library::getter_templateMap (UNUSED_LOCATION_ARGS) const {
+  return mProperty_templateMap ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_stringset GALGAS_library::getter_doneImports (UNUSED_LOCATION_ARGS) const {
+  GALGAS_stringset result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_doneImports ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_stringset cPtr_library::getter_doneImports (UNUSED_LOCATION_ARGS) const {
+  return mProperty_doneImports ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_gtlTemplatePathMap GALGAS_library::getter_templatePaths (UNUSED_LOCATION_ARGS) const {
+  GALGAS_gtlTemplatePathMap result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_templatePaths ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_gtlTemplatePathMap cPtr_library::getter_templatePaths (UNUSED_LOCATION_ARGS) const {
+  return mProperty_templatePaths ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_stringset GALGAS_library::getter_missingTemplates (UNUSED_LOCATION_ARGS) const {
+  GALGAS_stringset result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_missingTemplates ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_stringset cPtr_library::getter_missingTemplates (UNUSED_LOCATION_ARGS) const {
+  return mProperty_missingTemplates ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_timer GALGAS_library::getter_profileTimer (UNUSED_LOCATION_ARGS) const {
+  GALGAS_timer result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_profileTimer ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_timer cPtr_library::getter_profileTimer (UNUSED_LOCATION_ARGS) const {
+  return mProperty_profileTimer ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_uint GALGAS_library::getter_profileChildTime (UNUSED_LOCATION_ARGS) const {
+  GALGAS_uint result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_profileChildTime ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_uint cPtr_library::getter_profileChildTime (UNUSED_LOCATION_ARGS) const {
+  return mProperty_profileChildTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+GALGAS_string GALGAS_library::getter_profileStack (UNUSED_LOCATION_ARGS) const {
+  GALGAS_string result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_profileStack ;
   }
   return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
-
-GALGAS_gtlSetterMap cPtr_library::getter_setterMap (UNUSED_LOCATION_ARGS) const {
-  return mProperty_setterMap ;
+GALGAS_string cPtr_library::getter_profileStack (UNUSED_LOCATION_ARGS) const {
+  return mProperty_profileStack ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
-
-GALGAS_gtlTemplateMap GALGAS_library::getter_templateMap (UNUSED_LOCATION_ARGS) const {
-  GALGAS_gtlTemplateMap result ;
+GALGAS_gtlTemplateProfileMap GALGAS_library::getter_templateProfiles (UNUSED_LOCATION_ARGS) const {
+  GALGAS_gtlTemplateProfileMap result ;
   if (NULL != mObjectPtr) {
     const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
     macroValidSharedObject (p, cPtr_library) ;
-    result = p->mProperty_templateMap ;
+    result = p->mProperty_templateProfiles ;
   }
   return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
-
-GALGAS_gtlTemplateMap cPtr_library::getter_templateMap (UNUSED_LOCATION_ARGS) const {
-  return mProperty_templateMap ;
+GALGAS_gtlTemplateProfileMap cPtr_library::getter_templateProfiles (UNUSED_LOCATION_ARGS) const {
+  return mProperty_templateProfiles ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
-
-GALGAS_stringset GALGAS_library::getter_doneImports (UNUSED_LOCATION_ARGS) const {
-  GALGAS_stringset result ;
+GALGAS_gtlFoldedStackMap GALGAS_library::getter_foldedStacks (UNUSED_LOCATION_ARGS) const {
+  GALGAS_gtlFoldedStackMap result ;
   if (NULL != mObjectPtr) {
     const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
     macroValidSharedObject (p, cPtr_library) ;
-    result = p->mProperty_doneImports ;
+    result = p->mProperty_foldedStacks ;
   }
   return result ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
-
-GALGAS_stringset cPtr_library::getter_doneImports (UNUSED_LOCATION_ARGS) const {
-  return mProperty_doneImports ;
+GALGAS_gtlFoldedStackMap cPtr_library::getter_foldedStacks (UNUSED_LOCATION_ARGS) const {
+  return mProperty_foldedStacks ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5095,14 +6731,28 @@ cPtr_library::cPtr_library (const GALGAS_gtlFuncMap & in_funcMap,
                             const GALGAS_gtlGetterMap & in_getterMap,
                             const GALGAS_gtlSetterMap & in_setterMap,
                             const GALGAS_gtlTemplateMap & in_templateMap,
-                            const GALGAS_stringset & in_doneImports
+                            const GALGAS_stringset & in_doneImports,
+                            const GALGAS_gtlTemplatePathMap & in_templatePaths,
+                            const GALGAS_stringset & in_missingTemplates,
+                            const GALGAS_timer & in_profileTimer,
+                            const GALGAS_uint & in_profileChildTime,
+                            const GALGAS_string & in_profileStack,
+                            const GALGAS_gtlTemplateProfileMap & in_templateProfiles,
+                            const GALGAS_gtlFoldedStackMap & in_foldedStacks
                             COMMA_LOCATION_ARGS) :
 acPtr_class (THERE),
 mProperty_funcMap (in_funcMap),
 mProperty_getterMap (in_getterMap),
 mProperty_setterMap (in_setterMap),
 mProperty_templateMap (in_templateMap),
-mProperty_doneImports (in_doneImports) {
+mProperty_doneImports (in_doneImports),
+mProperty_templatePaths (in_templatePaths),
+mProperty_missingTemplates (in_missingTemplates),
+mProperty_profileTimer (in_profileTimer),
+mProperty_profileChildTime (in_profileChildTime),
+mProperty_profileStack (in_profileStack),
+mProperty_templateProfiles (in_templateProfiles),
+mProperty_foldedStacks (in_foldedStacks) {
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5123,6 +6773,20 @@ void cPtr_library::description (C_String & ioString,
   mProperty_templateMap.description (ioString, inIndentation+1) ;
   ioString << ", " ;
   mProperty_doneImports.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_templatePaths.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_missingTemplates.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_profileTimer.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_profileChildTime.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_profileStack.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_templateProfiles.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_foldedStacks.description (ioString, inIndentation+1) ;
   ioString << "]" ;
 }
 
@@ -5130,7 +6794,7 @@ void cPtr_library::description (C_String & ioString,
 
 acPtr_class * cPtr_library::duplicate (LOCATION_ARGS) const {
   acPtr_class * ptr = NULL ;
-  macroMyNew (ptr, cPtr_library (mProperty_funcMap, mProperty_getterMap, mProperty_setterMap, mProperty_templateMap, mProperty_doneImports COMMA_THERE)) ;
+  macroMyNew (ptr, cPtr_library (mProperty_funcMap, mProperty_getterMap, mProperty_setterMap, mProperty_templateMap, mProperty_doneImports, mProperty_templatePaths, mProperty_missingTemplates, mProperty_profileTimer, mProperty_profileChildTime, mProperty_profileStack, mProperty_templateProfiles, mProperty_foldedStacks COMMA_THERE)) ;
   return ptr ;
 }
 
@@ -5178,6 +6842,431 @@ GALGAS_library GALGAS_library::extractObject (const GALGAS_object & inObject,
   return result ;
 }
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                  Extension setter '@library enterTemplateProfile'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <extensionSetterSignature_library_enterTemplateProfile> gExtensionModifierTable_library_enterTemplateProfile ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionSetter_enterTemplateProfile (const int32_t inClassIndex,
+                                                extensionSetterSignature_library_enterTemplateProfile inModifier) {
+  gExtensionModifierTable_library_enterTemplateProfile.forceObjectAtIndex (inClassIndex, inModifier, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionSetter_enterTemplateProfile (cPtr_library * inObject,
+                                               const GALGAS_string constin_path,
+                                               GALGAS_uint & out_startTime,
+                                               GALGAS_uint & out_savedChildTime,
+                                               GALGAS_string & out_savedStack,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) {
+//--- Drop output arguments
+  out_startTime.drop () ;
+  out_savedChildTime.drop () ;
+  out_savedStack.drop () ;
+//--- Find setter
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionSetterSignature_library_enterTemplateProfile f = NULL ;
+    if (classIndex < gExtensionModifierTable_library_enterTemplateProfile.count ()) {
+      f = gExtensionModifierTable_library_enterTemplateProfile (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionModifierTable_library_enterTemplateProfile.count ()) {
+           f = gExtensionModifierTable_library_enterTemplateProfile (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionModifierTable_library_enterTemplateProfile.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    f (inObject, constin_path, out_startTime, out_savedChildTime, out_savedStack, inCompiler COMMA_THERE) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void extensionSetter_library_enterTemplateProfile (cPtr_library * inObject,
+                                                          const GALGAS_string constinArgument_path,
+                                                          GALGAS_uint & outArgument_startTime,
+                                                          GALGAS_uint & outArgument_savedChildTime,
+                                                          GALGAS_string & outArgument_savedStack,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_UNUSED_LOCATION_ARGS) {
+  cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  outArgument_startTime = object->mProperty_profileTimer.getter_msFromStart (SOURCE_FILE ("gtl_types.galgas", 418)) ;
+  outArgument_savedChildTime = object->mProperty_profileChildTime ;
+  outArgument_savedStack = object->mProperty_profileStack ;
+  object->mProperty_profileChildTime = GALGAS_uint ((uint32_t) 0U) ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, object->mProperty_profileStack.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    object->mProperty_profileStack = constinArgument_path ;
+  }else if (kBoolFalse == test_0) {
+    object->mProperty_profileStack.plusAssign_operation(GALGAS_string (";").add_operation (constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 423)), inCompiler  COMMA_SOURCE_FILE ("gtl_types.galgas", 423)) ;
+  }
+}
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionSetter_library_enterTemplateProfile (void) {
+  enterExtensionSetter_enterTemplateProfile (kTypeDescriptor_GALGAS_library.mSlotID,
+                                             extensionSetter_library_enterTemplateProfile) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionModifier_library_enterTemplateProfile (void) {
+  gExtensionModifierTable_library_enterTemplateProfile.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gSetter_library_enterTemplateProfile (defineExtensionSetter_library_enterTemplateProfile,
+                                                         freeExtensionModifier_library_enterTemplateProfile) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                   Extension setter '@library exitTemplateProfile'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <extensionSetterSignature_library_exitTemplateProfile> gExtensionModifierTable_library_exitTemplateProfile ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionSetter_exitTemplateProfile (const int32_t inClassIndex,
+                                               extensionSetterSignature_library_exitTemplateProfile inModifier) {
+  gExtensionModifierTable_library_exitTemplateProfile.forceObjectAtIndex (inClassIndex, inModifier, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionSetter_exitTemplateProfile (cPtr_library * inObject,
+                                              const GALGAS_string constin_path,
+                                              const GALGAS_uint constin_startTime,
+                                              const GALGAS_uint constin_savedChildTime,
+                                              const GALGAS_string constin_savedStack,
+                                              const GALGAS_uint constin_emittedCharacters,
+                                              C_Compiler * inCompiler
+                                              COMMA_LOCATION_ARGS) {
+//--- Drop output arguments
+//--- Find setter
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionSetterSignature_library_exitTemplateProfile f = NULL ;
+    if (classIndex < gExtensionModifierTable_library_exitTemplateProfile.count ()) {
+      f = gExtensionModifierTable_library_exitTemplateProfile (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionModifierTable_library_exitTemplateProfile.count ()) {
+           f = gExtensionModifierTable_library_exitTemplateProfile (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionModifierTable_library_exitTemplateProfile.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    f (inObject, constin_path, constin_startTime, constin_savedChildTime, constin_savedStack, constin_emittedCharacters, inCompiler COMMA_THERE) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void extensionSetter_library_exitTemplateProfile (cPtr_library * inObject,
+                                                         const GALGAS_string constinArgument_path,
+                                                         const GALGAS_uint constinArgument_startTime,
+                                                         const GALGAS_uint constinArgument_savedChildTime,
+                                                         const GALGAS_string constinArgument_savedStack,
+                                                         const GALGAS_uint constinArgument_emittedCharacters,
+                                                         C_Compiler * inCompiler
+                                                         COMMA_UNUSED_LOCATION_ARGS) {
+  cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  GALGAS_uint var_inclusiveTime_12596 = object->mProperty_profileTimer.getter_msFromStart (SOURCE_FILE ("gtl_types.galgas", 434)).substract_operation (constinArgument_startTime, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 434)) ;
+  GALGAS_uint var_exclusiveTime_12659 = GALGAS_uint ((uint32_t) 0U) ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsStrictSup, var_inclusiveTime_12596.objectCompare (object->mProperty_profileChildTime)).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    var_exclusiveTime_12659 = var_inclusiveTime_12596.substract_operation (object->mProperty_profileChildTime, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 437)) ;
+  }
+  GALGAS_uint var_addedInclusiveTime_12906 = var_inclusiveTime_12596 ;
+  GALGAS_uint var_addedCharacters_12946 = constinArgument_emittedCharacters ;
+  GALGAS_string var_callers_12988 = GALGAS_string (";").add_operation (constinArgument_savedStack, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 443)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 443)) ;
+  const enumGalgasBool test_1 = GALGAS_bool (kIsStrictSup, var_callers_12988.getter_componentsSeparatedByString (GALGAS_string (";").add_operation (constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 444)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 444)) COMMA_SOURCE_FILE ("gtl_types.galgas", 444)).getter_length (SOURCE_FILE ("gtl_types.galgas", 444)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
+  if (kBoolTrue == test_1) {
+    var_addedInclusiveTime_12906 = GALGAS_uint ((uint32_t) 0U) ;
+    var_addedCharacters_12946 = GALGAS_uint ((uint32_t) 0U) ;
+  }
+  const enumGalgasBool test_2 = object->mProperty_templateProfiles.getter_hasKey (constinArgument_path COMMA_SOURCE_FILE ("gtl_types.galgas", 448)).boolEnum () ;
+  if (kBoolTrue == test_2) {
+    GALGAS_uint var_calls_13246 ;
+    GALGAS_uint var_inclusive_13263 ;
+    GALGAS_uint var_exclusive_13280 ;
+    GALGAS_uint var_characters_13298 ;
+    object->mProperty_templateProfiles.method_get (function_lstring (constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 449)), var_calls_13246, var_inclusive_13263, var_exclusive_13280, var_characters_13298, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 449)) ;
+    {
+    object->mProperty_templateProfiles.setter_setCallsForKey (var_calls_13246.add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 450)), constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 450)) ;
+    }
+    {
+    object->mProperty_templateProfiles.setter_setInclusiveTimeForKey (var_inclusive_13263.add_operation (var_addedInclusiveTime_12906, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 451)), constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 451)) ;
+    }
+    {
+    object->mProperty_templateProfiles.setter_setExclusiveTimeForKey (var_exclusive_13280.add_operation (var_exclusiveTime_12659, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 452)), constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 452)) ;
+    }
+    {
+    object->mProperty_templateProfiles.setter_setEmittedCharactersForKey (var_characters_13298.add_operation (var_addedCharacters_12946, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 453)), constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 453)) ;
+    }
+  }else if (kBoolFalse == test_2) {
+    {
+    object->mProperty_templateProfiles.setter_put (function_lstring (constinArgument_path, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 455)), GALGAS_uint ((uint32_t) 1U), var_addedInclusiveTime_12906, var_exclusiveTime_12659, var_addedCharacters_12946, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 455)) ;
+    }
+  }
+  const enumGalgasBool test_3 = object->mProperty_foldedStacks.getter_hasKey (object->mProperty_profileStack COMMA_SOURCE_FILE ("gtl_types.galgas", 457)).boolEnum () ;
+  if (kBoolTrue == test_3) {
+    GALGAS_uint var_time_13828 ;
+    object->mProperty_foldedStacks.method_get (function_lstring (object->mProperty_profileStack, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 458)), var_time_13828, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 458)) ;
+    {
+    object->mProperty_foldedStacks.setter_setTimeForKey (var_time_13828.add_operation (var_exclusiveTime_12659, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 459)), object->mProperty_profileStack, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 459)) ;
+    }
+  }else if (kBoolFalse == test_3) {
+    {
+    object->mProperty_foldedStacks.setter_put (function_lstring (object->mProperty_profileStack, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 461)), var_exclusiveTime_12659, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 461)) ;
+    }
+  }
+  object->mProperty_profileStack = constinArgument_savedStack ;
+  object->mProperty_profileChildTime = constinArgument_savedChildTime.add_operation (var_inclusiveTime_12596, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 464)) ;
+}
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionSetter_library_exitTemplateProfile (void) {
+  enterExtensionSetter_exitTemplateProfile (kTypeDescriptor_GALGAS_library.mSlotID,
+                                            extensionSetter_library_exitTemplateProfile) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionModifier_library_exitTemplateProfile (void) {
+  gExtensionModifierTable_library_exitTemplateProfile.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gSetter_library_exitTemplateProfile (defineExtensionSetter_library_exitTemplateProfile,
+                                                        freeExtensionModifier_library_exitTemplateProfile) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                 Extension getter '@library sortedTemplateProfiles'                                  *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <enterExtensionGetter_library_sortedTemplateProfiles> gExtensionGetterTable_library_sortedTemplateProfiles ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_sortedTemplateProfiles (const int32_t inClassIndex,
+                                                  enterExtensionGetter_library_sortedTemplateProfiles inGetter) {
+  gExtensionGetterTable_library_sortedTemplateProfiles.forceObjectAtIndex (inClassIndex, inGetter, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList callExtensionGetter_sortedTemplateProfiles (const cPtr_library * inObject,
+                                                                          C_Compiler * inCompiler
+                                                                          COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileList result ;
+//--- Find Reader
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    enterExtensionGetter_library_sortedTemplateProfiles f = NULL ;
+    if (classIndex < gExtensionGetterTable_library_sortedTemplateProfiles.count ()) {
+      f = gExtensionGetterTable_library_sortedTemplateProfiles (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionGetterTable_library_sortedTemplateProfiles.count ()) {
+           f = gExtensionGetterTable_library_sortedTemplateProfiles (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionGetterTable_library_sortedTemplateProfiles.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    if (NULL == f) {
+      fatalError ("FATAL CATEGORY READER CALL ERROR", __FILE__, __LINE__) ;
+    }else{
+      result = f (inObject, inCompiler COMMA_THERE) ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_gtlTemplateProfileList extensionGetter_library_sortedTemplateProfiles (const cPtr_library * inObject,
+                                                                                     C_Compiler * inCompiler
+                                                                                     COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileList result_sortedProfiles ; // Returned variable
+  const cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  result_sortedProfiles = GALGAS_gtlTemplateProfileList::constructor_emptyList (SOURCE_FILE ("gtl_types.galgas", 475)) ;
+  cEnumerator_gtlTemplateProfileMap enumerator_14532 (object->mProperty_templateProfiles, kENUMERATION_UP) ;
+  while (enumerator_14532.hasCurrentObject ()) {
+    GALGAS_uint var_index_14551 = GALGAS_uint ((uint32_t) 0U) ;
+    if (result_sortedProfiles.getter_length (SOURCE_FILE ("gtl_types.galgas", 478)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 478)).isValid ()) {
+      uint32_t variant_14564 = result_sortedProfiles.getter_length (SOURCE_FILE ("gtl_types.galgas", 478)).add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 478)).uintValue () ;
+      bool loop_14564 = true ;
+      while (loop_14564) {
+        GALGAS_bool test_0 = GALGAS_bool (kIsStrictInf, var_index_14551.objectCompare (result_sortedProfiles.getter_length (SOURCE_FILE ("gtl_types.galgas", 479)))) ;
+        if (kBoolTrue == test_0.boolEnum ()) {
+          test_0 = GALGAS_bool (kIsSupOrEqual, result_sortedProfiles.getter_exclusiveTimeAtIndex (var_index_14551, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 480)).objectCompare (enumerator_14532.current_exclusiveTime (HERE))) ;
+        }
+        loop_14564 = test_0.isValid () ;
+        if (loop_14564) {
+          loop_14564 = test_0.boolValue () ;
+        }
+        if (loop_14564 && (0 == variant_14564)) {
+          loop_14564 = false ;
+          inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_types.galgas", 478)) ;
+        }
+        if (loop_14564) {
+          variant_14564 -- ;
+          var_index_14551.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_types.galgas", 481)) ;
+        }
+      }
+    }
+    {
+    result_sortedProfiles.setter_insertAtIndex (enumerator_14532.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 484)), enumerator_14532.current_calls (HERE), enumerator_14532.current_inclusiveTime (HERE), enumerator_14532.current_exclusiveTime (HERE), enumerator_14532.current_emittedCharacters (HERE), var_index_14551, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 483)) ;
+    }
+    enumerator_14532.gotoNextObject () ;
+  }
+//---
+  return result_sortedProfiles ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_library_sortedTemplateProfiles (void) {
+  enterExtensionGetter_sortedTemplateProfiles (kTypeDescriptor_GALGAS_library.mSlotID,
+                                               extensionGetter_library_sortedTemplateProfiles) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionGetter_library_sortedTemplateProfiles (void) {
+  gExtensionGetterTable_library_sortedTemplateProfiles.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_library_sortedTemplateProfiles (defineExtensionGetter_library_sortedTemplateProfiles,
+                                                           freeExtensionGetter_library_sortedTemplateProfiles) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                  Extension method '@library writeTemplateProfile'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <extensionMethodSignature_library_writeTemplateProfile> gExtensionMethodTable_library_writeTemplateProfile ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionMethod_writeTemplateProfile (const int32_t inClassIndex,
+                                                extensionMethodSignature_library_writeTemplateProfile inMethod) {
+  gExtensionMethodTable_library_writeTemplateProfile.forceObjectAtIndex (inClassIndex, inMethod, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionMethod_writeTemplateProfile (const cPtr_library * inObject,
+                                               const GALGAS_string constin_reportFileName,
+                                               const GALGAS_string constin_foldedStackFileName,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) {
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionMethodSignature_library_writeTemplateProfile f = NULL ;
+    if (classIndex < gExtensionMethodTable_library_writeTemplateProfile.count ()) {
+      f = gExtensionMethodTable_library_writeTemplateProfile (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionMethodTable_library_writeTemplateProfile.count ()) {
+           f = gExtensionMethodTable_library_writeTemplateProfile (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionMethodTable_library_writeTemplateProfile.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    if (NULL == f) {
+      fatalError ("FATAL CATEGORY METHOD CALL ERROR", __FILE__, __LINE__) ;
+    }else{
+      f (inObject, constin_reportFileName, constin_foldedStackFileName, inCompiler COMMA_THERE) ;
+    }
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void extensionMethod_library_writeTemplateProfile (const cPtr_library * inObject,
+                                                          const GALGAS_string constinArgument_reportFileName,
+                                                          const GALGAS_string constinArgument_foldedStackFileName,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_UNUSED_LOCATION_ARGS) {
+  const cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  GALGAS_string var_report_14989 = GALGAS_string ("exclusive (ms)  inclusive (ms)     calls  characters  template\n") ;
+  const GALGAS_library temp_0 = object ;
+  cEnumerator_gtlTemplateProfileList enumerator_15100 (callExtensionGetter_sortedTemplateProfiles ((const cPtr_library *) temp_0.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 494)), kENUMERATION_UP) ;
+  while (enumerator_15100.hasCurrentObject ()) {
+    var_report_14989.plusAssign_operation(enumerator_15100.current_exclusiveTime (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 495)).getter_stringByLeftPadding (GALGAS_uint ((uint32_t) 14U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("gtl_types.galgas", 495)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 495)).add_operation (enumerator_15100.current_inclusiveTime (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 496)).getter_stringByLeftPadding (GALGAS_uint ((uint32_t) 14U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("gtl_types.galgas", 496)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 495)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 496)).add_operation (enumerator_15100.current_calls (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 497)).getter_stringByLeftPadding (GALGAS_uint ((uint32_t) 8U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("gtl_types.galgas", 497)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 496)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 497)).add_operation (enumerator_15100.current_emittedCharacters (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 498)).getter_stringByLeftPadding (GALGAS_uint ((uint32_t) 10U), GALGAS_char (TO_UNICODE (32)) COMMA_SOURCE_FILE ("gtl_types.galgas", 498)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 497)).add_operation (GALGAS_string ("  "), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 498)).add_operation (enumerator_15100.current_path (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 498)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 499)), inCompiler  COMMA_SOURCE_FILE ("gtl_types.galgas", 495)) ;
+    enumerator_15100.gotoNextObject () ;
+  }
+  var_report_14989.method_writeToFile (constinArgument_reportFileName, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 501)) ;
+  GALGAS_string var_folded_15486 = GALGAS_string::makeEmptyString () ;
+  cEnumerator_gtlFoldedStackMap enumerator_15516 (object->mProperty_foldedStacks, kENUMERATION_UP) ;
+  while (enumerator_15516.hasCurrentObject ()) {
+    var_folded_15486.plusAssign_operation(enumerator_15516.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 504)).add_operation (GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 504)).add_operation (enumerator_15516.current_time (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 504)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 504)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 504)), inCompiler  COMMA_SOURCE_FILE ("gtl_types.galgas", 504)) ;
+    enumerator_15516.gotoNextObject () ;
+  }
+  var_folded_15486.method_writeToFile (constinArgument_foldedStackFileName, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 506)) ;
+}
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionMethod_library_writeTemplateProfile (void) {
+  enterExtensionMethod_writeTemplateProfile (kTypeDescriptor_GALGAS_library.mSlotID,
+                                             extensionMethod_library_writeTemplateProfile) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionMethod_library_writeTemplateProfile (void) {
+  gExtensionMethodTable_library_writeTemplateProfile.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gMethod_library_writeTemplateProfile (defineExtensionMethod_library_writeTemplateProfile,
+                                                         freeExtensionMethod_library_writeTemplateProfile) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                     Extension getter '@library functionExists'                                      *
@@ -5237,7 +7326,7 @@ static GALGAS_bool extensionGetter_library_functionExists (const cPtr_library *
   GALGAS_bool result_exists ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_exists = object->mProperty_funcMap.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 330)) COMMA_SOURCE_FILE ("gtl_types.galgas", 330)) ;
+  result_exists = object->mProperty_funcMap.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 513)) COMMA_SOURCE_FILE ("gtl_types.galgas", 513)) ;
 //---
   return result_exists ;
 }
@@ -5320,7 +7409,7 @@ static GALGAS_gtlFunction extensionGetter_library_getFunction (const cPtr_librar
   GALGAS_gtlFunction result_aFunction ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_funcMap.method_get (constinArgument_name, result_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 337)) ;
+  object->mProperty_funcMap.method_get (constinArgument_name, result_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 520)) ;
 //---
   return result_aFunction ;
 }
@@ -5400,7 +7489,7 @@ static void extensionSetter_library_putFunction (cPtr_library * inObject,
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
   {
-  object->mProperty_funcMap.setter_put (constinArgument_name, constinArgument_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 344)) ;
+  object->mProperty_funcMap.setter_put (constinArgument_name, constinArgument_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 527)) ;
   }
 }
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5482,7 +7571,7 @@ static GALGAS_bool extensionGetter_library_getterExists (const cPtr_library * in
   GALGAS_bool result_exists ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_exists = object->mProperty_getterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 352)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 352)) COMMA_SOURCE_FILE ("gtl_types.galgas", 352)) ;
+  result_exists = object->mProperty_getterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 535)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 535)) COMMA_SOURCE_FILE ("gtl_types.galgas", 535)) ;
 //---
   return result_exists ;
 }
@@ -5567,7 +7656,7 @@ static GALGAS_gtlGetter extensionGetter_library_getGetter (const cPtr_library *
   GALGAS_gtlGetter result_aGetter ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_getterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 360)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 360)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 360))  COMMA_SOURCE_FILE ("gtl_types.galgas", 360)), result_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 360)) ;
+  object->mProperty_getterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 543)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 543)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 543))  COMMA_SOURCE_FILE ("gtl_types.galgas", 543)), result_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 543)) ;
 //---
   return result_aGetter ;
 }
@@ -5647,7 +7736,7 @@ static void extensionSetter_library_putGetter (cPtr_library * inObject,
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
   {
-  object->mProperty_getterMap.setter_put (constinArgument_name, constinArgument_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 367)) ;
+  object->mProperty_getterMap.setter_put (constinArgument_name, constinArgument_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 550)) ;
   }
 }
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5729,7 +7818,7 @@ static GALGAS_bool extensionGetter_library_setterExists (const cPtr_library * in
   GALGAS_bool result_exists ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_exists = object->mProperty_setterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 375)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 375)) COMMA_SOURCE_FILE ("gtl_types.galgas", 375)) ;
+  result_exists = object->mProperty_setterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 558)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 558)) COMMA_SOURCE_FILE ("gtl_types.galgas", 558)) ;
 //---
   return result_exists ;
 }
@@ -5814,7 +7903,7 @@ static GALGAS_gtlSetter extensionGetter_library_getSetter (const cPtr_library *
   GALGAS_gtlSetter result_aSetter ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_setterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 383)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 383)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 383))  COMMA_SOURCE_FILE ("gtl_types.galgas", 383)), result_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 383)) ;
+  object->mProperty_setterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 566)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 566)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 566))  COMMA_SOURCE_FILE ("gtl_types.galgas", 566)), result_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 566)) ;
 //---
   return result_aSetter ;
 }
@@ -5894,7 +7983,7 @@ static void extensionSetter_library_putSetter (cPtr_library * inObject,
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
   {
-  object->mProperty_setterMap.setter_put (constinArgument_name, constinArgument_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 390)) ;
+  object->mProperty_setterMap.setter_put (constinArgument_name, constinArgument_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 573)) ;
   }
 }
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5974,7 +8063,7 @@ static GALGAS_bool extensionGetter_library_hasImport (const cPtr_library * inObj
   GALGAS_bool result_result ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_result = object->mProperty_doneImports.getter_hasKey (constinArgument_importPath COMMA_SOURCE_FILE ("gtl_types.galgas", 397)) ;
+  result_result = object->mProperty_doneImports.getter_hasKey (constinArgument_importPath COMMA_SOURCE_FILE ("gtl_types.galgas", 580)) ;
 //---
   return result_result ;
 }
@@ -6051,7 +8140,7 @@ static void extensionSetter_library_doImport (cPtr_library * inObject,
                                               COMMA_UNUSED_LOCATION_ARGS) {
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_doneImports.addAssign_operation (constinArgument_importPath  COMMA_SOURCE_FILE ("gtl_types.galgas", 403)) ;
+  object->mProperty_doneImports.addAssign_operation (constinArgument_importPath  COMMA_SOURCE_FILE ("gtl_types.galgas", 586)) ;
 }
 //---------------------------------------------------------------------------------------------------------------------*
 
@@ -6136,8 +8225,25 @@ static void extensionSetter_library_getTemplate (cPtr_library * inObject,
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  {
-  extensionSetter_getTemplate (object->mProperty_templateMap, constinArgument_context, inArgument_path, inArgument_ifExists, ioArgument_lib, outArgument_found, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 415)) ;
+  const enumGalgasBool test_0 = object->mProperty_missingTemplates.getter_hasKey (inArgument_path.getter_string (SOURCE_FILE ("gtl_types.galgas", 633)) COMMA_SOURCE_FILE ("gtl_types.galgas", 633)).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    outArgument_found = GALGAS_bool (false) ;
+    const enumGalgasBool test_1 = inArgument_ifExists.boolEnum () ;
+    if (kBoolTrue == test_1) {
+      outArgument_result = GALGAS_gtlTemplate::constructor_new (inArgument_path.getter_string (SOURCE_FILE ("gtl_types.galgas", 636)), GALGAS_gtlInstructionList::constructor_emptyList (SOURCE_FILE ("gtl_types.galgas", 636))  COMMA_SOURCE_FILE ("gtl_types.galgas", 636)) ;
+    }else if (kBoolFalse == test_1) {
+      TC_Array <C_FixItDescription> fixItArray2 ;
+      inCompiler->emitSemanticError (inArgument_path.getter_location (SOURCE_FILE ("gtl_types.galgas", 638)), GALGAS_string ("template file not found at \"").add_operation (inArgument_path.getter_string (SOURCE_FILE ("gtl_types.galgas", 638)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 638)).add_operation (GALGAS_string ("\""), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 638)), fixItArray2  COMMA_SOURCE_FILE ("gtl_types.galgas", 638)) ;
+      outArgument_result.drop () ; // Release error dropped variable
+    }
+  }else if (kBoolFalse == test_0) {
+    {
+    extensionSetter_getTemplate (object->mProperty_templateMap, constinArgument_context, inArgument_path, inArgument_ifExists, ioArgument_lib, outArgument_found, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 641)) ;
+    }
+    const enumGalgasBool test_3 = outArgument_found.operator_not (SOURCE_FILE ("gtl_types.galgas", 649)).boolEnum () ;
+    if (kBoolTrue == test_3) {
+      object->mProperty_missingTemplates.addAssign_operation (inArgument_path.getter_string (SOURCE_FILE ("gtl_types.galgas", 650))  COMMA_SOURCE_FILE ("gtl_types.galgas", 650)) ;
+    }
   }
 }
 //---------------------------------------------------------------------------------------------------------------------*
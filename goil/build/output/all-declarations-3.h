@@ -1542,6 +1542,112 @@ void callExtensionMethod_execute (const class cPtr_gtlTemplate * inObject,
                                   C_Compiler * inCompiler
                                   COMMA_LOCATION_ARGS) ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                  Extension setter '@library enterTemplateProfile'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef void (*extensionSetterSignature_library_enterTemplateProfile) (class cPtr_library * inObject,
+                                                                       const class GALGAS_string constinArgument0,
+                                                                       class GALGAS_uint & outArgument1,
+                                                                       class GALGAS_uint & outArgument2,
+                                                                       class GALGAS_string & outArgument3,
+                                                                       class C_Compiler * inCompiler
+                                                                       COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionSetter_enterTemplateProfile (const int32_t inClassIndex,
+                                                extensionSetterSignature_library_enterTemplateProfile inModifier) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionSetter_enterTemplateProfile (class cPtr_library * inObject,
+                                               const GALGAS_string constin_path,
+                                               GALGAS_uint & out_startTime,
+                                               GALGAS_uint & out_savedChildTime,
+                                               GALGAS_string & out_savedStack,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                   Extension setter '@library exitTemplateProfile'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef void (*extensionSetterSignature_library_exitTemplateProfile) (class cPtr_library * inObject,
+                                                                      const class GALGAS_string constinArgument0,
+                                                                      const class GALGAS_uint constinArgument1,
+                                                                      const class GALGAS_uint constinArgument2,
+                                                                      const class GALGAS_string constinArgument3,
+                                                                      const class GALGAS_uint constinArgument4,
+                                                                      class C_Compiler * inCompiler
+                                                                      COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionSetter_exitTemplateProfile (const int32_t inClassIndex,
+                                               extensionSetterSignature_library_exitTemplateProfile inModifier) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionSetter_exitTemplateProfile (class cPtr_library * inObject,
+                                              const GALGAS_string constin_path,
+                                              const GALGAS_uint constin_startTime,
+                                              const GALGAS_uint constin_savedChildTime,
+                                              const GALGAS_string constin_savedStack,
+                                              const GALGAS_uint constin_emittedCharacters,
+                                              C_Compiler * inCompiler
+                                              COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                 Extension getter '@library sortedTemplateProfiles'                                  *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef class GALGAS_gtlTemplateProfileList (*enterExtensionGetter_library_sortedTemplateProfiles) (const class cPtr_library * inObject,
+                                                                                                    C_Compiler * inCompiler
+                                                                                                    COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_sortedTemplateProfiles (const int32_t inClassIndex,
+                                                  enterExtensionGetter_library_sortedTemplateProfiles inGetter) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlTemplateProfileList callExtensionGetter_sortedTemplateProfiles (const cPtr_library * inObject,
+                                                                                class C_Compiler * inCompiler
+                                                                                COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                  Extension method '@library writeTemplateProfile'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef void (*extensionMethodSignature_library_writeTemplateProfile) (const class cPtr_library * inObject,
+                                                                       const class GALGAS_string constinArgument0,
+                                                                       const class GALGAS_string constinArgument1,
+                                                                       class C_Compiler * inCompiler
+                                                                       COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionMethod_writeTemplateProfile (const int32_t inClassIndex,
+                                                extensionMethodSignature_library_writeTemplateProfile inMethod) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionMethod_writeTemplateProfile (const class cPtr_library * inObject,
+                                               const GALGAS_string constin_reportFileName,
+                                               const GALGAS_string constin_foldedStackFileName,
+                                               C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                     Extension getter '@library functionExists'                                      *
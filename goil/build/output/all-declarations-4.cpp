@@ -7199,42 +7199,42 @@ static void extensionMethod_gtlForeachStatementInstruction_iterateOnMap (const c
   const cPtr_gtlForeachStatementInstruction * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
   GALGAS_lstring temp_0 ;
-  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 619)))).boolEnum () ;
+  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 615)))).boolEnum () ;
   if (kBoolTrue == test_1) {
-    temp_0 = GALGAS_lstring::constructor_new (GALGAS_string ("KEY"), object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 620))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 620)) ;
+    temp_0 = GALGAS_lstring::constructor_new (GALGAS_string ("KEY"), object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 616))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 616)) ;
   }else if (kBoolFalse == test_1) {
     temp_0 = object->mProperty_keyName ;
   }
-  GALGAS_lstring var_actualKeyName_18050 = temp_0 ;
-  cEnumerator_gtlVarMap enumerator_18163 (constinArgument_iterableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 625)), kENUMERATION_UP) ;
-  GALGAS_uint index_18137 ((uint32_t) 0) ;
+  GALGAS_lstring var_actualKeyName_17899 = temp_0 ;
+  cEnumerator_gtlVarMap enumerator_18012 (constinArgument_iterableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 621)), kENUMERATION_UP) ;
+  GALGAS_uint index_17986 ((uint32_t) 0) ;
   const bool bool_2 = true ;
-  if (enumerator_18163.hasCurrentObject () && bool_2) {
-    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 627)) ;
-    while (enumerator_18163.hasCurrentObject () && bool_2) {
+  if (enumerator_18012.hasCurrentObject () && bool_2) {
+    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 623)) ;
+    while (enumerator_18012.hasCurrentObject () && bool_2) {
       {
       ioArgument_vars.insulate (HERE) ;
-      cPtr_gtlData * ptr_18260 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18260, object->mProperty_variableName, enumerator_18163.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 629)) ;
+      cPtr_gtlData * ptr_18109 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18109, object->mProperty_variableName, enumerator_18012.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 625)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
-      cPtr_gtlData * ptr_18309 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18309, var_actualKeyName_18050, GALGAS_gtlString::constructor_new (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 631)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 631)), enumerator_18163.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 631))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 631)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 630)) ;
+      cPtr_gtlData * ptr_18158 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18158, var_actualKeyName_17899, GALGAS_gtlString::constructor_new (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 627)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 627)), enumerator_18012.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 627))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 627)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 626)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
-      cPtr_gtlData * ptr_18423 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18423, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 634)), index_18137.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 634))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 634)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 633)) ;
+      cPtr_gtlData * ptr_18272 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18272, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 630)), index_17986.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 630))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 630)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 629)) ;
       }
-      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 636)) ;
-      enumerator_18163.gotoNextObject () ;
-      index_18137.increment () ;
-      if (enumerator_18163.hasCurrentObject () && bool_2) {
-        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 638)) ;
+      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 632)) ;
+      enumerator_18012.gotoNextObject () ;
+      index_17986.increment () ;
+      if (enumerator_18012.hasCurrentObject () && bool_2) {
+        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 634)) ;
       }
     }
-    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 640)) ;
+    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 636)) ;
   }
 }
 //---------------------------------------------------------------------------------------------------------------------*
@@ -7318,35 +7318,35 @@ static void extensionMethod_gtlForeachStatementInstruction_iterateOnList (const
                                                                           COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlForeachStatementInstruction * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
-  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 651)))).boolEnum () ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 647)))).boolEnum () ;
   if (kBoolTrue == test_0) {
     TC_Array <C_FixItDescription> fixItArray1 ;
-    inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 652)), GALGAS_string ("a key variable cannot be define when iterating on a list"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 652)) ;
+    inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 648)), GALGAS_string ("a key variable cannot be define when iterating on a list"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 648)) ;
   }
-  cEnumerator_list enumerator_19056 (constinArgument_iterableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 654)), kENUMERATION_UP) ;
-  GALGAS_uint index_19029 ((uint32_t) 0) ;
+  cEnumerator_list enumerator_18905 (constinArgument_iterableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 650)), kENUMERATION_UP) ;
+  GALGAS_uint index_18878 ((uint32_t) 0) ;
   const bool bool_2 = true ;
-  if (enumerator_19056.hasCurrentObject () && bool_2) {
-    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 656)) ;
-    while (enumerator_19056.hasCurrentObject () && bool_2) {
+  if (enumerator_18905.hasCurrentObject () && bool_2) {
+    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 652)) ;
+    while (enumerator_18905.hasCurrentObject () && bool_2) {
       {
       ioArgument_vars.insulate (HERE) ;
-      cPtr_gtlData * ptr_19153 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19153, object->mProperty_variableName, enumerator_19056.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 658)) ;
+      cPtr_gtlData * ptr_19002 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19002, object->mProperty_variableName, enumerator_18905.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 654)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
-      cPtr_gtlData * ptr_19202 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19202, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 660)), index_19029.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 660))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 660)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 659)) ;
+      cPtr_gtlData * ptr_19051 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19051, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 656)), index_18878.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 656))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 656)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 655)) ;
       }
-      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 662)) ;
-      enumerator_19056.gotoNextObject () ;
-      index_19029.increment () ;
-      if (enumerator_19056.hasCurrentObject () && bool_2) {
-        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 664)) ;
+      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 658)) ;
+      enumerator_18905.gotoNextObject () ;
+      index_18878.increment () ;
+      if (enumerator_18905.hasCurrentObject () && bool_2) {
+        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 660)) ;
       }
     }
-    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 666)) ;
+    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 662)) ;
   }
 }
 //---------------------------------------------------------------------------------------------------------------------*
@@ -7430,35 +7430,35 @@ static void extensionMethod_gtlForeachStatementInstruction_iterateOnSet (const c
                                                                          COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlForeachStatementInstruction * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
-  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 677)))).boolEnum () ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 673)))).boolEnum () ;
   if (kBoolTrue == test_0) {
     TC_Array <C_FixItDescription> fixItArray1 ;
-    inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 678)), GALGAS_string ("a key variable cannot be define when iterating on a set"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 678)) ;
+    inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 674)), GALGAS_string ("a key variable cannot be define when iterating on a set"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 674)) ;
   }
-  cEnumerator_lstringset enumerator_19826 (constinArgument_iterableSet.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 680)), kENUMERATION_UP) ;
-  GALGAS_uint index_19800 ((uint32_t) 0) ;
+  cEnumerator_lstringset enumerator_19675 (constinArgument_iterableSet.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 676)), kENUMERATION_UP) ;
+  GALGAS_uint index_19649 ((uint32_t) 0) ;
   const bool bool_2 = true ;
-  if (enumerator_19826.hasCurrentObject () && bool_2) {
-    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 682)) ;
-    while (enumerator_19826.hasCurrentObject () && bool_2) {
+  if (enumerator_19675.hasCurrentObject () && bool_2) {
+    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 678)) ;
+    while (enumerator_19675.hasCurrentObject () && bool_2) {
       {
       ioArgument_vars.insulate (HERE) ;
-      cPtr_gtlData * ptr_19923 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19923, object->mProperty_variableName, GALGAS_gtlString::constructor_new (enumerator_19826.current_lkey (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 686)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 686)), enumerator_19826.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 686))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 686)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 684)) ;
+      cPtr_gtlData * ptr_19772 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19772, object->mProperty_variableName, GALGAS_gtlString::constructor_new (enumerator_19675.current_lkey (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 682)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 682)), enumerator_19675.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 682))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 682)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 680)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
-      cPtr_gtlData * ptr_20030 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_20030, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 689)), index_19800.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 689))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 689)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 688)) ;
+      cPtr_gtlData * ptr_19879 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19879, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 685)), index_19649.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 685))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 685)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 684)) ;
       }
-      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 691)) ;
-      enumerator_19826.gotoNextObject () ;
-      index_19800.increment () ;
-      if (enumerator_19826.hasCurrentObject () && bool_2) {
-        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 693)) ;
+      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 687)) ;
+      enumerator_19675.gotoNextObject () ;
+      index_19649.increment () ;
+      if (enumerator_19675.hasCurrentObject () && bool_2) {
+        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 689)) ;
       }
     }
-    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 695)) ;
+    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 691)) ;
   }
 }
 //---------------------------------------------------------------------------------------------------------------------*
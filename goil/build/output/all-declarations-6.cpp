@@ -11072,6 +11072,656 @@ GALGAS_gtlTemplateMap_2D_element GALGAS_gtlTemplateMap_2D_element::extractObject
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+GALGAS_gtlTemplateProfileMap_2D_element::GALGAS_gtlTemplateProfileMap_2D_element (void) :
+mProperty_lkey (),
+mProperty_calls (),
+mProperty_inclusiveTime (),
+mProperty_exclusiveTime (),
+mProperty_emittedCharacters () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap_2D_element::~ GALGAS_gtlTemplateProfileMap_2D_element (void) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap_2D_element::GALGAS_gtlTemplateProfileMap_2D_element (const GALGAS_lstring & inOperand0,
+                                                                                  const GALGAS_uint & inOperand1,
+                                                                                  const GALGAS_uint & inOperand2,
+                                                                                  const GALGAS_uint & inOperand3,
+                                                                                  const GALGAS_uint & inOperand4) :
+mProperty_lkey (inOperand0),
+mProperty_calls (inOperand1),
+mProperty_inclusiveTime (inOperand2),
+mProperty_exclusiveTime (inOperand3),
+mProperty_emittedCharacters (inOperand4) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap_2D_element GALGAS_gtlTemplateProfileMap_2D_element::constructor_default (UNUSED_LOCATION_ARGS) {
+  return GALGAS_gtlTemplateProfileMap_2D_element (GALGAS_lstring::constructor_default (HERE),
+                                                  GALGAS_uint::constructor_default (HERE),
+                                                  GALGAS_uint::constructor_default (HERE),
+                                                  GALGAS_uint::constructor_default (HERE),
+                                                  GALGAS_uint::constructor_default (HERE)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap_2D_element GALGAS_gtlTemplateProfileMap_2D_element::constructor_new (const GALGAS_lstring & inOperand0,
+                                                                                                  const GALGAS_uint & inOperand1,
+                                                                                                  const GALGAS_uint & inOperand2,
+                                                                                                  const GALGAS_uint & inOperand3,
+                                                                                                  const GALGAS_uint & inOperand4 
+                                                                                                  COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileMap_2D_element result ;
+  if (inOperand0.isValid () && inOperand1.isValid () && inOperand2.isValid () && inOperand3.isValid () && inOperand4.isValid ()) {
+    result = GALGAS_gtlTemplateProfileMap_2D_element (inOperand0, inOperand1, inOperand2, inOperand3, inOperand4) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult GALGAS_gtlTemplateProfileMap_2D_element::objectCompare (const GALGAS_gtlTemplateProfileMap_2D_element & inOperand) const {
+   typeComparisonResult result = kOperandEqual ;
+  if (result == kOperandEqual) {
+    result = mProperty_lkey.objectCompare (inOperand.mProperty_lkey) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_calls.objectCompare (inOperand.mProperty_calls) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_inclusiveTime.objectCompare (inOperand.mProperty_inclusiveTime) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_exclusiveTime.objectCompare (inOperand.mProperty_exclusiveTime) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_emittedCharacters.objectCompare (inOperand.mProperty_emittedCharacters) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool GALGAS_gtlTemplateProfileMap_2D_element::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_calls.isValid () && mProperty_inclusiveTime.isValid () && mProperty_exclusiveTime.isValid () && mProperty_emittedCharacters.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap_2D_element::drop (void) {
+  mProperty_lkey.drop () ;
+  mProperty_calls.drop () ;
+  mProperty_inclusiveTime.drop () ;
+  mProperty_exclusiveTime.drop () ;
+  mProperty_emittedCharacters.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileMap_2D_element::description (C_String & ioString,
+                                                           const int32_t inIndentation) const {
+  ioString << "<struct @gtlTemplateProfileMap-element:" ;
+  if (! isValid ()) {
+    ioString << " not built" ;
+  }else{
+    mProperty_lkey.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_calls.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_inclusiveTime.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_exclusiveTime.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_emittedCharacters.description (ioString, inIndentation+1) ;
+  }
+  ioString << ">" ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_lstring GALGAS_gtlTemplateProfileMap_2D_element::getter_lkey (UNUSED_LOCATION_ARGS) const {
+  return mProperty_lkey ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap_2D_element::getter_calls (UNUSED_LOCATION_ARGS) const {
+  return mProperty_calls ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap_2D_element::getter_inclusiveTime (UNUSED_LOCATION_ARGS) const {
+  return mProperty_inclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap_2D_element::getter_exclusiveTime (UNUSED_LOCATION_ARGS) const {
+  return mProperty_exclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileMap_2D_element::getter_emittedCharacters (UNUSED_LOCATION_ARGS) const {
+  return mProperty_emittedCharacters ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                         @gtlTemplateProfileMap-element type                                         *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlTemplateProfileMap_2D_element ("gtlTemplateProfileMap-element",
+                                                         NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlTemplateProfileMap_2D_element::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlTemplateProfileMap_2D_element ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlTemplateProfileMap_2D_element::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlTemplateProfileMap_2D_element (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileMap_2D_element GALGAS_gtlTemplateProfileMap_2D_element::extractObject (const GALGAS_object & inObject,
+                                                                                                C_Compiler * inCompiler
+                                                                                                COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileMap_2D_element result ;
+  const GALGAS_gtlTemplateProfileMap_2D_element * p = (const GALGAS_gtlTemplateProfileMap_2D_element *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlTemplateProfileMap_2D_element *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlTemplateProfileMap-element", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap_2D_element::GALGAS_gtlFoldedStackMap_2D_element (void) :
+mProperty_lkey (),
+mProperty_time () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap_2D_element::~ GALGAS_gtlFoldedStackMap_2D_element (void) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap_2D_element::GALGAS_gtlFoldedStackMap_2D_element (const GALGAS_lstring & inOperand0,
+                                                                          const GALGAS_uint & inOperand1) :
+mProperty_lkey (inOperand0),
+mProperty_time (inOperand1) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap_2D_element GALGAS_gtlFoldedStackMap_2D_element::constructor_default (UNUSED_LOCATION_ARGS) {
+  return GALGAS_gtlFoldedStackMap_2D_element (GALGAS_lstring::constructor_default (HERE),
+                                              GALGAS_uint::constructor_default (HERE)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap_2D_element GALGAS_gtlFoldedStackMap_2D_element::constructor_new (const GALGAS_lstring & inOperand0,
+                                                                                          const GALGAS_uint & inOperand1 
+                                                                                          COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlFoldedStackMap_2D_element result ;
+  if (inOperand0.isValid () && inOperand1.isValid ()) {
+    result = GALGAS_gtlFoldedStackMap_2D_element (inOperand0, inOperand1) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult GALGAS_gtlFoldedStackMap_2D_element::objectCompare (const GALGAS_gtlFoldedStackMap_2D_element & inOperand) const {
+   typeComparisonResult result = kOperandEqual ;
+  if (result == kOperandEqual) {
+    result = mProperty_lkey.objectCompare (inOperand.mProperty_lkey) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_time.objectCompare (inOperand.mProperty_time) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool GALGAS_gtlFoldedStackMap_2D_element::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_time.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlFoldedStackMap_2D_element::drop (void) {
+  mProperty_lkey.drop () ;
+  mProperty_time.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlFoldedStackMap_2D_element::description (C_String & ioString,
+                                                       const int32_t inIndentation) const {
+  ioString << "<struct @gtlFoldedStackMap-element:" ;
+  if (! isValid ()) {
+    ioString << " not built" ;
+  }else{
+    mProperty_lkey.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_time.description (ioString, inIndentation+1) ;
+  }
+  ioString << ">" ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_lstring GALGAS_gtlFoldedStackMap_2D_element::getter_lkey (UNUSED_LOCATION_ARGS) const {
+  return mProperty_lkey ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlFoldedStackMap_2D_element::getter_time (UNUSED_LOCATION_ARGS) const {
+  return mProperty_time ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                           @gtlFoldedStackMap-element type                                           *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlFoldedStackMap_2D_element ("gtlFoldedStackMap-element",
+                                                     NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlFoldedStackMap_2D_element::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlFoldedStackMap_2D_element ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlFoldedStackMap_2D_element::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlFoldedStackMap_2D_element (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlFoldedStackMap_2D_element GALGAS_gtlFoldedStackMap_2D_element::extractObject (const GALGAS_object & inObject,
+                                                                                        C_Compiler * inCompiler
+                                                                                        COMMA_LOCATION_ARGS) {
+  GALGAS_gtlFoldedStackMap_2D_element result ;
+  const GALGAS_gtlFoldedStackMap_2D_element * p = (const GALGAS_gtlFoldedStackMap_2D_element *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlFoldedStackMap_2D_element *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlFoldedStackMap-element", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList_2D_element::GALGAS_gtlTemplateProfileList_2D_element (void) :
+mProperty_path (),
+mProperty_calls (),
+mProperty_inclusiveTime (),
+mProperty_exclusiveTime (),
+mProperty_emittedCharacters () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList_2D_element::~ GALGAS_gtlTemplateProfileList_2D_element (void) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList_2D_element::GALGAS_gtlTemplateProfileList_2D_element (const GALGAS_string & inOperand0,
+                                                                                    const GALGAS_uint & inOperand1,
+                                                                                    const GALGAS_uint & inOperand2,
+                                                                                    const GALGAS_uint & inOperand3,
+                                                                                    const GALGAS_uint & inOperand4) :
+mProperty_path (inOperand0),
+mProperty_calls (inOperand1),
+mProperty_inclusiveTime (inOperand2),
+mProperty_exclusiveTime (inOperand3),
+mProperty_emittedCharacters (inOperand4) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList_2D_element GALGAS_gtlTemplateProfileList_2D_element::constructor_default (UNUSED_LOCATION_ARGS) {
+  return GALGAS_gtlTemplateProfileList_2D_element (GALGAS_string::constructor_default (HERE),
+                                                   GALGAS_uint::constructor_default (HERE),
+                                                   GALGAS_uint::constructor_default (HERE),
+                                                   GALGAS_uint::constructor_default (HERE),
+                                                   GALGAS_uint::constructor_default (HERE)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList_2D_element GALGAS_gtlTemplateProfileList_2D_element::constructor_new (const GALGAS_string & inOperand0,
+                                                                                                    const GALGAS_uint & inOperand1,
+                                                                                                    const GALGAS_uint & inOperand2,
+                                                                                                    const GALGAS_uint & inOperand3,
+                                                                                                    const GALGAS_uint & inOperand4 
+                                                                                                    COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileList_2D_element result ;
+  if (inOperand0.isValid () && inOperand1.isValid () && inOperand2.isValid () && inOperand3.isValid () && inOperand4.isValid ()) {
+    result = GALGAS_gtlTemplateProfileList_2D_element (inOperand0, inOperand1, inOperand2, inOperand3, inOperand4) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult GALGAS_gtlTemplateProfileList_2D_element::objectCompare (const GALGAS_gtlTemplateProfileList_2D_element & inOperand) const {
+   typeComparisonResult result = kOperandEqual ;
+  if (result == kOperandEqual) {
+    result = mProperty_path.objectCompare (inOperand.mProperty_path) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_calls.objectCompare (inOperand.mProperty_calls) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_inclusiveTime.objectCompare (inOperand.mProperty_inclusiveTime) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_exclusiveTime.objectCompare (inOperand.mProperty_exclusiveTime) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_emittedCharacters.objectCompare (inOperand.mProperty_emittedCharacters) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool GALGAS_gtlTemplateProfileList_2D_element::isValid (void) const {
+  return mProperty_path.isValid () && mProperty_calls.isValid () && mProperty_inclusiveTime.isValid () && mProperty_exclusiveTime.isValid () && mProperty_emittedCharacters.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList_2D_element::drop (void) {
+  mProperty_path.drop () ;
+  mProperty_calls.drop () ;
+  mProperty_inclusiveTime.drop () ;
+  mProperty_exclusiveTime.drop () ;
+  mProperty_emittedCharacters.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplateProfileList_2D_element::description (C_String & ioString,
+                                                            const int32_t inIndentation) const {
+  ioString << "<struct @gtlTemplateProfileList-element:" ;
+  if (! isValid ()) {
+    ioString << " not built" ;
+  }else{
+    mProperty_path.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_calls.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_inclusiveTime.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_exclusiveTime.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_emittedCharacters.description (ioString, inIndentation+1) ;
+  }
+  ioString << ">" ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string GALGAS_gtlTemplateProfileList_2D_element::getter_path (UNUSED_LOCATION_ARGS) const {
+  return mProperty_path ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList_2D_element::getter_calls (UNUSED_LOCATION_ARGS) const {
+  return mProperty_calls ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList_2D_element::getter_inclusiveTime (UNUSED_LOCATION_ARGS) const {
+  return mProperty_inclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList_2D_element::getter_exclusiveTime (UNUSED_LOCATION_ARGS) const {
+  return mProperty_exclusiveTime ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_uint GALGAS_gtlTemplateProfileList_2D_element::getter_emittedCharacters (UNUSED_LOCATION_ARGS) const {
+  return mProperty_emittedCharacters ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                        @gtlTemplateProfileList-element type                                         *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlTemplateProfileList_2D_element ("gtlTemplateProfileList-element",
+                                                          NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlTemplateProfileList_2D_element::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlTemplateProfileList_2D_element ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlTemplateProfileList_2D_element::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlTemplateProfileList_2D_element (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplateProfileList_2D_element GALGAS_gtlTemplateProfileList_2D_element::extractObject (const GALGAS_object & inObject,
+                                                                                                  C_Compiler * inCompiler
+                                                                                                  COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplateProfileList_2D_element result ;
+  const GALGAS_gtlTemplateProfileList_2D_element * p = (const GALGAS_gtlTemplateProfileList_2D_element *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlTemplateProfileList_2D_element *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlTemplateProfileList-element", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap_2D_element::GALGAS_gtlTemplatePathMap_2D_element (void) :
+mProperty_lkey (),
+mProperty_fullPath () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap_2D_element::~ GALGAS_gtlTemplatePathMap_2D_element (void) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap_2D_element::GALGAS_gtlTemplatePathMap_2D_element (const GALGAS_lstring & inOperand0,
+                                                                            const GALGAS_string & inOperand1) :
+mProperty_lkey (inOperand0),
+mProperty_fullPath (inOperand1) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap_2D_element GALGAS_gtlTemplatePathMap_2D_element::constructor_default (UNUSED_LOCATION_ARGS) {
+  return GALGAS_gtlTemplatePathMap_2D_element (GALGAS_lstring::constructor_default (HERE),
+                                               GALGAS_string::constructor_default (HERE)) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap_2D_element GALGAS_gtlTemplatePathMap_2D_element::constructor_new (const GALGAS_lstring & inOperand0,
+                                                                                            const GALGAS_string & inOperand1 
+                                                                                            COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlTemplatePathMap_2D_element result ;
+  if (inOperand0.isValid () && inOperand1.isValid ()) {
+    result = GALGAS_gtlTemplatePathMap_2D_element (inOperand0, inOperand1) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult GALGAS_gtlTemplatePathMap_2D_element::objectCompare (const GALGAS_gtlTemplatePathMap_2D_element & inOperand) const {
+   typeComparisonResult result = kOperandEqual ;
+  if (result == kOperandEqual) {
+    result = mProperty_lkey.objectCompare (inOperand.mProperty_lkey) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_fullPath.objectCompare (inOperand.mProperty_fullPath) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool GALGAS_gtlTemplatePathMap_2D_element::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_fullPath.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplatePathMap_2D_element::drop (void) {
+  mProperty_lkey.drop () ;
+  mProperty_fullPath.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlTemplatePathMap_2D_element::description (C_String & ioString,
+                                                        const int32_t inIndentation) const {
+  ioString << "<struct @gtlTemplatePathMap-element:" ;
+  if (! isValid ()) {
+    ioString << " not built" ;
+  }else{
+    mProperty_lkey.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_fullPath.description (ioString, inIndentation+1) ;
+  }
+  ioString << ">" ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_lstring GALGAS_gtlTemplatePathMap_2D_element::getter_lkey (UNUSED_LOCATION_ARGS) const {
+  return mProperty_lkey ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_string GALGAS_gtlTemplatePathMap_2D_element::getter_fullPath (UNUSED_LOCATION_ARGS) const {
+  return mProperty_fullPath ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                          @gtlTemplatePathMap-element type                                           *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlTemplatePathMap_2D_element ("gtlTemplatePathMap-element",
+                                                      NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlTemplatePathMap_2D_element::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlTemplatePathMap_2D_element ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlTemplatePathMap_2D_element::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlTemplatePathMap_2D_element (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlTemplatePathMap_2D_element GALGAS_gtlTemplatePathMap_2D_element::extractObject (const GALGAS_object & inObject,
+                                                                                          C_Compiler * inCompiler
+                                                                                          COMMA_LOCATION_ARGS) {
+  GALGAS_gtlTemplatePathMap_2D_element result ;
+  const GALGAS_gtlTemplatePathMap_2D_element * p = (const GALGAS_gtlTemplatePathMap_2D_element *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlTemplatePathMap_2D_element *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlTemplatePathMap-element", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 GALGAS_gtlExpressionList_2D_element::GALGAS_gtlExpressionList_2D_element (void) :
 mProperty_expression () {
 }
@@ -12367,6 +13017,136 @@ GALGAS_sortingKeyList_2D_element GALGAS_sortingKeyList_2D_element::extractObject
 
 //---------------------------------------------------------------------------------------------------------------------*
 
+GALGAS_gtlSortEntryList_2D_element::GALGAS_gtlSortEntryList_2D_element (void) :
+mProperty_value (),
+mProperty_keys () {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlSortEntryList_2D_element::~ GALGAS_gtlSortEntryList_2D_element (void) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlSortEntryList_2D_element::GALGAS_gtlSortEntryList_2D_element (const GALGAS_gtlData & inOperand0,
+                                                                        const GALGAS_list & inOperand1) :
+mProperty_value (inOperand0),
+mProperty_keys (inOperand1) {
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlSortEntryList_2D_element GALGAS_gtlSortEntryList_2D_element::constructor_new (const GALGAS_gtlData & inOperand0,
+                                                                                        const GALGAS_list & inOperand1 
+                                                                                        COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlSortEntryList_2D_element result ;
+  if (inOperand0.isValid () && inOperand1.isValid ()) {
+    result = GALGAS_gtlSortEntryList_2D_element (inOperand0, inOperand1) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+typeComparisonResult GALGAS_gtlSortEntryList_2D_element::objectCompare (const GALGAS_gtlSortEntryList_2D_element & inOperand) const {
+   typeComparisonResult result = kOperandEqual ;
+  if (result == kOperandEqual) {
+    result = mProperty_value.objectCompare (inOperand.mProperty_value) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_keys.objectCompare (inOperand.mProperty_keys) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+bool GALGAS_gtlSortEntryList_2D_element::isValid (void) const {
+  return mProperty_value.isValid () && mProperty_keys.isValid () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlSortEntryList_2D_element::drop (void) {
+  mProperty_value.drop () ;
+  mProperty_keys.drop () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_gtlSortEntryList_2D_element::description (C_String & ioString,
+                                                      const int32_t inIndentation) const {
+  ioString << "<struct @gtlSortEntryList-element:" ;
+  if (! isValid ()) {
+    ioString << " not built" ;
+  }else{
+    mProperty_value.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_keys.description (ioString, inIndentation+1) ;
+  }
+  ioString << ">" ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlData GALGAS_gtlSortEntryList_2D_element::getter_value (UNUSED_LOCATION_ARGS) const {
+  return mProperty_value ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_list GALGAS_gtlSortEntryList_2D_element::getter_keys (UNUSED_LOCATION_ARGS) const {
+  return mProperty_keys ;
+}
+
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                           @gtlSortEntryList-element type                                            *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlSortEntryList_2D_element ("gtlSortEntryList-element",
+                                                    NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+const C_galgas_type_descriptor * GALGAS_gtlSortEntryList_2D_element::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlSortEntryList_2D_element ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+AC_GALGAS_root * GALGAS_gtlSortEntryList_2D_element::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlSortEntryList_2D_element (*this)) ;
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlSortEntryList_2D_element GALGAS_gtlSortEntryList_2D_element::extractObject (const GALGAS_object & inObject,
+                                                                                      C_Compiler * inCompiler
+                                                                                      COMMA_LOCATION_ARGS) {
+  GALGAS_gtlSortEntryList_2D_element result ;
+  const GALGAS_gtlSortEntryList_2D_element * p = (const GALGAS_gtlSortEntryList_2D_element *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlSortEntryList_2D_element *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlSortEntryList-element", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
 GALGAS_numberList_2D_element::GALGAS_numberList_2D_element (void) :
 mProperty_location (),
 mProperty_value () {
@@ -3231,6 +3231,99 @@ static void freeExtensionGetter_gtlContext_fullTemplateFileName (void) {
 C_PrologueEpilogue gGetter_gtlContext_fullTemplateFileName (defineExtensionGetter_gtlContext_fullTemplateFileName,
                                                             freeExtensionGetter_gtlContext_fullTemplateFileName) ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                 Extension setter '@library resolveTemplateFileName'                                 *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <extensionSetterSignature_library_resolveTemplateFileName> gExtensionModifierTable_library_resolveTemplateFileName ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionSetter_resolveTemplateFileName (const int32_t inClassIndex,
+                                                   extensionSetterSignature_library_resolveTemplateFileName inModifier) {
+  gExtensionModifierTable_library_resolveTemplateFileName.forceObjectAtIndex (inClassIndex, inModifier, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionSetter_resolveTemplateFileName (cPtr_library * inObject,
+                                                  const GALGAS_gtlContext constin_templateContext,
+                                                  const GALGAS_gtlContext constin_context,
+                                                  const GALGAS_gtlData constin_vars,
+                                                  const GALGAS_lstring constin_simpleName,
+                                                  GALGAS_lstring & out_fullName,
+                                                  C_Compiler * inCompiler
+                                                  COMMA_LOCATION_ARGS) {
+//--- Drop output arguments
+  out_fullName.drop () ;
+//--- Find setter
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionSetterSignature_library_resolveTemplateFileName f = NULL ;
+    if (classIndex < gExtensionModifierTable_library_resolveTemplateFileName.count ()) {
+      f = gExtensionModifierTable_library_resolveTemplateFileName (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionModifierTable_library_resolveTemplateFileName.count ()) {
+           f = gExtensionModifierTable_library_resolveTemplateFileName (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionModifierTable_library_resolveTemplateFileName.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    f (inObject, constin_templateContext, constin_context, constin_vars, constin_simpleName, out_fullName, inCompiler COMMA_THERE) ;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void extensionSetter_library_resolveTemplateFileName (cPtr_library * inObject,
+                                                             const GALGAS_gtlContext constinArgument_templateContext,
+                                                             const GALGAS_gtlContext constinArgument_context,
+                                                             const GALGAS_gtlData constinArgument_vars,
+                                                             const GALGAS_lstring constinArgument_simpleName,
+                                                             GALGAS_lstring & outArgument_fullName,
+                                                             C_Compiler * inCompiler
+                                                             COMMA_UNUSED_LOCATION_ARGS) {
+  cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  GALGAS_string var_key_17810 = constinArgument_templateContext.getter_userTemplateDirectory (SOURCE_FILE ("gtl_types.galgas", 604)).add_operation (GALGAS_string ("|"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 604)).add_operation (constinArgument_templateContext.getter_templateDirectory (SOURCE_FILE ("gtl_types.galgas", 605)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 604)).add_operation (GALGAS_string ("|"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 605)).add_operation (constinArgument_context.getter_templateExtension (SOURCE_FILE ("gtl_types.galgas", 606)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 605)).add_operation (GALGAS_string ("|"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 606)).add_operation (callExtensionGetter_fullPrefix ((const cPtr_gtlContext *) constinArgument_templateContext.ptr (), constinArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 607)).getter_string (SOURCE_FILE ("gtl_types.galgas", 607)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 606)).add_operation (GALGAS_string ("|"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 607)).add_operation (constinArgument_templateContext.getter_path (SOURCE_FILE ("gtl_types.galgas", 608)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 607)).add_operation (GALGAS_string ("|"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 608)).add_operation (constinArgument_simpleName.getter_string (SOURCE_FILE ("gtl_types.galgas", 609)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 608)) ;
+  const enumGalgasBool test_0 = object->mProperty_templatePaths.getter_hasKey (var_key_17810 COMMA_SOURCE_FILE ("gtl_types.galgas", 610)).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    GALGAS_string var_fullPath_18157 ;
+    object->mProperty_templatePaths.method_get (function_lstring (var_key_17810, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 611)), var_fullPath_18157, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 611)) ;
+    outArgument_fullName = GALGAS_lstring::constructor_new (var_fullPath_18157, constinArgument_simpleName.getter_location (SOURCE_FILE ("gtl_types.galgas", 612))  COMMA_SOURCE_FILE ("gtl_types.galgas", 612)) ;
+  }else if (kBoolFalse == test_0) {
+    outArgument_fullName = callExtensionGetter_fullTemplateFileName ((const cPtr_gtlContext *) constinArgument_templateContext.ptr (), constinArgument_context, constinArgument_vars, constinArgument_simpleName, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 614)) ;
+    {
+    object->mProperty_templatePaths.setter_put (function_lstring (var_key_17810, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 619)), outArgument_fullName.getter_string (SOURCE_FILE ("gtl_types.galgas", 619)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 619)) ;
+    }
+  }
+}
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionSetter_library_resolveTemplateFileName (void) {
+  enterExtensionSetter_resolveTemplateFileName (kTypeDescriptor_GALGAS_library.mSlotID,
+                                                extensionSetter_library_resolveTemplateFileName) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionModifier_library_resolveTemplateFileName (void) {
+  gExtensionModifierTable_library_resolveTemplateFileName.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gSetter_library_resolveTemplateFileName (defineExtensionSetter_library_resolveTemplateFileName,
+                                                            freeExtensionModifier_library_resolveTemplateFileName) ;
+
 
 
 //---------------------------------------------------------------------------------------------------------------------*
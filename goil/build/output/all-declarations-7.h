@@ -132,6 +132,37 @@ class GALGAS_lstring callExtensionGetter_fullTemplateFileName (const cPtr_gtlCon
                                                                class C_Compiler * inCompiler
                                                                COMMA_LOCATION_ARGS) ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                 Extension setter '@library resolveTemplateFileName'                                 *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef void (*extensionSetterSignature_library_resolveTemplateFileName) (class cPtr_library * inObject,
+                                                                          const class GALGAS_gtlContext constinArgument0,
+                                                                          const class GALGAS_gtlContext constinArgument1,
+                                                                          const class GALGAS_gtlData constinArgument2,
+                                                                          const class GALGAS_lstring constinArgument3,
+                                                                          class GALGAS_lstring & outArgument4,
+                                                                          class C_Compiler * inCompiler
+                                                                          COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionSetter_resolveTemplateFileName (const int32_t inClassIndex,
+                                                   extensionSetterSignature_library_resolveTemplateFileName inModifier) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void callExtensionSetter_resolveTemplateFileName (class cPtr_library * inObject,
+                                                  const GALGAS_gtlContext constin_templateContext,
+                                                  const GALGAS_gtlContext constin_context,
+                                                  const GALGAS_gtlData constin_vars,
+                                                  const GALGAS_lstring constin_simpleName,
+                                                  GALGAS_lstring & out_fullName,
+                                                  C_Compiler * inCompiler
+                                                  COMMA_LOCATION_ARGS) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                            Function 'pathWithExtension'                                             *
@@ -6046,6 +6046,10 @@ GALGAS_string function_invokeGTL (GALGAS_gtlString inArgument_rootTemplateFileNa
   }
   GALGAS_gtlTemplateInstruction var_rootTemplateInstruction_1367 = GALGAS_gtlTemplateInstruction::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 45)), GALGAS_string::makeEmptyString (), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 47)), GALGAS_gtlTerminal::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 49)), inArgument_rootTemplateFileName  COMMA_SOURCE_FILE ("gtl_interface.galgas", 48)), GALGAS_bool (false), GALGAS_bool (true), GALGAS_gtlExpressionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 54)), GALGAS_gtlInstructionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 55))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 44)) ;
   callExtensionMethod_execute ((const cPtr_gtlTemplateInstruction *) var_rootTemplateInstruction_1367.ptr (), inArgument_context, inArgument_vars, var_lib_1098, result_result, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 59)) ;
+  const enumGalgasBool test_1 = GALGAS_bool (gOption_gtl_5F_options_profileTemplates.getter_value ()).boolEnum () ;
+  if (kBoolTrue == test_1) {
+    callExtensionMethod_writeTemplateProfile ((const cPtr_library *) var_lib_1098.ptr (), GALGAS_string ("gtl-profile.txt"), GALGAS_string ("gtl-profile.folded"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 67)) ;
+  }
 //---
   return result_result ;
 }
@@ -6101,7 +6105,7 @@ C_galgas_function_descriptor functionDescriptor_invokeGTL ("invokeGTL",
 GALGAS_gtlData function_emptyVarContainer (C_Compiler * inCompiler
                                            COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlData result_result ; // Returned variable
-  result_result = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 73)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 73)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_interface.galgas", 73))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 73)) ;
+  result_result = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 77)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 77)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_interface.galgas", 77))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 77)) ;
 //---
   return result_result ;
 }
@@ -6142,7 +6146,7 @@ GALGAS_gtlString function_lstringToGtlString (GALGAS_lstring inArgument_input,
                                               C_Compiler * inCompiler
                                               COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlString result_output ; // Returned variable
-  result_output = GALGAS_gtlString::constructor_new (inArgument_input.getter_location (SOURCE_FILE ("gtl_interface.galgas", 83)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 83)), inArgument_input.getter_string (SOURCE_FILE ("gtl_interface.galgas", 83))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 83)) ;
+  result_output = GALGAS_gtlString::constructor_new (inArgument_input.getter_location (SOURCE_FILE ("gtl_interface.galgas", 87)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 87)), inArgument_input.getter_string (SOURCE_FILE ("gtl_interface.galgas", 87))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 87)) ;
 //---
   return result_output ;
 }
@@ -6189,7 +6193,7 @@ GALGAS_gtlString function_stringToGtlString (GALGAS_string inArgument_input,
                                              C_Compiler * inCompiler
                                              COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlString result_output ; // Returned variable
-  result_output = GALGAS_gtlString::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 93)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 93)), inArgument_input  COMMA_SOURCE_FILE ("gtl_interface.galgas", 93)) ;
+  result_output = GALGAS_gtlString::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 97)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 97)), inArgument_input  COMMA_SOURCE_FILE ("gtl_interface.galgas", 97)) ;
 //---
   return result_output ;
 }
@@ -6333,7 +6337,7 @@ C_galgas_function_descriptor functionDescriptor_pathWithExtension ("pathWithExte
 GALGAS_library function_emptyLib (C_Compiler * /* inCompiler */
                                   COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_library result_result ; // Returned variable
-  result_result = GALGAS_library::constructor_new (GALGAS_gtlFuncMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_gtlGetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_gtlSetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_gtlTemplateMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 323))  COMMA_SOURCE_FILE ("gtl_types.galgas", 323)) ;
+  result_result = GALGAS_library::constructor_new (GALGAS_gtlFuncMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 398)), GALGAS_gtlGetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 398)), GALGAS_gtlSetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 398)), GALGAS_gtlTemplateMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 398)), GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 398)), GALGAS_gtlTemplatePathMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 399)), GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 399)), GALGAS_timer::constructor_start (SOURCE_FILE ("gtl_types.galgas", 400)), GALGAS_uint ((uint32_t) 0U), GALGAS_string::makeEmptyString (), GALGAS_gtlTemplateProfileMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 400)), GALGAS_gtlFoldedStackMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 400))  COMMA_SOURCE_FILE ("gtl_types.galgas", 397)) ;
 //---
   return result_result ;
 }
@@ -8316,6 +8320,630 @@ static void defineExtensionGetter_gtlGreaterOrEqualExpression_eval (void) {
 
 C_PrologueEpilogue gGetter_gtlGreaterOrEqualExpression_eval (defineExtensionGetter_gtlGreaterOrEqualExpression_eval, NULL) ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                               Function 'intTerminal'                                                *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_bool function_intTerminal (const GALGAS_gtlExpression & constinArgument_expression,
+                                  C_Compiler * /* inCompiler */
+                                  COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_isInt ; // Returned variable
+  result_isInt = GALGAS_bool (false) ;
+  if (constinArgument_expression.isValid ()) {
+    if (constinArgument_expression.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlTerminal) {
+      GALGAS_gtlTerminal cast_38527_terminal ((cPtr_gtlTerminal *) constinArgument_expression.ptr ()) ;
+      result_isInt = GALGAS_bool (cast_38527_terminal.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1263)).dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt) ;
+    }
+  }
+//---
+  return result_isInt ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+//  Function introspection                                                                                             *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static const C_galgas_type_descriptor * functionArgs_intTerminal [2] = {
+  & kTypeDescriptor_GALGAS_gtlExpression,
+  NULL
+} ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_object functionWithGenericHeader_intTerminal (C_Compiler * inCompiler,
+                                                            const cObjectArray & inEffectiveParameterArray,
+                                                            const GALGAS_location & /* inErrorLocation */
+                                                            COMMA_LOCATION_ARGS) {
+  const GALGAS_gtlExpression operand0 = GALGAS_gtlExpression::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                                             inCompiler
+                                                                             COMMA_THERE) ;
+  return function_intTerminal (operand0,
+                               inCompiler
+                               COMMA_THERE).getter_object (THERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_galgas_function_descriptor functionDescriptor_intTerminal ("intTerminal",
+                                                             functionWithGenericHeader_intTerminal,
+                                                             & kTypeDescriptor_GALGAS_bool,
+                                                             1,
+                                                             functionArgs_intTerminal) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                      Extension getter '@gtlExpression folded'                                       *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <enterExtensionGetter_gtlExpression_folded> gExtensionGetterTable_gtlExpression_folded ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_folded (const int32_t inClassIndex,
+                                  enterExtensionGetter_gtlExpression_folded inGetter) {
+  gExtensionGetterTable_gtlExpression_folded.forceObjectAtIndex (inClassIndex, inGetter, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlExpression callExtensionGetter_folded (const cPtr_gtlExpression * inObject,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) {
+  GALGAS_gtlExpression result ;
+//--- Find Reader
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_gtlExpression) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    enterExtensionGetter_gtlExpression_folded f = NULL ;
+    if (classIndex < gExtensionGetterTable_gtlExpression_folded.count ()) {
+      f = gExtensionGetterTable_gtlExpression_folded (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionGetterTable_gtlExpression_folded.count ()) {
+           f = gExtensionGetterTable_gtlExpression_folded (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionGetterTable_gtlExpression_folded.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    if (NULL == f) {
+      fatalError ("FATAL CATEGORY READER CALL ERROR", __FILE__, __LINE__) ;
+    }else{
+      result = f (inObject, inCompiler COMMA_THERE) ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_gtlExpression extensionGetter_gtlExpression_folded (const cPtr_gtlExpression * inObject,
+                                                                  C_Compiler * /* inCompiler */
+                                                                  COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlExpression result_result ; // Returned variable
+  const cPtr_gtlExpression * object = inObject ;
+  macroValidSharedObject (object, cPtr_gtlExpression) ;
+  const GALGAS_gtlExpression temp_0 = object ;
+  result_result = temp_0 ;
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlExpression_folded (void) {
+  enterExtensionGetter_folded (kTypeDescriptor_GALGAS_gtlExpression.mSlotID,
+                               extensionGetter_gtlExpression_folded) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionGetter_gtlExpression_folded (void) {
+  gExtensionGetterTable_gtlExpression_folded.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlExpression_folded (defineExtensionGetter_gtlExpression_folded,
+                                                 freeExtensionGetter_gtlExpression_folded) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                  Extension getter '@gtlExpression foldedTerminal'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <enterExtensionGetter_gtlExpression_foldedTerminal> gExtensionGetterTable_gtlExpression_foldedTerminal ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_foldedTerminal (const int32_t inClassIndex,
+                                          enterExtensionGetter_gtlExpression_foldedTerminal inGetter) {
+  gExtensionGetterTable_gtlExpression_foldedTerminal.forceObjectAtIndex (inClassIndex, inGetter, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_gtlExpression callExtensionGetter_foldedTerminal (const cPtr_gtlExpression * inObject,
+                                                         C_Compiler * inCompiler
+                                                         COMMA_LOCATION_ARGS) {
+  GALGAS_gtlExpression result ;
+//--- Find Reader
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_gtlExpression) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    enterExtensionGetter_gtlExpression_foldedTerminal f = NULL ;
+    if (classIndex < gExtensionGetterTable_gtlExpression_foldedTerminal.count ()) {
+      f = gExtensionGetterTable_gtlExpression_foldedTerminal (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionGetterTable_gtlExpression_foldedTerminal.count ()) {
+           f = gExtensionGetterTable_gtlExpression_foldedTerminal (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionGetterTable_gtlExpression_foldedTerminal.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    if (NULL == f) {
+      fatalError ("FATAL CATEGORY READER CALL ERROR", __FILE__, __LINE__) ;
+    }else{
+      result = f (inObject, inCompiler COMMA_THERE) ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_gtlExpression extensionGetter_gtlExpression_foldedTerminal (const cPtr_gtlExpression * inObject,
+                                                                          C_Compiler * inCompiler
+                                                                          COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlExpression result_result ; // Returned variable
+  const cPtr_gtlExpression * object = inObject ;
+  macroValidSharedObject (object, cPtr_gtlExpression) ;
+  const GALGAS_gtlExpression temp_0 = object ;
+  result_result = GALGAS_gtlTerminal::constructor_new (object->mProperty_where, callExtensionGetter_eval ((const cPtr_gtlExpression *) temp_0.ptr (), function_emptyContext (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)), GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1282))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)), function_emptyLib (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1283)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1280))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1278)) ;
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlExpression_foldedTerminal (void) {
+  enterExtensionGetter_foldedTerminal (kTypeDescriptor_GALGAS_gtlExpression.mSlotID,
+                                       extensionGetter_gtlExpression_foldedTerminal) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionGetter_gtlExpression_foldedTerminal (void) {
+  gExtensionGetterTable_gtlExpression_foldedTerminal.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlExpression_foldedTerminal (defineExtensionGetter_gtlExpression_foldedTerminal,
+                                                         freeExtensionGetter_gtlExpression_foldedTerminal) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                              Overriding extension getter '@gtlUnaryExpression folded'                               *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_gtlExpression extensionGetter_gtlUnaryExpression_folded (const cPtr_gtlExpression * inObject,
+                                                                       C_Compiler * inCompiler
+                                                                       COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlExpression result_result ; // Returned variable
+  const cPtr_gtlUnaryExpression * object = (const cPtr_gtlUnaryExpression *) inObject ;
+  macroValidSharedObject (object, cPtr_gtlUnaryExpression) ;
+  const enumGalgasBool test_0 = function_intTerminal (object->mProperty_son, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1291)).boolEnum () ;
+  if (kBoolTrue == test_0) {
+    const GALGAS_gtlUnaryExpression temp_1 = object ;
+    result_result = callExtensionGetter_foldedTerminal ((const cPtr_gtlExpression *) temp_1.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1292)) ;
+  }else if (kBoolFalse == test_0) {
+    const GALGAS_gtlUnaryExpression temp_2 = object ;
+    result_result = temp_2 ;
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlUnaryExpression_folded (void) {
+  enterExtensionGetter_folded (kTypeDescriptor_GALGAS_gtlUnaryExpression.mSlotID,
+                               extensionGetter_gtlUnaryExpression_folded) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlUnaryExpression_folded (defineExtensionGetter_gtlUnaryExpression_folded, NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                   Extension getter '@gtlBinaryExpression mayFold'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <enterExtensionGetter_gtlBinaryExpression_mayFold> gExtensionGetterTable_gtlBinaryExpression_mayFold ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_mayFold (const int32_t inClassIndex,
+                                   enterExtensionGetter_gtlBinaryExpression_mayFold inGetter) {
+  gExtensionGetterTable_gtlBinaryExpression_mayFold.forceObjectAtIndex (inClassIndex, inGetter, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_bool callExtensionGetter_mayFold (const cPtr_gtlBinaryExpression * inObject,
+                                         C_Compiler * inCompiler
+                                         COMMA_LOCATION_ARGS) {
+  GALGAS_bool result ;
+//--- Find Reader
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_gtlBinaryExpression) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    enterExtensionGetter_gtlBinaryExpression_mayFold f = NULL ;
+    if (classIndex < gExtensionGetterTable_gtlBinaryExpression_mayFold.count ()) {
+      f = gExtensionGetterTable_gtlBinaryExpression_mayFold (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionGetterTable_gtlBinaryExpression_mayFold.count ()) {
+           f = gExtensionGetterTable_gtlBinaryExpression_mayFold (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionGetterTable_gtlBinaryExpression_mayFold.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    if (NULL == f) {
+      fatalError ("FATAL CATEGORY READER CALL ERROR", __FILE__, __LINE__) ;
+    }else{
+      result = f (inObject, inCompiler COMMA_THERE) ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_bool extensionGetter_gtlBinaryExpression_mayFold (const cPtr_gtlBinaryExpression * inObject,
+                                                                C_Compiler * inCompiler
+                                                                COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_result ; // Returned variable
+  const cPtr_gtlBinaryExpression * object = inObject ;
+  macroValidSharedObject (object, cPtr_gtlBinaryExpression) ;
+  GALGAS_bool test_0 = function_intTerminal (object->mProperty_lSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1302)) ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = function_intTerminal (object->mProperty_rSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1302)) ;
+  }
+  result_result = test_0 ;
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlBinaryExpression_mayFold (void) {
+  enterExtensionGetter_mayFold (kTypeDescriptor_GALGAS_gtlBinaryExpression.mSlotID,
+                                extensionGetter_gtlBinaryExpression_mayFold) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionGetter_gtlBinaryExpression_mayFold (void) {
+  gExtensionGetterTable_gtlBinaryExpression_mayFold.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlBinaryExpression_mayFold (defineExtensionGetter_gtlBinaryExpression_mayFold,
+                                                        freeExtensionGetter_gtlBinaryExpression_mayFold) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                              Overriding extension getter '@gtlBinaryExpression folded'                              *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_gtlExpression extensionGetter_gtlBinaryExpression_folded (const cPtr_gtlExpression * inObject,
+                                                                        C_Compiler * inCompiler
+                                                                        COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlExpression result_result ; // Returned variable
+  const cPtr_gtlBinaryExpression * object = (const cPtr_gtlBinaryExpression *) inObject ;
+  macroValidSharedObject (object, cPtr_gtlBinaryExpression) ;
+  const GALGAS_gtlBinaryExpression temp_0 = object ;
+  const enumGalgasBool test_1 = callExtensionGetter_mayFold ((const cPtr_gtlBinaryExpression *) temp_0.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1308)).boolEnum () ;
+  if (kBoolTrue == test_1) {
+    const GALGAS_gtlBinaryExpression temp_2 = object ;
+    result_result = callExtensionGetter_foldedTerminal ((const cPtr_gtlExpression *) temp_2.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1309)) ;
+  }else if (kBoolFalse == test_1) {
+    const GALGAS_gtlBinaryExpression temp_3 = object ;
+    result_result = temp_3 ;
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlBinaryExpression_folded (void) {
+  enterExtensionGetter_folded (kTypeDescriptor_GALGAS_gtlBinaryExpression.mSlotID,
+                               extensionGetter_gtlBinaryExpression_folded) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlBinaryExpression_folded (defineExtensionGetter_gtlBinaryExpression_folded, NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                Extension getter '@gtlBinaryExpression rightIntValue'                                *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static TC_UniqueArray <enterExtensionGetter_gtlBinaryExpression_rightIntValue> gExtensionGetterTable_gtlBinaryExpression_rightIntValue ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_rightIntValue (const int32_t inClassIndex,
+                                         enterExtensionGetter_gtlBinaryExpression_rightIntValue inGetter) {
+  gExtensionGetterTable_gtlBinaryExpression_rightIntValue.forceObjectAtIndex (inClassIndex, inGetter, NULL COMMA_HERE) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_bigint callExtensionGetter_rightIntValue (const cPtr_gtlBinaryExpression * inObject,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) {
+  GALGAS_bigint result ;
+//--- Find Reader
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_gtlBinaryExpression) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    enterExtensionGetter_gtlBinaryExpression_rightIntValue f = NULL ;
+    if (classIndex < gExtensionGetterTable_gtlBinaryExpression_rightIntValue.count ()) {
+      f = gExtensionGetterTable_gtlBinaryExpression_rightIntValue (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionGetterTable_gtlBinaryExpression_rightIntValue.count ()) {
+           f = gExtensionGetterTable_gtlBinaryExpression_rightIntValue (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionGetterTable_gtlBinaryExpression_rightIntValue.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    if (NULL == f) {
+      fatalError ("FATAL CATEGORY READER CALL ERROR", __FILE__, __LINE__) ;
+    }else{
+      result = f (inObject, inCompiler COMMA_THERE) ;
+    }
+  }
+  return result ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_bigint extensionGetter_gtlBinaryExpression_rightIntValue (const cPtr_gtlBinaryExpression * inObject,
+                                                                        C_Compiler * inCompiler
+                                                                        COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bigint result_result ; // Returned variable
+  const cPtr_gtlBinaryExpression * object = inObject ;
+  macroValidSharedObject (object, cPtr_gtlBinaryExpression) ;
+  GALGAS_gtlTerminal temp_0 ;
+  if (object->mProperty_rSon.isValid ()) {
+    if (NULL != dynamic_cast <const cPtr_gtlTerminal *> (object->mProperty_rSon.ptr ())) {
+      temp_0 = (cPtr_gtlTerminal *) object->mProperty_rSon.ptr () ;
+    }else{
+      inCompiler->castError ("gtlTerminal", object->mProperty_rSon.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1319)) ;
+    }
+  }
+  GALGAS_gtlInt temp_1 ;
+  if (temp_0.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1319)).isValid ()) {
+    if (NULL != dynamic_cast <const cPtr_gtlInt *> (temp_0.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1319)).ptr ())) {
+      temp_1 = (cPtr_gtlInt *) temp_0.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1319)).ptr () ;
+    }else{
+      inCompiler->castError ("gtlInt", temp_0.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1319)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1319)) ;
+    }
+  }
+  result_result = temp_1.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1319)) ;
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlBinaryExpression_rightIntValue (void) {
+  enterExtensionGetter_rightIntValue (kTypeDescriptor_GALGAS_gtlBinaryExpression.mSlotID,
+                                      extensionGetter_gtlBinaryExpression_rightIntValue) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void freeExtensionGetter_gtlBinaryExpression_rightIntValue (void) {
+  gExtensionGetterTable_gtlBinaryExpression_rightIntValue.free () ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlBinaryExpression_rightIntValue (defineExtensionGetter_gtlBinaryExpression_rightIntValue,
+                                                              freeExtensionGetter_gtlBinaryExpression_rightIntValue) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                             Overriding extension getter '@gtlDivideExpression mayFold'                              *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_bool extensionGetter_gtlDivideExpression_mayFold (const cPtr_gtlBinaryExpression * inObject,
+                                                                C_Compiler * inCompiler
+                                                                COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_result ; // Returned variable
+  const cPtr_gtlDivideExpression * object = (const cPtr_gtlDivideExpression *) inObject ;
+  macroValidSharedObject (object, cPtr_gtlDivideExpression) ;
+  GALGAS_bool test_0 = function_intTerminal (object->mProperty_lSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1325)) ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = function_intTerminal (object->mProperty_rSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1325)) ;
+  }
+  result_result = test_0 ;
+  const enumGalgasBool test_1 = result_result.boolEnum () ;
+  if (kBoolTrue == test_1) {
+    const GALGAS_gtlDivideExpression temp_2 = object ;
+    result_result = GALGAS_bool (kIsNotEqual, callExtensionGetter_rightIntValue ((const cPtr_gtlBinaryExpression *) temp_2.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1327)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1327)))) ;
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlDivideExpression_mayFold (void) {
+  enterExtensionGetter_mayFold (kTypeDescriptor_GALGAS_gtlDivideExpression.mSlotID,
+                                extensionGetter_gtlDivideExpression_mayFold) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlDivideExpression_mayFold (defineExtensionGetter_gtlDivideExpression_mayFold, NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                             Overriding extension getter '@gtlModulusExpression mayFold'                             *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_bool extensionGetter_gtlModulusExpression_mayFold (const cPtr_gtlBinaryExpression * inObject,
+                                                                 C_Compiler * inCompiler
+                                                                 COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_result ; // Returned variable
+  const cPtr_gtlModulusExpression * object = (const cPtr_gtlModulusExpression *) inObject ;
+  macroValidSharedObject (object, cPtr_gtlModulusExpression) ;
+  GALGAS_bool test_0 = function_intTerminal (object->mProperty_lSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1334)) ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = function_intTerminal (object->mProperty_rSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1334)) ;
+  }
+  result_result = test_0 ;
+  const enumGalgasBool test_1 = result_result.boolEnum () ;
+  if (kBoolTrue == test_1) {
+    const GALGAS_gtlModulusExpression temp_2 = object ;
+    result_result = GALGAS_bool (kIsNotEqual, callExtensionGetter_rightIntValue ((const cPtr_gtlBinaryExpression *) temp_2.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1336)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1336)))) ;
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlModulusExpression_mayFold (void) {
+  enterExtensionGetter_mayFold (kTypeDescriptor_GALGAS_gtlModulusExpression.mSlotID,
+                                extensionGetter_gtlModulusExpression_mayFold) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlModulusExpression_mayFold (defineExtensionGetter_gtlModulusExpression_mayFold, NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                            Overriding extension getter '@gtlShiftLeftExpression mayFold'                            *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_bool extensionGetter_gtlShiftLeftExpression_mayFold (const cPtr_gtlBinaryExpression * inObject,
+                                                                   C_Compiler * inCompiler
+                                                                   COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_result ; // Returned variable
+  const cPtr_gtlShiftLeftExpression * object = (const cPtr_gtlShiftLeftExpression *) inObject ;
+  macroValidSharedObject (object, cPtr_gtlShiftLeftExpression) ;
+  GALGAS_bool test_0 = function_intTerminal (object->mProperty_lSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1343)) ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = function_intTerminal (object->mProperty_rSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1343)) ;
+  }
+  result_result = test_0 ;
+  const enumGalgasBool test_1 = result_result.boolEnum () ;
+  if (kBoolTrue == test_1) {
+    const GALGAS_gtlShiftLeftExpression temp_2 = object ;
+    result_result = GALGAS_bool (kIsSupOrEqual, callExtensionGetter_rightIntValue ((const cPtr_gtlBinaryExpression *) temp_2.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1345)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1345)))) ;
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlShiftLeftExpression_mayFold (void) {
+  enterExtensionGetter_mayFold (kTypeDescriptor_GALGAS_gtlShiftLeftExpression.mSlotID,
+                                extensionGetter_gtlShiftLeftExpression_mayFold) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlShiftLeftExpression_mayFold (defineExtensionGetter_gtlShiftLeftExpression_mayFold, NULL) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                           Overriding extension getter '@gtlShiftRightExpression mayFold'                            *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+static GALGAS_bool extensionGetter_gtlShiftRightExpression_mayFold (const cPtr_gtlBinaryExpression * inObject,
+                                                                    C_Compiler * inCompiler
+                                                                    COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_result ; // Returned variable
+  const cPtr_gtlShiftRightExpression * object = (const cPtr_gtlShiftRightExpression *) inObject ;
+  macroValidSharedObject (object, cPtr_gtlShiftRightExpression) ;
+  GALGAS_bool test_0 = function_intTerminal (object->mProperty_lSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1352)) ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = function_intTerminal (object->mProperty_rSon, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1352)) ;
+  }
+  result_result = test_0 ;
+  const enumGalgasBool test_1 = result_result.boolEnum () ;
+  if (kBoolTrue == test_1) {
+    const GALGAS_gtlShiftRightExpression temp_2 = object ;
+    result_result = GALGAS_bool (kIsSupOrEqual, callExtensionGetter_rightIntValue ((const cPtr_gtlBinaryExpression *) temp_2.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1354)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1354)))) ;
+  }
+//---
+  return result_result ;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+static void defineExtensionGetter_gtlShiftRightExpression_mayFold (void) {
+  enterExtensionGetter_mayFold (kTypeDescriptor_GALGAS_gtlShiftRightExpression.mSlotID,
+                                extensionGetter_gtlShiftRightExpression_mayFold) ;
+}
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+C_PrologueEpilogue gGetter_gtlShiftRightExpression_mayFold (defineExtensionGetter_gtlShiftRightExpression_mayFold, NULL) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                             Overriding extension getter '@gtlGetterCallExpression eval'                             *
@@ -8331,14 +8959,14 @@ static GALGAS_gtlData extensionGetter_gtlGetterCallExpression_eval (const cPtr_g
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlGetterCallExpression * object = (const cPtr_gtlGetterCallExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlGetterCallExpression) ;
-  GALGAS_gtlDataList var_dataArguments_38461 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1265)) ;
-  cEnumerator_gtlExpressionList enumerator_38496 (object->mProperty_arguments, kENUMERATION_UP) ;
-  while (enumerator_38496.hasCurrentObject ()) {
-    var_dataArguments_38461.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_38496.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1267))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1267)) ;
-    enumerator_38496.gotoNextObject () ;
+  GALGAS_gtlDataList var_dataArguments_41134 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1373)) ;
+  cEnumerator_gtlExpressionList enumerator_41169 (object->mProperty_arguments, kENUMERATION_UP) ;
+  while (enumerator_41169.hasCurrentObject ()) {
+    var_dataArguments_41134.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_41169.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1375))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1375)) ;
+    enumerator_41169.gotoNextObject () ;
   }
-  GALGAS_gtlData var_targetData_38587 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_target.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1269)) ;
-  result_result = callExtensionGetter_performGetter ((const cPtr_gtlData *) var_targetData_38587.ptr (), object->mProperty_getterName, var_dataArguments_38461, constinArgument_context, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1270)) ;
+  GALGAS_gtlData var_targetData_41260 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_target.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1377)) ;
+  result_result = callExtensionGetter_performGetter ((const cPtr_gtlData *) var_targetData_41260.ptr (), object->mProperty_getterName, var_dataArguments_41134, constinArgument_context, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1378)) ;
 //---
   return result_result ;
 }
@@ -8367,10 +8995,10 @@ void routine_checkArgumentError (const GALGAS_lstring constinArgument_name,
                                  const GALGAS_uint constinArgument_argumentNum,
                                  C_Compiler * inCompiler
                                  COMMA_UNUSED_LOCATION_ARGS) {
-  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, constinArgument_formalType.objectCompare (callExtensionGetter_embeddedType ((const cPtr_gtlData *) constinArgument_actualArgument.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1280)))).boolEnum () ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, constinArgument_formalType.objectCompare (callExtensionGetter_embeddedType ((const cPtr_gtlData *) constinArgument_actualArgument.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1388)))).boolEnum () ;
   if (kBoolTrue == test_0) {
     TC_Array <C_FixItDescription> fixItArray1 ;
-    inCompiler->emitSemanticError (constinArgument_name.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1281)), extensionGetter_typeName (constinArgument_formalType, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)).add_operation (GALGAS_string (" expected for argument "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)).add_operation (constinArgument_argumentNum.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1281)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)).add_operation (GALGAS_string (", "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)).add_operation (extensionGetter_typeName (constinArgument_actualArgument.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1282)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)) ;
+    inCompiler->emitSemanticError (constinArgument_name.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1389)), extensionGetter_typeName (constinArgument_formalType, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1389)).add_operation (GALGAS_string (" expected for argument "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1389)).add_operation (constinArgument_argumentNum.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1389)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1389)).add_operation (GALGAS_string (", "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1390)).add_operation (extensionGetter_typeName (constinArgument_actualArgument.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1390)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1390)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1390)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1390)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1389)) ;
   }
 }
 
@@ -8386,30 +9014,30 @@ GALGAS_gtlData function_validateReturnValue (const GALGAS_lstring & constinArgum
                                              C_Compiler * inCompiler
                                              COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlData result_result ; // Returned variable
-  GALGAS_type var_returnedType_39188 = constinArgument_returnedValue.getter_objectDynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1292)) ;
-  GALGAS_location var_loc_39240 = constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1293)) ;
-  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_bigint))).boolEnum () ;
+  GALGAS_type var_returnedType_41861 = constinArgument_returnedValue.getter_objectDynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1400)) ;
+  GALGAS_location var_loc_41913 = constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1401)) ;
+  const enumGalgasBool test_0 = GALGAS_bool (kIsEqual, var_returnedType_41861.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_bigint))).boolEnum () ;
   if (kBoolTrue == test_0) {
-    result_result = GALGAS_gtlInt::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1295)), GALGAS_bigint::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1295))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1295)) ;
+    result_result = GALGAS_gtlInt::constructor_new (var_loc_41913, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1403)), GALGAS_bigint::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1403))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1403)) ;
   }else if (kBoolFalse == test_0) {
-    const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_double))).boolEnum () ;
+    const enumGalgasBool test_2 = GALGAS_bool (kIsEqual, var_returnedType_41861.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_double))).boolEnum () ;
     if (kBoolTrue == test_2) {
-      result_result = GALGAS_gtlFloat::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1297)), GALGAS_double::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1297))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1297)) ;
+      result_result = GALGAS_gtlFloat::constructor_new (var_loc_41913, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1405)), GALGAS_double::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1405))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1405)) ;
     }else if (kBoolFalse == test_2) {
-      const enumGalgasBool test_4 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_string))).boolEnum () ;
+      const enumGalgasBool test_4 = GALGAS_bool (kIsEqual, var_returnedType_41861.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_string))).boolEnum () ;
       if (kBoolTrue == test_4) {
-        result_result = GALGAS_gtlString::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299)), GALGAS_string::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299)) ;
+        result_result = GALGAS_gtlString::constructor_new (var_loc_41913, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1407)), GALGAS_string::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1407))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1407)) ;
       }else if (kBoolFalse == test_4) {
-        const enumGalgasBool test_6 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_bool))).boolEnum () ;
+        const enumGalgasBool test_6 = GALGAS_bool (kIsEqual, var_returnedType_41861.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_bool))).boolEnum () ;
         if (kBoolTrue == test_6) {
-          result_result = GALGAS_gtlBool::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1301)), GALGAS_bool::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1301))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1301)) ;
+          result_result = GALGAS_gtlBool::constructor_new (var_loc_41913, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1409)), GALGAS_bool::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1409))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1409)) ;
         }else if (kBoolFalse == test_6) {
-          const enumGalgasBool test_8 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_list))).boolEnum () ;
+          const enumGalgasBool test_8 = GALGAS_bool (kIsEqual, var_returnedType_41861.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_list))).boolEnum () ;
           if (kBoolTrue == test_8) {
-            result_result = GALGAS_gtlList::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1303)), GALGAS_list::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1303))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1303)) ;
+            result_result = GALGAS_gtlList::constructor_new (var_loc_41913, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1411)), GALGAS_list::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1411))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1411)) ;
           }else if (kBoolFalse == test_8) {
             TC_Array <C_FixItDescription> fixItArray10 ;
-            inCompiler->emitSemanticError (constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1305)), GALGAS_string ("this function does not return a compatible type"), fixItArray10  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1305)) ;
+            inCompiler->emitSemanticError (constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1413)), GALGAS_string ("this function does not return a compatible type"), fixItArray10  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1413)) ;
             result_result.drop () ; // Release error dropped variable
           }
         }
@@ -8472,68 +9100,68 @@ static GALGAS_gtlData extensionGetter_gtlFunctionCallExpression_eval (const cPtr
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlFunctionCallExpression * object = (const cPtr_gtlFunctionCallExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlFunctionCallExpression) ;
-  GALGAS_uint var_currentErrorCount_40468 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1324)) ;
-  const enumGalgasBool test_0 = GALGAS_function::constructor_isFunctionDefined (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1326))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1326)).boolEnum () ;
+  GALGAS_uint var_currentErrorCount_43141 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1432)) ;
+  const enumGalgasBool test_0 = GALGAS_function::constructor_isFunctionDefined (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1434))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1434)).boolEnum () ;
   if (kBoolTrue == test_0) {
-    GALGAS_objectlist var_arguments_40605 = GALGAS_objectlist::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1328)) ;
-    GALGAS_gtlDataList var_dataArguments_40649 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1329)) ;
-    cEnumerator_gtlExpressionList enumerator_40695 (object->mProperty_functionArguments, kENUMERATION_UP) ;
-    while (enumerator_40695.hasCurrentObject ()) {
-      GALGAS_gtlData var_arg_40717 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_40695.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1332)) ;
-      var_dataArguments_40649.addAssign_operation (var_arg_40717  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1333)) ;
-      callExtensionMethod_addMyValue ((const cPtr_gtlData *) var_arg_40717.ptr (), var_arguments_40605, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1334)) ;
-      enumerator_40695.gotoNextObject () ;
+    GALGAS_objectlist var_arguments_43278 = GALGAS_objectlist::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1436)) ;
+    GALGAS_gtlDataList var_dataArguments_43322 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1437)) ;
+    cEnumerator_gtlExpressionList enumerator_43368 (object->mProperty_functionArguments, kENUMERATION_UP) ;
+    while (enumerator_43368.hasCurrentObject ()) {
+      GALGAS_gtlData var_arg_43390 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_43368.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1440)) ;
+      var_dataArguments_43322.addAssign_operation (var_arg_43390  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1441)) ;
+      callExtensionMethod_addMyValue ((const cPtr_gtlData *) var_arg_43390.ptr (), var_arguments_43278, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1442)) ;
+      enumerator_43368.gotoNextObject () ;
     }
-    GALGAS_function var_function_40856 = GALGAS_function::constructor_functionWithName (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1337))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1337)) ;
-    GALGAS_typelist var_formalParameterList_40942 = var_function_40856.getter_formalParameterTypeList (SOURCE_FILE ("gtl_expressions.galgas", 1339)) ;
-    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1340)).objectCompare (var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1340)))).boolEnum () ;
+    GALGAS_function var_function_43529 = GALGAS_function::constructor_functionWithName (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1445))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1445)) ;
+    GALGAS_typelist var_formalParameterList_43615 = var_function_43529.getter_formalParameterTypeList (SOURCE_FILE ("gtl_expressions.galgas", 1447)) ;
+    const enumGalgasBool test_1 = GALGAS_bool (kIsNotEqual, var_formalParameterList_43615.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1448)).objectCompare (var_arguments_43278.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1448)))).boolEnum () ;
     if (kBoolTrue == test_1) {
       GALGAS_string temp_2 ;
-      const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1343)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
+      const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_arguments_43278.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1451)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
       if (kBoolTrue == test_3) {
         temp_2 = GALGAS_string ("s") ;
       }else if (kBoolFalse == test_3) {
         temp_2 = GALGAS_string::makeEmptyString () ;
       }
       GALGAS_string temp_4 ;
-      const enumGalgasBool test_5 = GALGAS_bool (kIsStrictSup, var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1345)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
+      const enumGalgasBool test_5 = GALGAS_bool (kIsStrictSup, var_formalParameterList_43615.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1453)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
       if (kBoolTrue == test_5) {
         temp_4 = GALGAS_string ("s") ;
       }else if (kBoolFalse == test_5) {
         temp_4 = GALGAS_string::makeEmptyString () ;
       }
       TC_Array <C_FixItDescription> fixItArray6 ;
-      inCompiler->emitSemanticError (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1341)), GALGAS_string ("this function is invoked with ").add_operation (var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1342)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1341)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1341)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1342)).add_operation (temp_2, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1342)).add_operation (GALGAS_string (", but requires "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1343)).add_operation (var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1344)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1344)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1344)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1344)).add_operation (temp_4, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1344)), fixItArray6  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1341)) ;
+      inCompiler->emitSemanticError (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1449)), GALGAS_string ("this function is invoked with ").add_operation (var_arguments_43278.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1450)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1449)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1449)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1450)).add_operation (temp_2, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1450)).add_operation (GALGAS_string (", but requires "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1451)).add_operation (var_formalParameterList_43615.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1452)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1452)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1452)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1452)).add_operation (temp_4, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1452)), fixItArray6  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1449)) ;
       result_result.drop () ; // Release error dropped variable
     }else if (kBoolFalse == test_1) {
-      cEnumerator_typelist enumerator_41409 (var_formalParameterList_40942, kENUMERATION_UP) ;
-      cEnumerator_gtlDataList enumerator_41436 (var_dataArguments_40649, kENUMERATION_UP) ;
-      GALGAS_uint index_41377 ((uint32_t) 0) ;
-      while (enumerator_41409.hasCurrentObject () && enumerator_41436.hasCurrentObject ()) {
+      cEnumerator_typelist enumerator_44082 (var_formalParameterList_43615, kENUMERATION_UP) ;
+      cEnumerator_gtlDataList enumerator_44109 (var_dataArguments_43322, kENUMERATION_UP) ;
+      GALGAS_uint index_44050 ((uint32_t) 0) ;
+      while (enumerator_44082.hasCurrentObject () && enumerator_44109.hasCurrentObject ()) {
         {
-        routine_checkArgumentError (object->mProperty_functionName, enumerator_41409.current_mValue (HERE), enumerator_41436.current_data (HERE), index_41377, inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1349)) ;
+        routine_checkArgumentError (object->mProperty_functionName, enumerator_44082.current_mValue (HERE), enumerator_44109.current_data (HERE), index_44050, inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1457)) ;
         }
-        enumerator_41409.gotoNextObject () ;
-        enumerator_41436.gotoNextObject () ;
-        index_41377.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1348)) ;
+        enumerator_44082.gotoNextObject () ;
+        enumerator_44109.gotoNextObject () ;
+        index_44050.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1456)) ;
       }
-      const enumGalgasBool test_7 = GALGAS_bool (kIsEqual, var_currentErrorCount_40468.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1351)))).boolEnum () ;
+      const enumGalgasBool test_7 = GALGAS_bool (kIsEqual, var_currentErrorCount_43141.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1459)))).boolEnum () ;
       if (kBoolTrue == test_7) {
-        GALGAS_object var_returnedValue_41608 = var_function_40856.getter_invoke (var_arguments_40605, object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1353)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1353)) ;
-        result_result = function_validateReturnValue (object->mProperty_functionName, var_returnedValue_41608, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1354)) ;
+        GALGAS_object var_returnedValue_44281 = var_function_43529.getter_invoke (var_arguments_43278, object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1461)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1461)) ;
+        result_result = function_validateReturnValue (object->mProperty_functionName, var_returnedValue_44281, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1462)) ;
       }else if (kBoolFalse == test_7) {
-        result_result = GALGAS_gtlUnconstructed::constructor_new (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1357)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1358))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1356)) ;
+        result_result = GALGAS_gtlUnconstructed::constructor_new (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1465)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1466))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1464)) ;
       }
     }
   }else if (kBoolFalse == test_0) {
-    GALGAS_gtlFunction var_function_41916 = callExtensionGetter_getFunction ((const cPtr_library *) constinArgument_lib.ptr (), object->mProperty_functionName, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1363)) ;
-    GALGAS_gtlDataList var_arguments_41977 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1364)) ;
-    cEnumerator_gtlExpressionList enumerator_42022 (object->mProperty_functionArguments, kENUMERATION_UP) ;
-    while (enumerator_42022.hasCurrentObject ()) {
-      var_arguments_41977.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_42022.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1366))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1366)) ;
-      enumerator_42022.gotoNextObject () ;
+    GALGAS_gtlFunction var_function_44589 = callExtensionGetter_getFunction ((const cPtr_library *) constinArgument_lib.ptr (), object->mProperty_functionName, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1471)) ;
+    GALGAS_gtlDataList var_arguments_44650 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1472)) ;
+    cEnumerator_gtlExpressionList enumerator_44695 (object->mProperty_functionArguments, kENUMERATION_UP) ;
+    while (enumerator_44695.hasCurrentObject ()) {
+      var_arguments_44650.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_44695.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1474))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1474)) ;
+      enumerator_44695.gotoNextObject () ;
     }
-    result_result = callExtensionGetter_call ((const cPtr_gtlFunction *) var_function_41916.ptr (), object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1368)), constinArgument_context, constinArgument_lib, var_arguments_41977, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1368)) ;
+    result_result = callExtensionGetter_call ((const cPtr_gtlFunction *) var_function_44589.ptr (), object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1476)), constinArgument_context, constinArgument_lib, var_arguments_44650, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1476)) ;
   }
 //---
   return result_result ;
@@ -8566,7 +9194,7 @@ static GALGAS_gtlData extensionGetter_gtlExistsExpression_eval (const cPtr_gtlEx
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlExistsExpression * object = (const cPtr_gtlExistsExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExistsExpression) ;
-  result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1386)), extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1386))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1385)) ;
+  result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1494)), extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1494))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1493)) ;
 //---
   return result_result ;
 }
@@ -8598,11 +9226,11 @@ static GALGAS_gtlData extensionGetter_gtlExistsDefaultExpression_eval (const cPt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlExistsDefaultExpression * object = (const cPtr_gtlExistsDefaultExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExistsDefaultExpression) ;
-  const enumGalgasBool test_0 = extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1404)).boolEnum () ;
+  const enumGalgasBool test_0 = extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1512)).boolEnum () ;
   if (kBoolTrue == test_0) {
-    result_result = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1405)) ;
+    result_result = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1513)) ;
   }else if (kBoolFalse == test_0) {
-    result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_defaultValue.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1407)) ;
+    result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_defaultValue.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1515)) ;
   }
 //---
   return result_result ;
@@ -8635,8 +9263,8 @@ static GALGAS_gtlData extensionGetter_gtlTypeOfExpression_eval (const cPtr_gtlEx
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlTypeOfExpression * object = (const cPtr_gtlTypeOfExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlTypeOfExpression) ;
-  GALGAS_gtlData var_variableValue_43873 = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1424)) ;
-  result_result = GALGAS_gtlType::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1425)), var_variableValue_43873.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1425))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1425)) ;
+  GALGAS_gtlData var_variableValue_46546 = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1532)) ;
+  result_result = GALGAS_gtlType::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1533)), var_variableValue_46546.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1533))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1533)) ;
 //---
   return result_result ;
 }
@@ -8668,14 +9296,14 @@ static GALGAS_gtlData extensionGetter_gtlMapOfStructExpression_eval (const cPtr_
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlMapOfStructExpression * object = (const cPtr_gtlMapOfStructExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMapOfStructExpression) ;
-  GALGAS_gtlData var_expressionValue_44465 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1441)) ;
-  if (var_expressionValue_44465.isValid ()) {
-    if (var_expressionValue_44465.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct) {
-      GALGAS_gtlStruct cast_44571_expressionValueStruct ((cPtr_gtlStruct *) var_expressionValue_44465.ptr ()) ;
-      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1446)), cast_44571_expressionValueStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1447))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1444)) ;
+  GALGAS_gtlData var_expressionValue_47138 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1549)) ;
+  if (var_expressionValue_47138.isValid ()) {
+    if (var_expressionValue_47138.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct) {
+      GALGAS_gtlStruct cast_47244_expressionValueStruct ((cPtr_gtlStruct *) var_expressionValue_47138.ptr ()) ;
+      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1554)), cast_47244_expressionValueStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1555))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1552)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray0 ;
-      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1450)) ;
+      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1558)) ;
       result_result.drop () ; // Release error dropped variable
     }
   }
@@ -8710,40 +9338,40 @@ static GALGAS_gtlData extensionGetter_gtlMapOfListExpression_eval (const cPtr_gt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlMapOfListExpression * object = (const cPtr_gtlMapOfListExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMapOfListExpression) ;
-  GALGAS_gtlData var_expressionValue_45211 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1467)) ;
-  if (var_expressionValue_45211.isValid ()) {
-    if (var_expressionValue_45211.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
-      GALGAS_gtlList cast_45313_expressionValueList ((cPtr_gtlList *) var_expressionValue_45211.ptr ()) ;
-      GALGAS_gtlVarMap var_resultMap_45339 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1470)) ;
-      cEnumerator_list enumerator_45397 (cast_45313_expressionValueList.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1471)), kENUMERATION_UP) ;
-      GALGAS_uint index_45359 ((uint32_t) 0) ;
-      while (enumerator_45397.hasCurrentObject ()) {
-        if (enumerator_45397.current_value (HERE).isValid ()) {
-          if (enumerator_45397.current_value (HERE).dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct) {
-            GALGAS_gtlStruct cast_45460_itemStruct ((cPtr_gtlStruct *) enumerator_45397.current_value (HERE).ptr ()) ;
-            const enumGalgasBool test_0 = cast_45460_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1474)).getter_hasKey (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1474)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1474)).boolEnum () ;
+  GALGAS_gtlData var_expressionValue_47884 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1575)) ;
+  if (var_expressionValue_47884.isValid ()) {
+    if (var_expressionValue_47884.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
+      GALGAS_gtlList cast_47986_expressionValueList ((cPtr_gtlList *) var_expressionValue_47884.ptr ()) ;
+      GALGAS_gtlVarMap var_resultMap_48012 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1578)) ;
+      cEnumerator_list enumerator_48070 (cast_47986_expressionValueList.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1579)), kENUMERATION_UP) ;
+      GALGAS_uint index_48032 ((uint32_t) 0) ;
+      while (enumerator_48070.hasCurrentObject ()) {
+        if (enumerator_48070.current_value (HERE).isValid ()) {
+          if (enumerator_48070.current_value (HERE).dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct) {
+            GALGAS_gtlStruct cast_48133_itemStruct ((cPtr_gtlStruct *) enumerator_48070.current_value (HERE).ptr ()) ;
+            const enumGalgasBool test_0 = cast_48133_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1582)).getter_hasKey (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1582)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1582)).boolEnum () ;
             if (kBoolTrue == test_0) {
-              GALGAS_gtlData var_keyValue_45577 ;
-              cast_45460_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1475)).method_get (object->mProperty_key, var_keyValue_45577, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1475)) ;
+              GALGAS_gtlData var_keyValue_48250 ;
+              cast_48133_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1583)).method_get (object->mProperty_key, var_keyValue_48250, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1583)) ;
               {
-              var_resultMap_45339.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_45577.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1477)), enumerator_45397.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1476)) ;
+              var_resultMap_48012.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_48250.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1585)), enumerator_48070.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1584)) ;
               }
             }else if (kBoolFalse == test_0) {
               TC_Array <C_FixItDescription> fixItArray1 ;
-              inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1481)), GALGAS_string ("item at index ").add_operation (index_45359.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1481)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1481)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1481)).add_operation (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1482)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1482)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1481)) ;
+              inCompiler->emitSemanticError (var_expressionValue_47884.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1589)), GALGAS_string ("item at index ").add_operation (index_48032.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1589)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1589)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1589)).add_operation (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1590)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1590)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1589)) ;
             }
           }else{
             TC_Array <C_FixItDescription> fixItArray2 ;
-            inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1485)), GALGAS_string ("list of struct expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1485)) ;
+            inCompiler->emitSemanticError (var_expressionValue_47884.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1593)), GALGAS_string ("list of struct expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1593)) ;
           }
         }
-        enumerator_45397.gotoNextObject () ;
-        index_45359.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1471)) ;
+        enumerator_48070.gotoNextObject () ;
+        index_48032.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1579)) ;
       }
-      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1488)), var_resultMap_45339  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1488)) ;
+      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1596)), var_resultMap_48012  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1596)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1490)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1490)) ;
+      inCompiler->emitSemanticError (var_expressionValue_47884.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1598)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1598)) ;
       result_result.drop () ; // Release error dropped variable
     }
   }
@@ -8778,20 +9406,20 @@ static GALGAS_gtlData extensionGetter_gtlListOfExpression_eval (const cPtr_gtlEx
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlListOfExpression * object = (const cPtr_gtlListOfExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlListOfExpression) ;
-  GALGAS_gtlData var_expressionValue_46496 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1507)) ;
-  if (var_expressionValue_46496.isValid ()) {
-    if (var_expressionValue_46496.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlMap) {
-      GALGAS_gtlMap cast_46596_expressionValueMap ((cPtr_gtlMap *) var_expressionValue_46496.ptr ()) ;
-      GALGAS_list var_resultList_46618 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1510)) ;
-      cEnumerator_gtlVarMap enumerator_46680 (cast_46596_expressionValueMap.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1511)), kENUMERATION_UP) ;
-      while (enumerator_46680.hasCurrentObject ()) {
-        var_resultList_46618.addAssign_operation (enumerator_46680.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1512)) ;
-        enumerator_46680.gotoNextObject () ;
+  GALGAS_gtlData var_expressionValue_49169 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1615)) ;
+  if (var_expressionValue_49169.isValid ()) {
+    if (var_expressionValue_49169.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlMap) {
+      GALGAS_gtlMap cast_49269_expressionValueMap ((cPtr_gtlMap *) var_expressionValue_49169.ptr ()) ;
+      GALGAS_list var_resultList_49291 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1618)) ;
+      cEnumerator_gtlVarMap enumerator_49353 (cast_49269_expressionValueMap.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1619)), kENUMERATION_UP) ;
+      while (enumerator_49353.hasCurrentObject ()) {
+        var_resultList_49291.addAssign_operation (enumerator_49353.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1620)) ;
+        enumerator_49353.gotoNextObject () ;
       }
-      result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1514)), var_resultList_46618  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1514)) ;
+      result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1622)), var_resultList_49291  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1622)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray0 ;
-      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1516)) ;
+      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1624)) ;
       result_result.drop () ; // Release error dropped variable
     }
   }
@@ -8826,15 +9454,15 @@ static GALGAS_gtlData extensionGetter_gtlLiteralStructExpression_eval (const cPt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralStructExpression * object = (const cPtr_gtlLiteralStructExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralStructExpression) ;
-  GALGAS_gtlVarMap var_resultStruct_47284 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1533)) ;
-  cEnumerator_gtlExpressionMap enumerator_47322 (object->mProperty_value, kENUMERATION_UP) ;
-  while (enumerator_47322.hasCurrentObject ()) {
+  GALGAS_gtlVarMap var_resultStruct_49957 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1641)) ;
+  cEnumerator_gtlExpressionMap enumerator_49995 (object->mProperty_value, kENUMERATION_UP) ;
+  while (enumerator_49995.hasCurrentObject ()) {
     {
-    var_resultStruct_47284.setter_put (enumerator_47322.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_47322.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1535)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1535)) ;
+    var_resultStruct_49957.setter_put (enumerator_49995.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_49995.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1643)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1643)) ;
     }
-    enumerator_47322.gotoNextObject () ;
+    enumerator_49995.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1537)), var_resultStruct_47284  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1537)) ;
+  result_result = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1645)), var_resultStruct_49957  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1645)) ;
 //---
   return result_result ;
 }
@@ -8866,15 +9494,15 @@ static GALGAS_gtlData extensionGetter_gtlLiteralMapExpression_eval (const cPtr_g
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralMapExpression * object = (const cPtr_gtlLiteralMapExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralMapExpression) ;
-  GALGAS_gtlVarMap var_resultStruct_47899 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1553)) ;
-  cEnumerator_gtlExpressionMap enumerator_47937 (object->mProperty_value, kENUMERATION_UP) ;
-  while (enumerator_47937.hasCurrentObject ()) {
+  GALGAS_gtlVarMap var_resultStruct_50572 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1661)) ;
+  cEnumerator_gtlExpressionMap enumerator_50610 (object->mProperty_value, kENUMERATION_UP) ;
+  while (enumerator_50610.hasCurrentObject ()) {
     {
-    var_resultStruct_47899.setter_put (enumerator_47937.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_47937.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1555)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1555)) ;
+    var_resultStruct_50572.setter_put (enumerator_50610.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_50610.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1663)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1663)) ;
     }
-    enumerator_47937.gotoNextObject () ;
+    enumerator_50610.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1557)), var_resultStruct_47899  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1557)) ;
+  result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1665)), var_resultStruct_50572  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1665)) ;
 //---
   return result_result ;
 }
@@ -8906,13 +9534,13 @@ static GALGAS_gtlData extensionGetter_gtlLiteralListExpression_eval (const cPtr_
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralListExpression * object = (const cPtr_gtlLiteralListExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralListExpression) ;
-  GALGAS_list var_resultList_48508 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1573)) ;
-  cEnumerator_gtlExpressionList enumerator_48543 (object->mProperty_value, kENUMERATION_UP) ;
-  while (enumerator_48543.hasCurrentObject ()) {
-    var_resultList_48508.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_48543.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1575))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1575)) ;
-    enumerator_48543.gotoNextObject () ;
+  GALGAS_list var_resultList_51181 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1681)) ;
+  cEnumerator_gtlExpressionList enumerator_51216 (object->mProperty_value, kENUMERATION_UP) ;
+  while (enumerator_51216.hasCurrentObject ()) {
+    var_resultList_51181.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_51216.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1683))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1683)) ;
+    enumerator_51216.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1577)), var_resultList_48508  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1577)) ;
+  result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1685)), var_resultList_51181  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1685)) ;
 //---
   return result_result ;
 }
@@ -8944,22 +9572,22 @@ static GALGAS_gtlData extensionGetter_gtlLiteralSetExpression_eval (const cPtr_g
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralSetExpression * object = (const cPtr_gtlLiteralSetExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralSetExpression) ;
-  GALGAS_lstringset var_resultSet_49103 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1593)) ;
-  cEnumerator_gtlExpressionList enumerator_49137 (object->mProperty_value, kENUMERATION_UP) ;
-  while (enumerator_49137.hasCurrentObject ()) {
-    GALGAS_lstring var_itemValue_49163 = callExtensionGetter_lstring ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_49137.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1595)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1595)) ;
-    const enumGalgasBool test_0 = var_resultSet_49103.getter_hasKey (var_itemValue_49163.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1596)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1596)).boolEnum () ;
+  GALGAS_lstringset var_resultSet_51776 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1701)) ;
+  cEnumerator_gtlExpressionList enumerator_51810 (object->mProperty_value, kENUMERATION_UP) ;
+  while (enumerator_51810.hasCurrentObject ()) {
+    GALGAS_lstring var_itemValue_51836 = callExtensionGetter_lstring ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_51810.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1703)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1703)) ;
+    const enumGalgasBool test_0 = var_resultSet_51776.getter_hasKey (var_itemValue_51836.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1704)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1704)).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      var_resultSet_49103.setter_del (var_itemValue_49163, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1597)) ;
+      var_resultSet_51776.setter_del (var_itemValue_51836, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1705)) ;
       }
     }
     {
-    var_resultSet_49103.setter_put (var_itemValue_49163, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1599)) ;
+    var_resultSet_51776.setter_put (var_itemValue_51836, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1707)) ;
     }
-    enumerator_49137.gotoNextObject () ;
+    enumerator_51810.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlSet::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1601)), var_resultSet_49103  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1601)) ;
+  result_result = GALGAS_gtlSet::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1709)), var_resultSet_51776  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1709)) ;
 //---
   return result_result ;
 }
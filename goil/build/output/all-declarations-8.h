@@ -68,6 +68,79 @@ class GALGAS_gtlString function_stringToGtlString (class GALGAS_string inArgumen
 class GALGAS_gtlContext function_emptyContext (class C_Compiler * inCompiler
                                                COMMA_LOCATION_ARGS) ;
 
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                               Function 'intTerminal'                                                *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_bool function_intTerminal (const class GALGAS_gtlExpression & constinArgument0,
+                                        class C_Compiler * inCompiler
+                                        COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                  Extension getter '@gtlExpression foldedTerminal'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef class GALGAS_gtlExpression (*enterExtensionGetter_gtlExpression_foldedTerminal) (const class cPtr_gtlExpression * inObject,
+                                                                                         C_Compiler * inCompiler
+                                                                                         COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_foldedTerminal (const int32_t inClassIndex,
+                                          enterExtensionGetter_gtlExpression_foldedTerminal inGetter) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_gtlExpression callExtensionGetter_foldedTerminal (const cPtr_gtlExpression * inObject,
+                                                               class C_Compiler * inCompiler
+                                                               COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                   Extension getter '@gtlBinaryExpression mayFold'                                   *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef class GALGAS_bool (*enterExtensionGetter_gtlBinaryExpression_mayFold) (const class cPtr_gtlBinaryExpression * inObject,
+                                                                               C_Compiler * inCompiler
+                                                                               COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_mayFold (const int32_t inClassIndex,
+                                   enterExtensionGetter_gtlBinaryExpression_mayFold inGetter) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_bool callExtensionGetter_mayFold (const cPtr_gtlBinaryExpression * inObject,
+                                               class C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+//                                                                                                                     *
+//                                Extension getter '@gtlBinaryExpression rightIntValue'                                *
+//                                                                                                                     *
+//---------------------------------------------------------------------------------------------------------------------*
+
+typedef class GALGAS_bigint (*enterExtensionGetter_gtlBinaryExpression_rightIntValue) (const class cPtr_gtlBinaryExpression * inObject,
+                                                                                       C_Compiler * inCompiler
+                                                                                       COMMA_LOCATION_ARGS) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+void enterExtensionGetter_rightIntValue (const int32_t inClassIndex,
+                                         enterExtensionGetter_gtlBinaryExpression_rightIntValue inGetter) ;
+
+//---------------------------------------------------------------------------------------------------------------------*
+
+class GALGAS_bigint callExtensionGetter_rightIntValue (const cPtr_gtlBinaryExpression * inObject,
+                                                       class C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
 //---------------------------------------------------------------------------------------------------------------------*
 //                                                                                                                     *
 //                                           Function 'defaultDebugSettings'                                           *
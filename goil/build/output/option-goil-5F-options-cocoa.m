@@ -41,6 +41,15 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"stats"
+    commandChar:0
+    commandString:@"stats"
+    comment:@"Print the time spent in each phase of the compilation"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"goil_options"
     identifier:@"warnMultiple"
@@ -86,6 +95,15 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@"root"
   ] ;
   [ioStringOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"stats_file"
+    commandChar:0
+    commandString:@"stats-file"
+    comment:@"Write the time spent in each phase of the compilation to a JSON file"
+    defaultValue:@""
+  ] ;
+  [ioStringOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"goil_options"
     identifier:@"target_platform"
@@ -23,6 +23,15 @@ void enterOptionsFor_gtl_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"gtl_options"
+    identifier:@"profileTemplates"
+    commandChar:0
+    commandString:@"profile-templates"
+    comment:@"Write the time spent in each GTL template to gtl-profile.txt and gtl-profile.folded"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"gtl_options"
     identifier:@"warnDeprecated"
@@ -195,6 +195,14 @@
 
 #endif /* WITH_COM */
 
+#ifndef WITH_ACTIVATION_RING
+#error "Misconfiguration of the OS. WITH_ACTIVATION_RING is not defined"
+#elif WITH_ACTIVATION_RING != YES && WITH_ACTIVATION_RING != NO
+#error "Misconfiguration of the OS. WITH_ACTIVATION_RING is not set to YES or NO"
+#elif WITH_ACTIVATION_RING == YES && NUMBER_OF_CORES > 1
+#error "Misconfiguration of the OS. WITH_ACTIVATION_RING is only available in monocore"
+#endif
+
 /*
  * Check the macros defining the number of objects of each kind are set
  */
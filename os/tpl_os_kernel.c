@@ -88,50 +88,17 @@ CONST(tpl_proc_id, AUTOMATIC) INVALID_TASK = INVALID_PROC_ID;
  * to be declared as external in a header file
  */
 
-#if TASK_COUNT > 0
-/**
- * @internal
- *
- * tpl_task_app_mode is a table that is automatically generated by goil from
- * the application description. Indexes of this table are the tasks'
- * identifiers.
- * each of its elements is an application mode mask. For an AUTOSTART task with
- * identifier id in application mode app_mode, tpl_task_app_mode[id] & app_mode
- * will be true.
- */
-extern CONST(tpl_appmode_mask, OS_CONST) tpl_task_app_mode[TASK_COUNT];
-
-#endif
-
-#if ALARM_COUNT > 0
-
+#if APP_MODE_COUNT > 0
 /**
  * @internal
  *
- * tpl_alarm_app_mode is a table that is automatically generated by goil from
- * the application description. Indexes of this table are the alarms'
- * identifiers.
- * each of its elements is an application mode mask.
- * For an AUTOSTART alarm with identifier id in application mode app_mode,
- * tpl_alarm_app_mode[id] & app_mode will be true.
- */
-extern CONST(tpl_appmode_mask, OS_CONST) tpl_alarm_app_mode[ALARM_COUNT];
-
-#endif
-
-#if SCHEDTABLE_COUNT > 0
-
-/**
- * @internal
- *
- * tpl_scheduletable_app_mode is a table that is automatically generated by
+ * tpl_appmode_autostart_table is a table that is automatically generated by
  * goil from the application description. Indexes of this table are the
- * schedule tables' identifiers. each of its elements is an application mode
- * mask. For an AUTOSTART schedule table with identifier id in application
- * mode app_mode, tpl_scheduletable_app_mode[id] & app_mode will be true.
+ * application modes identifiers. Each of its elements lists the AUTOSTART
+ * tasks, alarms and schedule tables of the application mode.
  */
-extern CONST(tpl_appmode_mask, OS_CONST)
-  tpl_scheduletable_app_mode[SCHEDTABLE_COUNT];
+extern CONST(tpl_appmode_autostart, OS_CONST)
+  tpl_appmode_autostart_table[APP_MODE_COUNT];
 
 #endif
 
@@ -210,6 +177,8 @@ FUNC(void, OS_CODE) print_kern(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg)
  * the sum of the activations of a process (each activation of a process is
  * a job. The key is the concatenation of the priority of the job and the
  * rank of the job. The max value is a higher rank.
+ * When the activation ring is used, a task has at most one job in the heap
+ * and the size of the heap is the number of processes.
  *
  * The head of the queue contains the highest priority job and so the running
  * job.
@@ -460,7 +429,90 @@ FUNC(tpl_heap_entry, OS_CODE) tpl_remove_front_proc(CORE_ID_OR_VOID(core_id))
   return proc;
 }
 
+#if WITH_ACTIVATION_RING == YES
+
+/**
+ * @internal
+ *
+ * tpl_put_activation puts a new activation of a task in the ready list
+ * if the task has no job in it and no older activation is pending at its
+ * priority level. Otherwise the activation is appended to the activation
+ * ring of the priority level so that the FIFO order among the activations
+ * of the same priority is kept.
+ *
+ * It is called before the activation count of the task is incremented.
+ */
+FUNC(void, OS_CODE) tpl_put_activation(
+  CONST(tpl_task_id, AUTOMATIC) task_id)
+{
+  CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) task =
+    tpl_dyn_proc_table[task_id];
+  CONSTP2VAR(tpl_activation_ring, AUTOMATIC, OS_VAR) ring =
+    &tpl_activation_ring_table[tpl_stat_proc_table[task_id]->base_priority];
+
+  if ((task->activate_count == 0) && (ring->count == 0))
+  {
+    tpl_put_new_proc((tpl_proc_id)task_id);
+  }
+  else
+  {
+    VAR(uint16, AUTOMATIC) tail = ring->head + ring->count;
+
+    if (tail >= ring->size)
+    {
+      tail -= ring->size;
+    }
+    if (task->activate_count == 0)
+    {
+      /* the task waits for the older activations to be put in the list */
+      task->state = (tpl_proc_state)READY_AND_QUEUED;
+    }
+    ring->buffer[tail] = (tpl_proc_id)task_id;
+    ring->count++;
+
+    DOW_DO(printf("queue activation %s, %d\n",
+      proc_name_table[task_id], ring->count));
+  }
+}
+
+/**
+ * @internal
+ *
+ * tpl_refill_ready_list is called when a task of priority prio loses its
+ * job in the ready list (ie when it terminates). The oldest activations
+ * of the ring are put in the ready list as long as their task has no
+ * job in it. A task has no job in the ready list when it is in the
+ * READY_AND_QUEUED state.
+ */
+FUNC(void, OS_CODE) tpl_refill_ready_list(
+  CONST(tpl_priority, AUTOMATIC) prio)
+{
+  CONSTP2VAR(tpl_activation_ring, AUTOMATIC, OS_VAR) ring =
+    &tpl_activation_ring_table[prio];
+
+  while (ring->count > 0)
+  {
+    CONST(tpl_proc_id, AUTOMATIC) proc_id = ring->buffer[ring->head];
+
+    if (tpl_dyn_proc_table[proc_id]->state != (tpl_proc_state)READY_AND_QUEUED)
+    {
+      /* the task already has a job in the ready list, stop here */
+      break;
+    }
 
+    tpl_dyn_proc_table[proc_id]->state = (tpl_proc_state)READY_AND_NEW;
+    tpl_put_new_proc(proc_id);
+
+    ring->head++;
+    if (ring->head == ring->size)
+    {
+      ring->head = 0;
+    }
+    ring->count--;
+  }
+}
+
+#endif /* WITH_ACTIVATION_RING */
 
 #if WITH_OSAPPLICATION == YES
 
@@ -497,6 +549,43 @@ FUNC(void, OS_CODE) tpl_remove_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id)
 
   READY_LIST(ready_list)[0].key = size;
 
+#if WITH_ACTIVATION_RING == YES
+  if (proc_id < TASK_COUNT)
+  {
+    /* remove the pending activations of the proc from its ring */
+    CONST(tpl_priority, AUTOMATIC) prio =
+      tpl_stat_proc_table[proc_id]->base_priority;
+    CONSTP2VAR(tpl_activation_ring, AUTOMATIC, OS_VAR) ring =
+      &tpl_activation_ring_table[prio];
+    VAR(uint16, AUTOMATIC) from = ring->head;
+    VAR(uint16, AUTOMATIC) to = ring->head;
+    VAR(uint16, AUTOMATIC) kept = 0;
+
+    for (index = 0; index < ring->count; index++)
+    {
+      if (ring->buffer[from] != proc_id)
+      {
+        ring->buffer[to] = ring->buffer[from];
+        kept++;
+        to++;
+        if (to == ring->size)
+        {
+          to = 0;
+        }
+      }
+      from++;
+      if (from == ring->size)
+      {
+        from = 0;
+      }
+    }
+    ring->count = kept;
+
+    /* the head of the ring may have no job in the ready list now */
+    tpl_refill_ready_list(prio);
+  }
+#endif
+
   DOW_DO(printrl("tpl_remove_proc - after");)
 }
 
@@ -850,7 +939,25 @@ FUNC(void, OS_CODE) tpl_terminate(void)
      * way when the next instance will be prepared to run it will
      * be initialized.
      */
-    TPL_KERN_REF(kern).running->state = READY_AND_NEW;
+#if WITH_ACTIVATION_RING == YES
+    if ((TPL_KERN_REF(kern).running_id < TASK_COUNT) &&
+        (tpl_activation_ring_table[
+           TPL_KERN_REF(kern).s_running->base_priority].count > 0))
+    {
+      /*
+       * with the activation ring, the next instance of a task waits
+       * in the ring of its priority until the older activations have been
+       * put in the ready list. When the ring is empty, the next instance
+       * has been put in the ready list by a ChainTask of the task itself
+       * and it is started as a new one.
+       */
+      TPL_KERN_REF(kern).running->state = READY_AND_QUEUED;
+    }
+    else
+#endif
+    {
+      TPL_KERN_REF(kern).running->state = READY_AND_NEW;
+    }
 
 #if EXTENDED_TASK_COUNT > 0
     /*  if the object is an extended task, init the events          */
@@ -872,6 +979,14 @@ FUNC(void, OS_CODE) tpl_terminate(void)
     TPL_KERN_REF(kern).running->state = SUSPENDED;
   }
 
+#if WITH_ACTIVATION_RING == YES
+  /* the task has no job in the ready list anymore */
+  if (TPL_KERN_REF(kern).running_id < TASK_COUNT)
+  {
+    tpl_refill_ready_list(TPL_KERN_REF(kern).s_running->base_priority);
+  }
+#endif
+
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
   /* notify the timing protection service */
   tpl_tp_on_terminate_or_wait(TPL_KERN_REF(kern).running_id);
@@ -1001,7 +1116,11 @@ FUNC(tpl_status, OS_CODE) tpl_activate_task(
       result = E_OK;
 
       /*  put it in the list                                            */
+#if WITH_ACTIVATION_RING == YES
+      tpl_put_activation(task_id);
+#else
       tpl_put_new_proc(task_id);
+#endif
       /*  inc the task activation count. When the task will terminate
           it will dec this count and if not zero it will be reactivated */
       task->activate_count++;
@@ -1144,17 +1263,16 @@ FUNC(void, OS_CODE) tpl_init_proc(
 FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
 {
   GET_CURRENT_CORE_ID(core_id)
-#if TASK_COUNT > 0 || ALARM_COUNT > 0 || SCHEDTABLE_COUNT > 0
+#if APP_MODE_COUNT > 0
   VAR(uint16, AUTOMATIC) i;
-  CONST(tpl_appmode_mask, AUTOMATIC) app_mode_mask = 1 << app_mode;
+  P2CONST(tpl_appmode_autostart, AUTOMATIC, OS_CONST) autostart;
 #endif
   VAR(tpl_status, AUTOMATIC) result = E_OK;
-#if ALARM_COUNT > 0
+#if (ALARM_COUNT > 0) || ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0))
   P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) auto_time_obj;
 #endif
-
-#if (WITH_AUTOSAR == YES) && (ALARM_COUNT == 0) && (SCHEDTABLE_COUNT > 0)
-  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) auto_time_obj;
+#if ALARM_COUNT > 0
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) last_time_obj = NULL;
 #endif
 
   /*  Start the idle task */
@@ -1175,54 +1293,63 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
   }
 #endif
 
-#if TASK_COUNT > 0
-  /*  Look for autostart tasks    */
-  for (i = 0; i < TASK_COUNT; i++)
+#if APP_MODE_COUNT > 0
+  if ((app_mode >= 0) && (app_mode < APP_MODE_COUNT))
   {
-    /*  each AUTOSTART task is activated if it belong to the  */
-    if (tpl_task_app_mode[i] & app_mode_mask)
+    autostart = &tpl_appmode_autostart_table[app_mode];
+
+#if TASK_COUNT > 0
+    /*  Activate the autostart tasks of the application mode    */
+    for (i = 0; i < autostart->task_count; i++)
     {
 # if NUMBER_OF_CORES > 1
       /* In multicore, we must check if the task belongs to the core */
-      if (tpl_stat_proc_table[i]->core_id == core_id)
+      if (tpl_stat_proc_table[autostart->tasks[i]]->core_id == core_id)
 # endif
       {
-        result = tpl_activate_task(i);
+        result = tpl_activate_task(autostart->tasks[i]);
       }
     }
-  }
 #endif
 #if ALARM_COUNT > 0
-
-  /*  Look for autostart alarms    */
-
-  for (i = 0; i < ALARM_COUNT; i++)
-  {
-    if (tpl_alarm_app_mode[i] & app_mode_mask)
+    /*  Start the autostart alarms of the application mode.
+        They are sorted by counter and by date, so an alarm which
+        follows an alarm of the same counter is appended at the end
+        of the queue of the counter                                 */
+    for (i = 0; i < autostart->alarm_count; i++)
     {
       auto_time_obj =
-        (P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA))tpl_alarm_table[i];
+        (P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA))
+          tpl_alarm_table[autostart->alarms[i]];
 # if (NUMBER_OF_CORES > 1) && (WITH_OSAPPLICATION == YES)
       /* In multicore, we must check if the alarm belongs to the core */
       if (tpl_core_id_for_app[auto_time_obj->stat_part->app_id] == core_id)
 # endif
       {
         auto_time_obj->state = ALARM_ACTIVE;
-        tpl_insert_time_obj(auto_time_obj);
+        if ((last_time_obj != NULL) &&
+            (last_time_obj->stat_part->counter ==
+               auto_time_obj->stat_part->counter))
+        {
+          auto_time_obj->prev_to = last_time_obj;
+          auto_time_obj->next_to = NULL;
+          last_time_obj->next_to = auto_time_obj;
+        }
+        else
+        {
+          tpl_insert_time_obj(auto_time_obj);
+        }
+        last_time_obj = auto_time_obj;
       }
     }
-  }
-
 #endif
 #if (WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)
-  /*  Look for autostart schedule tables  */
-
-  for (i = 0; i < SCHEDTABLE_COUNT; i++)
-  {
-    if (tpl_scheduletable_app_mode[i] & app_mode_mask)
+    /*  Start the autostart schedule tables of the application mode  */
+    for (i = 0; i < autostart->schedtable_count; i++)
     {
       auto_time_obj =
-        (P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA))tpl_schedtable_table[i];
+        (P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA))
+          tpl_schedtable_table[autostart->schedtables[i]];
 # if (NUMBER_OF_CORES > 1) && (WITH_OSAPPLICATION == YES)
       /* In multicore, we must check if the schedule table belongs to the core */
       if (tpl_core_id_for_app[auto_time_obj->stat_part->app_id] == core_id)
@@ -1231,14 +1358,14 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
         if (auto_time_obj->state == (tpl_time_obj_state)SCHEDULETABLE_AUTOSTART_RELATIVE)
         {
           auto_time_obj->state = SCHEDULETABLE_STOPPED;
-          result = tpl_start_schedule_table_rel(i, auto_time_obj->date);
+          result = tpl_start_schedule_table_rel(autostart->schedtables[i], auto_time_obj->date);
         }
         else
         {
           if (auto_time_obj->state == (tpl_time_obj_state)SCHEDULETABLE_AUTOSTART_ABSOLUTE)
           {
             auto_time_obj->state = SCHEDULETABLE_STOPPED;
-            result = tpl_start_schedule_table_abs(i, auto_time_obj->date);
+            result = tpl_start_schedule_table_abs(autostart->schedtables[i], auto_time_obj->date);
           }
 #if AUTOSAR_SC == 2 || AUTOSAR_SC == 4
           else
@@ -1246,13 +1373,14 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
             if (auto_time_obj->state == (tpl_time_obj_state)SCHEDULETABLE_AUTOSTART_SYNCHRON)
             {
               auto_time_obj->state = SCHEDULETABLE_STOPPED;
-              result = tpl_start_schedule_table_synchron(i);
+              result = tpl_start_schedule_table_synchron(autostart->schedtables[i]);
             }
           }
 #endif
         }
       }
     }
+#endif
   }
 #endif
 }
@@ -112,6 +112,19 @@ typedef uint8 tpl_os_state;
  */
 #define READY_AND_NEW   0x5
 
+/**
+ * @def READY_AND_QUEUED
+ *
+ * Task is ready but its activation waits in the activation ring of its
+ * priority. It is put in the ready list, in the READY_AND_NEW state, when
+ * the older activations of the priority level have been put in it.
+ * Like READY_AND_NEW, its two low bits are the ones of READY, so
+ * GetTaskState reports it as READY.
+ *
+ * @see #tpl_exec_state
+ */
+#define READY_AND_QUEUED  0x9
+
 /**
  * @typedef tpl_exec_obj_type
  *
@@ -288,6 +301,43 @@ typedef struct {
   VAR(tpl_proc_id, TYPEDEF)   id;
 } tpl_heap_entry;
 
+/**
+ * @typedef tpl_appmode_autostart
+ *
+ * This type gathers the AUTOSTART objects of an application mode. The
+ * arrays are computed by goil so that tpl_init_os does not have to scan
+ * all the tasks, alarms and schedule tables at startup. Alarms are sorted
+ * by counter and by date so that they may be appended to the time object
+ * queue of their counter.
+ */
+typedef struct {
+  VAR(uint16, TYPEDEF)                            task_count;
+  VAR(uint16, TYPEDEF)                            alarm_count;
+  P2CONST(tpl_task_id, TYPEDEF, OS_CONST)         tasks;
+  P2CONST(tpl_alarm_id, TYPEDEF, OS_CONST)        alarms;
+#if WITH_AUTOSAR == YES
+  VAR(uint16, TYPEDEF)                            schedtable_count;
+  P2CONST(tpl_schedtable_id, TYPEDEF, OS_CONST)   schedtables;
+#endif
+} tpl_appmode_autostart;
+
+#if WITH_ACTIVATION_RING == YES
+/**
+ * @typedef tpl_activation_ring
+ *
+ * This type is a FIFO of the pending activations of the tasks of a
+ * priority level. With the activation ring, a task has at most one job in
+ * the ready list. The other activations wait in the ring of its base
+ * priority and are moved to the ready list in the order they occured.
+ */
+typedef struct {
+  CONSTP2VAR(tpl_proc_id, TYPEDEF, OS_VAR)  buffer; /**< slots of the ring */
+  CONST(uint16, TYPEDEF)                    size;   /**< number of slots   */
+  VAR(uint16, TYPEDEF)                      head;   /**< oldest activation */
+  VAR(uint16, TYPEDEF)                      count;  /**< activations       */
+} tpl_activation_ring;
+#endif
+
 
 #define OS_START_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -481,6 +531,22 @@ extern VAR(tpl_rank_count, OS_VAR) tpl_tail_for_prio[];
 
 #endif
 
+#if WITH_ACTIVATION_RING == YES
+/**
+ * @internal
+ *
+ * tpl_activation_ring_table is indexed by the priority level. It is generated
+ * by goil, only in monocore.
+ */
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+extern VAR(tpl_activation_ring, OS_VAR) tpl_activation_ring_table[];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+#endif
+
 #define OS_START_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 /**
@@ -598,6 +664,31 @@ FUNC(void, OS_CODE) tpl_remove_proc(
   CONST(tpl_proc_id, AUTOMATIC) proc_id);
 #endif
 
+#if WITH_ACTIVATION_RING == YES
+/**
+ * @internal
+ *
+ * Put a new activation of a task in the ready list or, if the task
+ * has already a job in it or if older activations of the same priority
+ * are pending, in the activation ring of its priority.
+ *
+ * @param task_id   the identifier of the task
+ */
+FUNC(void, OS_CODE) tpl_put_activation(
+  CONST(tpl_task_id, AUTOMATIC) task_id);
+
+/**
+ * @internal
+ *
+ * Move the oldest pending activations of a priority level to the ready
+ * list as long as their task has no job in it.
+ *
+ * @param prio      the priority level
+ */
+FUNC(void, OS_CODE) tpl_refill_ready_list(
+  CONST(tpl_priority, AUTOMATIC) prio);
+#endif
+
 /**
  * @internal
  *
@@ -0,0 +1,279 @@
+#! /usr/bin/env python
+# -*- coding: UTF-8 -*-
+
+#-----------------------------------------------------------------------------*
+#
+#  @file goil_benchmark.py
+#
+#  @section desc File description
+#
+#  Scaling benchmark for goil. Generates OIL configurations of increasing
+#  size, runs goil on each of them and reports the run time and the peak
+#  memory of goil per size.
+#
+#  For a configuration of N tasks, the generated application has:
+#    - N tasks,
+#    - 5 N alarms,
+#    - N / 5 ISRs and N / 5 resources,
+#    - N / 20 schedule tables of 20 expiry points each,
+#    - N / 20 IOC channels from an OS-Application to the next one (none
+#      when there is only one OS-Application),
+#    - N / 100 OS-Applications (at least 1), each one with its own counter,
+#      spread over the cores given by --cores.
+#
+#  Usage: goil_benchmark.py [--goil=goil] [--target=posix]
+#                           [--templates=../../goil/templates]
+#                           [--sizes=100,1000,5000] [--cores=1] [--runs=1]
+#                           [--csv=results.csv] [--keep]
+#
+#  The ratio column is the time per task of a size divided by the time per
+#  task of the smallest size. It stays close to 1 when goil scales linearly.
+#
+#  @section copyright Copyright
+#
+#  Trampoline Test Suite
+#
+#  Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+#  Trampoline Test Suite is protected by the French intellectual property law.
+#
+#  This program is free software; you can redistribute it and/or
+#  modify it under the terms of the GNU General Public License
+#  as published by the Free Software Foundation; version 2
+#  of the License.
+#
+#-----------------------------------------------------------------------------*
+
+import sys, os, time, shutil, subprocess, platform
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TPL_DIR = os.path.normpath(os.path.join(SCRIPT_DIR, "..", ".."))
+
+#-----------------------------------------------------------------------------*
+# Configuration generation
+#-----------------------------------------------------------------------------*
+
+def application_of(index, count, appCount):
+  return "app%d" % (index * appCount // max(count, 1))
+
+def generate_oil(name, taskCount, coreCount):
+  alarmCount = 5 * taskCount
+  isrCount = max(taskCount // 5, 1)
+  resourceCount = max(taskCount // 5, 1)
+  tableCount = max(taskCount // 20, 1)
+  iocCount = max(taskCount // 20, 1)
+  appCount = max(taskCount // 100, 1)
+  sources = ["SIGTERM", "SIGQUIT", "SIGUSR2", "SIGPIPE", "SIGTRAP"]
+  app = {}
+  for a in range(appCount):
+    app["app%d" % a] = []
+  oil = []
+  oil.append('OIL_VERSION = "4.0" : "%s";\n' % name)
+  oil.append("CPU %s {" % name)
+  oil.append("  OS config {")
+  oil.append("    STATUS = EXTENDED;")
+  if coreCount > 1:
+    oil.append("    NUMBER_OF_CORES = %d;" % coreCount)
+  oil.append("    BUILD = TRUE {")
+  oil.append('      APP_SRC = "%s.c";' % name)
+  oil.append('      TRAMPOLINE_BASE_PATH = "%s";' % TPL_DIR)
+  oil.append('      APP_NAME = "%s_exe";' % name)
+  oil.append("    };")
+  oil.append("  };")
+  oil.append("  APPMODE std {};")
+#--- Tasks, two consecutive tasks share a resource
+  for t in range(taskCount):
+    a = application_of(t, taskCount, appCount)
+    app[a].append("TASK = t%d;" % t)
+    oil.append("  TASK t%d {" % t)
+    if t % 50 == 0:
+      oil.append("    AUTOSTART = TRUE { APPMODE = std; };")
+    else:
+      oil.append("    AUTOSTART = FALSE;")
+    oil.append("    PRIORITY = %d;" % (t % 200 + 1))
+    oil.append("    ACTIVATION = 1;")
+    oil.append("    SCHEDULE = FULL;")
+    r = t // 2
+    if r < resourceCount and application_of(2 * r, taskCount, appCount) == \
+       application_of(2 * r + 1, taskCount, appCount):
+      oil.append("    RESOURCE = r%d;" % r)
+    oil.append("  };")
+  for r in range(resourceCount):
+    oil.append("  RESOURCE r%d { RESOURCEPROPERTY = STANDARD; };" % r)
+    if 2 * r + 1 < taskCount and application_of(2 * r, taskCount, appCount) == \
+       application_of(2 * r + 1, taskCount, appCount):
+      app[application_of(2 * r, taskCount, appCount)].append("RESOURCE = r%d;" % r)
+#--- One counter per application
+  for a in range(appCount):
+    app["app%d" % a].append("COUNTER = counter%d;" % a)
+    oil.append("  COUNTER counter%d {" % a)
+    oil.append("    MAXALLOWEDVALUE = 65535;")
+    oil.append("    TICKSPERBASE = 1;")
+    oil.append("    MINCYCLE = 1;")
+    oil.append("    TYPE = SOFTWARE;")
+    oil.append("  };")
+#--- Alarms activate a task of their application
+  for l in range(alarmCount):
+    t = l % taskCount
+    a = application_of(t, taskCount, appCount)
+    app[a].append("ALARM = alarm%d;" % l)
+    oil.append("  ALARM alarm%d {" % l)
+    oil.append("    COUNTER = counter%s;" % a[3:])
+    oil.append("    ACTION = ACTIVATETASK { TASK = t%d; };" % t)
+    oil.append("    AUTOSTART = FALSE;")
+    oil.append("  };")
+#--- ISRs
+  for i in range(isrCount):
+    a = application_of(i, isrCount, appCount)
+    app[a].append("ISR = isr%d;" % i)
+    oil.append("  ISR isr%d {" % i)
+    oil.append("    CATEGORY = 2;")
+    oil.append("    PRIORITY = %d;" % (i % 10 + 1))
+    oil.append("    SOURCE = %s;" % sources[i % len(sources)])
+    oil.append("  };")
+#--- Schedule tables of 20 expiry points activating tasks of their application
+  for s in range(tableCount):
+    first = s * taskCount // tableCount
+    a = application_of(first, taskCount, appCount)
+    tasks = [t for t in range(taskCount) if application_of(t, taskCount, appCount) == a]
+    app[a].append("SCHEDULETABLE = table%d;" % s)
+    oil.append("  SCHEDULETABLE table%d {" % s)
+    oil.append("    COUNTER = counter%s;" % a[3:])
+    oil.append("    AUTOSTART = NONE;")
+    oil.append("    LOCAL_TO_GLOBAL_TIME_SYNCHRONIZATION = FALSE;")
+    oil.append("    PERIODIC = TRUE;")
+    oil.append("    LENGTH = 200;")
+    for e in range(20):
+      oil.append("    EXPIRY_POINT ep%d {" % e)
+      oil.append("      OFFSET = %d;" % (e * 10))
+      oil.append("      ACTION = ACTIVATETASK { TASK = t%d; };" % tasks[(s + e) % len(tasks)])
+      oil.append("    };")
+    oil.append("  };")
+#--- IOC channels from one application to the next one. goil rejects an IOC
+#    whose sender and receiver are in the same application, so there is no
+#    IOC when there is only one application
+  if appCount == 1:
+    iocCount = 0
+  for c in range(iocCount):
+    sender = "app%d" % (c % appCount)
+    receiver = "app%d" % ((c + 1) % appCount)
+    app[sender].append("IOC = ioc%d;" % c)
+    app[receiver].append("IOC = ioc%d;" % c)
+    oil.append("  IOC ioc%d {" % c)
+    oil.append("    DATATYPENAME uint32 { DATATYPEPROPERTY = DATA; };")
+    oil.append("    SEMANTICS = QUEUED { BUFFER_LENGTH = 4; };")
+    oil.append("    RECEIVER RCV {")
+    oil.append("      RCV_OSAPPLICATION = %s;" % receiver)
+    oil.append("      RECEIVER_PULL_CB = AUTO;")
+    oil.append("      ACTION = NONE;")
+    oil.append("    };")
+    oil.append("    SENDER SND {")
+    oil.append("      SENDER_ID = 0;")
+    oil.append("      SND_OSAPPLICATION = %s;" % sender)
+    oil.append("    };")
+    oil.append("  };")
+#--- OS-Applications
+  for a in range(appCount):
+    oil.append("  APPLICATION app%d {" % a)
+    for item in app["app%d" % a]:
+      oil.append("    " + item)
+    oil.append("    TRUSTED = TRUE;")
+    if coreCount > 1:
+      oil.append("    CORE = %d;" % (a % coreCount))
+    oil.append("  };")
+  oil.append("};")
+  return "\n".join(oil) + "\n"
+
+#-----------------------------------------------------------------------------*
+# goil run, returns the wall time in s and the peak memory in KB
+#-----------------------------------------------------------------------------*
+
+def run_goil(goil, target, templates, directory, oilFile):
+  start = time.time()
+  process = subprocess.Popen(
+    [goil, "--target=" + target, "--templates=" + templates, oilFile],
+    cwd=directory, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+    universal_newlines=True
+  )
+  output = process.stdout.read()
+  pid, status, usage = os.wait4(process.pid, 0)
+  elapsed = time.time() - start
+  peak = usage.ru_maxrss
+  if platform.system() == "Darwin": # bytes instead of KB
+    peak = peak // 1024
+  if status != 0:
+    sys.stdout.write(output)
+    print("*** goil failed on " + os.path.join(directory, oilFile))
+    sys.exit(1)
+  return elapsed, peak
+
+#-----------------------------------------------------------------------------*
+
+def main():
+  goil = "goil"
+  target = "posix"
+  templates = os.path.join(TPL_DIR, "goil", "templates")
+  sizes = [100, 1000, 5000]
+  cores = 1
+  runs = 1
+  csvFile = ""
+  keep = False
+  for arg in sys.argv[1:]:
+    if arg.startswith("--goil="):
+      goil = arg[len("--goil="):]
+    elif arg.startswith("--target="):
+      target = arg[len("--target="):]
+    elif arg.startswith("--templates="):
+      templates = os.path.abspath(arg[len("--templates="):])
+    elif arg.startswith("--sizes="):
+      sizes = [int(s) for s in arg[len("--sizes="):].split(",")]
+    elif arg.startswith("--cores="):
+      cores = int(arg[len("--cores="):])
+    elif arg.startswith("--runs="):
+      runs = int(arg[len("--runs="):])
+    elif arg.startswith("--csv="):
+      csvFile = arg[len("--csv="):]
+    elif arg == "--keep":
+      keep = True
+    else:
+      print("usage: " + os.path.basename(sys.argv[0]) +
+            " [--goil=goil] [--target=posix] [--templates=dir]" +
+            " [--sizes=100,1000,5000] [--cores=1] [--runs=1]" +
+            " [--csv=file] [--keep]")
+      sys.exit(1)
+  workDir = os.path.join(SCRIPT_DIR, "build")
+  results = []
+  print("%8s %10s %12s %8s" % ("tasks", "time (s)", "peak (KB)", "ratio"))
+  for size in sorted(sizes):
+    name = "bench_%d" % size
+    directory = os.path.join(workDir, name)
+    if os.path.isdir(directory):
+      shutil.rmtree(directory)
+    os.makedirs(directory)
+    with open(os.path.join(directory, name + ".oil"), "w") as f:
+      f.write(generate_oil(name, size, cores))
+  #--- best time and largest peak memory of the runs
+    bestTime = None
+    peak = 0
+    for r in range(runs):
+      elapsed, memory = run_goil(goil, target, templates, directory, name + ".oil")
+      if bestTime == None or elapsed < bestTime:
+        bestTime = elapsed
+      peak = max(peak, memory)
+    if len(results) == 0:
+      ratio = 1.0
+    else:
+      ratio = (bestTime / size) / (results[0][1] / results[0][0])
+    results.append((size, bestTime, peak, ratio))
+    print("%8d %10.3f %12d %8.2f" % (size, bestTime, peak, ratio))
+  if csvFile != "":
+    with open(csvFile, "w") as f:
+      f.write("tasks,time_s,peak_kb,ratio\n")
+      for size, elapsed, memory, ratio in results:
+        f.write("%d,%.3f,%d,%.2f\n" % (size, elapsed, memory, ratio))
+  if not keep:
+    shutil.rmtree(workDir)
+
+#-----------------------------------------------------------------------------*
+
+if __name__ == "__main__":
+  main()